@@ -137,6 +137,52 @@ AC_DEFUN([AX_LIBCDATETIME_CHECK_LOCAL],
       [Missing function: time],
       [1])
     ])
+
+  dnl Date and time functions used in libcdatetime/libcdatetime_timestamp.c
+  dnl Older versions of glibc provide clock_gettime in librt
+  AC_SEARCH_LIBS(
+    [clock_gettime],
+    [rt])
+
+  AC_CHECK_FUNCS([clock_gettime])
+
+  dnl Headers and functions used in libcdatetime/libcdatetime_identifier_generator.c
+  AC_CHECK_HEADERS([fcntl.h sys/random.h unistd.h])
+
+  AC_CHECK_FUNCS([getrandom])
+
+  dnl Thread functions used in libcdatetime/libcdatetime_ticker.c
+  AC_CHECK_HEADERS([pthread.h])
+
+  AS_IF(
+    [test "x$ac_cv_header_pthread_h" = xyes],
+    [AC_SEARCH_LIBS(
+      [pthread_create],
+      [pthread])
+
+    AS_IF(
+      [test "x$ac_cv_search_pthread_create" != xno],
+      [AC_CHECK_FUNCS([pthread_condattr_setclock])
+
+      AC_DEFINE(
+        [HAVE_MULTI_THREAD_SUPPORT],
+        [1],
+        [Define to 1 if multi thread support should be used.])
+      ])
+    ])
+
+  dnl Headers and functions used in libcdatetime/libcdatetime_system_timezone.c
+  AC_CHECK_HEADERS([poll.h sys/inotify.h])
+
+  AC_CHECK_FUNCS([inotify_init1])
+
+  dnl Headers and functions used in libcdatetime/libcdatetime_timezone_database.c
+  AC_CHECK_HEADERS([sys/mman.h sys/stat.h])
+
+  AC_CHECK_FUNCS([mmap])
+
+  dnl Headers used in cdatetimetools/cdatetime_tzdbcompile.c
+  AC_CHECK_HEADERS([dirent.h])
   ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,703 @@
+/*
+ * Compiles the TZif files of a zoneinfo directory into a timezone database
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include "cdatetimetools_libcdatetime.h"
+#include "cdatetimetools_libcerror.h"
+
+/* The default zoneinfo directory
+ */
+#define CDATETIME_TZDBCOMPILE_ZONEINFO_PATH	"/usr/share/zoneinfo"
+
+/* The default output file
+ */
+#define CDATETIME_TZDBCOMPILE_OUTPUT_FILENAME	"libcdatetime.tzdb"
+
+/* The maximum depth of the subdirectories of the zoneinfo directory
+ */
+#define CDATETIME_TZDBCOMPILE_MAXIMUM_DEPTH	8
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use cdatetime_tzdbcompile to compile the TZif files of a zoneinfo\n"
+	                 "directory into a timezone database.\n\n" );
+
+	fprintf( stream, "Usage: cdatetime_tzdbcompile [ -c name ] [ -o output ] [ -h ]\n"
+	                 "                             [ zoneinfo_directory ]\n\n" );
+
+	fprintf( stream, "\tzoneinfo_directory: the zoneinfo directory, the default is:\n"
+	                 "\t                    %s\n\n",
+	         CDATETIME_TZDBCOMPILE_ZONEINFO_PATH );
+
+	fprintf( stream, "\t-c:                 write C source that defines the timezone database\n"
+	                 "\t                    as an array with the name and its size as name_size\n" );
+	fprintf( stream, "\t-h:                 shows this help\n" );
+	fprintf( stream, "\t-o:                 the output file, the default is: %s\n",
+	         CDATETIME_TZDBCOMPILE_OUTPUT_FILENAME );
+}
+
+#if defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H )
+
+/* Appends the timezones of a directory to the timezone database
+ * Files that are not TZif files, such as zone.tab, are ignored
+ * The "right" directory is ignored since it contains timezones with leap seconds
+ * Returns 1 if successful or -1 on error
+ */
+int cdatetime_tzdbcompile_append_directory(
+     libcdatetime_timezone_database_t *database,
+     const char *path,
+     size_t path_length,
+     size_t name_offset,
+     int depth,
+     libcerror_error_t **error )
+{
+	struct stat file_stat;
+
+	libcdatetime_timezone_t *timezone = NULL;
+	struct dirent *directory_entry    = NULL;
+	DIR *directory                    = NULL;
+	char *entry_path                  = NULL;
+	static char *function             = "cdatetime_tzdbcompile_append_directory";
+	size_t entry_name_length          = 0;
+	size_t entry_path_size            = 0;
+	int result                        = 0;
+
+	if( depth > CDATETIME_TZDBCOMPILE_MAXIMUM_DEPTH )
+	{
+		return( 1 );
+	}
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open directory: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	while( ( directory_entry = readdir( directory ) ) != NULL )
+	{
+		if( directory_entry->d_name[ 0 ] == '.' )
+		{
+			continue;
+		}
+		if( ( depth == 0 )
+		 && ( narrow_string_compare(
+		       directory_entry->d_name,
+		       "right",
+		       6 ) == 0 ) )
+		{
+			continue;
+		}
+		entry_name_length = narrow_string_length(
+		                     directory_entry->d_name );
+
+		entry_path_size = path_length + 1 + entry_name_length + 1;
+
+		entry_path = narrow_string_allocate(
+		              entry_path_size );
+
+		if( entry_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry path.",
+			 function );
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     entry_path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy path to entry path.",
+			 function );
+
+			goto on_error;
+		}
+		entry_path[ path_length ] = '/';
+
+		if( narrow_string_copy(
+		     &( entry_path[ path_length + 1 ] ),
+		     directory_entry->d_name,
+		     entry_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name to entry path.",
+			 function );
+
+			goto on_error;
+		}
+		entry_path[ entry_path_size - 1 ] = 0;
+
+		/* Symbolic links to directories are ignored since they can refer
+		 * to the zoneinfo directory itself
+		 */
+		if( lstat(
+		     entry_path,
+		     &file_stat ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to determine type of: %s.",
+			 function,
+			 entry_path );
+
+			goto on_error;
+		}
+		if( S_ISDIR( file_stat.st_mode ) )
+		{
+			if( cdatetime_tzdbcompile_append_directory(
+			     database,
+			     entry_path,
+			     entry_path_size - 1,
+			     name_offset,
+			     depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory: %s.",
+				 function,
+				 entry_path );
+
+				goto on_error;
+			}
+		}
+		else if( S_ISREG( file_stat.st_mode )
+		      || ( S_ISLNK( file_stat.st_mode )
+		       && ( stat(
+		             entry_path,
+		             &file_stat ) == 0 )
+		       && S_ISREG( file_stat.st_mode ) ) )
+		{
+			if( libcdatetime_timezone_initialize(
+			     &timezone,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create timezone.",
+				 function );
+
+				goto on_error;
+			}
+			result = libcdatetime_timezone_read_file(
+			          timezone,
+			          entry_path,
+			          NULL );
+
+			if( result == 1 )
+			{
+				if( libcdatetime_timezone_database_append_timezone(
+				     database,
+				     &( entry_path[ name_offset ] ),
+				     entry_path_size - 1 - name_offset,
+				     timezone,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append timezone: %s.",
+					 function,
+					 &( entry_path[ name_offset ] ) );
+
+					goto on_error;
+				}
+			}
+			if( libcdatetime_timezone_free(
+			     &timezone,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free timezone.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 entry_path );
+
+		entry_path = NULL;
+	}
+	if( closedir(
+	     directory ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close directory: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+	closedir(
+	 directory );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H ) */
+
+/* Writes the timezone database data as C source
+ * Returns 1 if successful or -1 on error
+ */
+int cdatetime_tzdbcompile_write_source(
+     FILE *file_stream,
+     const char *name,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "cdatetime_tzdbcompile_write_source";
+	size_t data_offset    = 0;
+
+	if( fprintf(
+	     file_stream,
+	     "/* Timezone database generated by cdatetime_tzdbcompile\n"
+	     " * Read it with libcdatetime_timezone_database_read_data\n"
+	     " */\n\n"
+	     "#include <stddef.h>\n"
+	     "#include <stdint.h>\n\n"
+	     "const uint8_t %s[ %" PRIzu " ] = {",
+	     name,
+	     data_size ) < 0 )
+	{
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( fprintf(
+		     file_stream,
+		     "%s%s0x%02" PRIx8 "",
+		     ( data_offset == 0 ) ? "" : ",",
+		     ( ( data_offset % 12 ) == 0 ) ? "\n\t" : " ",
+		     data[ data_offset ] ) < 0 )
+		{
+			goto on_error;
+		}
+	}
+	if( fprintf(
+	     file_stream,
+	     " };\n\n"
+	     "const size_t %s_size = %" PRIzu ";\n\n",
+	     name,
+	     data_size ) < 0 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write source.",
+	 function );
+
+	return( -1 );
+}
+
+/* The main program
+ */
+int main( int argc, char * const argv[] )
+{
+	libcdatetime_timezone_database_t *database = NULL;
+	libcerror_error_t *error                   = NULL;
+	FILE *file_stream                          = NULL;
+	uint8_t *data                              = NULL;
+	const char *output_filename                = CDATETIME_TZDBCOMPILE_OUTPUT_FILENAME;
+	const char *source_name                    = NULL;
+	const char *zoneinfo_path                  = CDATETIME_TZDBCOMPILE_ZONEINFO_PATH;
+	size_t data_size                           = 0;
+	size_t name_index                          = 0;
+	size_t zoneinfo_path_length                = 0;
+	int argument_index                         = 0;
+	int number_of_timezones                    = 0;
+
+	for( argument_index = 1;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( ( narrow_string_compare(
+		       argv[ argument_index ],
+		       "-c",
+		       3 ) == 0 )
+		 && ( ( argument_index + 1 ) < argc ) )
+		{
+			source_name = argv[ ++argument_index ];
+		}
+		else if( ( narrow_string_compare(
+		            argv[ argument_index ],
+		            "-o",
+		            3 ) == 0 )
+		      && ( ( argument_index + 1 ) < argc ) )
+		{
+			output_filename = argv[ ++argument_index ];
+		}
+		else if( narrow_string_compare(
+		          argv[ argument_index ],
+		          "-h",
+		          3 ) == 0 )
+		{
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		else if( ( argv[ argument_index ][ 0 ] != '-' )
+		      && ( ( argument_index + 1 ) == argc ) )
+		{
+			zoneinfo_path = argv[ argument_index ];
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Invalid argument: %s.\n",
+			 argv[ argument_index ] );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( source_name != NULL )
+	{
+		/* The name must be a valid C identifier
+		 */
+		for( name_index = 0;
+		     source_name[ name_index ] != 0;
+		     name_index++ )
+		{
+			if( ( ( source_name[ name_index ] < 'a' )
+			  || ( source_name[ name_index ] > 'z' ) )
+			 && ( ( source_name[ name_index ] < 'A' )
+			  || ( source_name[ name_index ] > 'Z' ) )
+			 && ( ( source_name[ name_index ] < '0' )
+			  || ( source_name[ name_index ] > '9' )
+			  || ( name_index == 0 ) )
+			 && ( source_name[ name_index ] != '_' ) )
+			{
+				break;
+			}
+		}
+		if( ( name_index == 0 )
+		 || ( source_name[ name_index ] != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported name: %s.\n",
+			 source_name );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( libcdatetime_timezone_database_initialize(
+	     &database,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create timezone database.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H )
+	zoneinfo_path_length = narrow_string_length(
+	                        zoneinfo_path );
+
+	while( ( zoneinfo_path_length > 1 )
+	    && ( zoneinfo_path[ zoneinfo_path_length - 1 ] == '/' ) )
+	{
+		zoneinfo_path_length--;
+	}
+	if( cdatetime_tzdbcompile_append_directory(
+	     database,
+	     zoneinfo_path,
+	     zoneinfo_path_length,
+	     zoneinfo_path_length + 1,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to append timezones of directory: %s.\n",
+		 zoneinfo_path );
+
+		goto on_error;
+	}
+#else
+	fprintf(
+	 stderr,
+	 "Unable to append timezones of directory: %s - missing directory support.\n",
+	 zoneinfo_path );
+
+	goto on_error;
+#endif
+	if( libcdatetime_timezone_database_get_number_of_timezones(
+	     database,
+	     &number_of_timezones,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve number of timezones.\n" );
+
+		goto on_error;
+	}
+	if( number_of_timezones == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "No timezones found in directory: %s.\n",
+		 zoneinfo_path );
+
+		goto on_error;
+	}
+	if( libcdatetime_timezone_database_get_data_size(
+	     database,
+	     &data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve data size.\n" );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create data.\n" );
+
+		goto on_error;
+	}
+	if( libcdatetime_timezone_database_write_data(
+	     database,
+	     data,
+	     data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write timezone database data.\n" );
+
+		goto on_error;
+	}
+	if( source_name != NULL )
+	{
+		file_stream = file_stream_open(
+		               output_filename,
+		               FILE_STREAM_OPEN_WRITE );
+	}
+	else
+	{
+		file_stream = file_stream_open(
+		               output_filename,
+		               FILE_STREAM_BINARY_OPEN_WRITE );
+	}
+	if( file_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open output file: %s.\n",
+		 output_filename );
+
+		goto on_error;
+	}
+	if( source_name != NULL )
+	{
+		if( cdatetime_tzdbcompile_write_source(
+		     file_stream,
+		     source_name,
+		     data,
+		     data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write output file: %s.\n",
+			 output_filename );
+
+			goto on_error;
+		}
+	}
+	else if( file_stream_write(
+	          file_stream,
+	          data,
+	          data_size ) != data_size )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write output file: %s.\n",
+		 output_filename );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close output file: %s.\n",
+		 output_filename );
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	if( libcdatetime_timezone_database_free(
+	     &database,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free timezone database.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Compiled %d timezones into %" PRIzu " bytes.\n",
+	 number_of_timezones,
+	 data_size );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,124 @@
+/*
+ * Atomic operations
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_ATOMIC_H )
+#define _LIBCDATETIME_ATOMIC_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The GCC __atomic built-in functions are available in GCC 4.7 or later
+ * and in clang
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+
+#define libcdatetime_atomic_load_uint32( pointer ) \
+	__atomic_load_n( pointer, __ATOMIC_ACQUIRE )
+
+#define libcdatetime_atomic_store_uint32( pointer, value ) \
+	__atomic_store_n( pointer, value, __ATOMIC_RELEASE )
+
+/* Returns non-zero if the value was swapped
+ */
+#define libcdatetime_atomic_compare_and_swap_uint32( pointer, expected_value, new_value ) \
+	__sync_bool_compare_and_swap( pointer, expected_value, new_value )
+
+/* The increment and decrement imply a full memory barrier
+ */
+#define libcdatetime_atomic_increment_uint32( pointer ) \
+	__atomic_add_fetch( pointer, 1, __ATOMIC_SEQ_CST )
+
+#define libcdatetime_atomic_decrement_uint32( pointer ) \
+	__atomic_sub_fetch( pointer, 1, __ATOMIC_SEQ_CST )
+
+#define libcdatetime_atomic_load_int64( pointer ) \
+	__atomic_load_n( pointer, __ATOMIC_ACQUIRE )
+
+/* Returns non-zero if the value was swapped
+ */
+#define libcdatetime_atomic_compare_and_swap_int64( pointer, expected_value, new_value ) \
+	__sync_bool_compare_and_swap( pointer, expected_value, new_value )
+
+#define libcdatetime_atomic_load_pointer( pointer ) \
+	__atomic_load_n( pointer, __ATOMIC_ACQUIRE )
+
+#define libcdatetime_atomic_store_pointer( pointer, value ) \
+	__atomic_store_n( pointer, value, __ATOMIC_RELEASE )
+
+#define libcdatetime_atomic_thread_fence() \
+	__atomic_thread_fence( __ATOMIC_SEQ_CST )
+
+#elif defined( _MSC_VER )
+
+/* The Interlocked functions imply a full memory barrier
+ */
+#define libcdatetime_atomic_load_uint32( pointer ) \
+	(uint32_t) InterlockedCompareExchange( (LONG volatile *) ( pointer ), 0, 0 )
+
+#define libcdatetime_atomic_store_uint32( pointer, value ) \
+	InterlockedExchange( (LONG volatile *) ( pointer ), (LONG) ( value ) )
+
+/* Returns non-zero if the value was swapped
+ */
+#define libcdatetime_atomic_compare_and_swap_uint32( pointer, expected_value, new_value ) \
+	( InterlockedCompareExchange( (LONG volatile *) ( pointer ), (LONG) ( new_value ), (LONG) ( expected_value ) ) == (LONG) ( expected_value ) )
+
+#define libcdatetime_atomic_increment_uint32( pointer ) \
+	(uint32_t) InterlockedIncrement( (LONG volatile *) ( pointer ) )
+
+#define libcdatetime_atomic_decrement_uint32( pointer ) \
+	(uint32_t) InterlockedDecrement( (LONG volatile *) ( pointer ) )
+
+#define libcdatetime_atomic_load_int64( pointer ) \
+	(int64_t) InterlockedCompareExchange64( (LONGLONG volatile *) ( pointer ), 0, 0 )
+
+/* Returns non-zero if the value was swapped
+ */
+#define libcdatetime_atomic_compare_and_swap_int64( pointer, expected_value, new_value ) \
+	( InterlockedCompareExchange64( (LONGLONG volatile *) ( pointer ), (LONGLONG) ( new_value ), (LONGLONG) ( expected_value ) ) == (LONGLONG) ( expected_value ) )
+
+#define libcdatetime_atomic_load_pointer( pointer ) \
+	InterlockedCompareExchangePointer( (PVOID volatile *) ( pointer ), NULL, NULL )
+
+#define libcdatetime_atomic_store_pointer( pointer, value ) \
+	InterlockedExchangePointer( (PVOID volatile *) ( pointer ), (PVOID) ( value ) )
+
+#define libcdatetime_atomic_thread_fence() \
+	MemoryBarrier()
+
+#else
+/* The ticker, the generators, the rule year cache and the system timezone
+ * rely on these operations to be atomic, hence they cannot be emulated
+ */
+#error Missing atomic operations, GCC 4.7 or later, clang or Visual Studio is required
+
+#endif
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_ATOMIC_H ) */
+
@@ -0,0 +1,589 @@
+/*
+ * Clock functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+#endif /* !defined( WINAPI ) */
+
+#include <errno.h>
+
+#include "libcdatetime_clock.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_tsc.h"
+
+#if !defined( WINAPI ) && defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_TAI )
+#define LIBCDATETIME_HAVE_CLOCK_TAI	1
+#endif
+
+/* The clock settings used by objects that use the default clock source
+ */
+static libcdatetime_clock_settings_t libcdatetime_process_clock_settings = {
+	LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	NULL,
+	NULL };
+
+/* Sets the clock source
+ * Setting the clock source to LIBCDATETIME_CLOCK_SOURCE_DEFAULT makes the clock
+ * settings follow the clock source set for the process
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_clock_settings_set_clock_source(
+     libcdatetime_clock_settings_t *clock_settings,
+     int clock_source,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_clock_settings_set_clock_source";
+
+	if( clock_settings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock settings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( clock_source != LIBCDATETIME_CLOCK_SOURCE_DEFAULT )
+	 && ( clock_source != LIBCDATETIME_CLOCK_SOURCE_REALTIME )
+	 && ( clock_source != LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE )
+	 && ( clock_source != LIBCDATETIME_CLOCK_SOURCE_TSC )
+#if defined( LIBCDATETIME_HAVE_CLOCK_TAI )
+	 && ( clock_source != LIBCDATETIME_CLOCK_SOURCE_TAI )
+#endif
+	 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported clock source: %d.",
+		 function,
+		 clock_source );
+
+		return( -1 );
+	}
+	clock_settings->clock_source      = clock_source;
+	clock_settings->callback_function = NULL;
+	clock_settings->callback_data     = NULL;
+
+	return( 1 );
+}
+
+/* Sets a callback function as the clock source
+ * The callback function should retrieve the current time as the number
+ * of nano seconds since January 1, 1970 00:00:00 UTC and return 1 if
+ * successful or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_clock_settings_set_clock_callback(
+     libcdatetime_clock_settings_t *clock_settings,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_clock_settings_set_clock_callback";
+
+	if( clock_settings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock settings.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	clock_settings->clock_source      = LIBCDATETIME_CLOCK_SOURCE_CALLBACK;
+	clock_settings->callback_function = callback_function;
+	clock_settings->callback_data     = callback_data;
+
+	return( 1 );
+}
+
+/* Retrieves the current time from the clock source
+ * The current time is returned as the number of nano seconds since
+ * January 1, 1970 00:00:00 UTC, or TAI for the TAI clock source
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_clock_settings_get_current_time(
+     const libcdatetime_clock_settings_t *clock_settings,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	FILETIME filetime;
+
+	uint64_t filetime_value    = 0;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_specification;
+
+	clockid_t clock_identifier = CLOCK_REALTIME;
+
+#else
+	time_t posix_time          = 0;
+#endif
+
+	static char *function      = "libcdatetime_clock_settings_get_current_time";
+	int64_t number_of_seconds  = 0;
+	uint32_t nano_seconds      = 0;
+	int result                 = 0;
+
+	if( clock_settings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid clock settings.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( clock_settings->clock_source == LIBCDATETIME_CLOCK_SOURCE_DEFAULT )
+	{
+		clock_settings = &libcdatetime_process_clock_settings;
+	}
+	switch( clock_settings->clock_source )
+	{
+		case LIBCDATETIME_CLOCK_SOURCE_CALLBACK:
+			if( clock_settings->callback_function == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid clock settings - missing callback function.",
+				 function );
+
+				return( -1 );
+			}
+			if( clock_settings->callback_function(
+			     clock_settings->callback_data,
+			     posix_time_in_nano_seconds,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current time from callback function.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+
+		case LIBCDATETIME_CLOCK_SOURCE_REALTIME:
+		case LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE:
+			break;
+
+		case LIBCDATETIME_CLOCK_SOURCE_TSC:
+			result = libcdatetime_tsc_get_current_time(
+			          posix_time_in_nano_seconds,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current time from time stamp counter.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				return( 1 );
+			}
+			/* Fall back to the real-time clock if no invariant time stamp counter is available
+			 */
+			break;
+
+#if defined( LIBCDATETIME_HAVE_CLOCK_TAI )
+		case LIBCDATETIME_CLOCK_SOURCE_TAI:
+			clock_identifier = CLOCK_TAI;
+			break;
+#endif
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported clock source: %d.",
+			 function,
+			 clock_settings->clock_source );
+
+			return( -1 );
+	}
+#if defined( WINAPI )
+	/* GetSystemTimeAsFileTime is also the coarse real-time clock on Windows
+	 */
+	GetSystemTimeAsFileTime(
+	 &filetime );
+
+	filetime_value = ( (uint64_t) filetime.dwHighDateTime << 32 ) | filetime.dwLowDateTime;
+
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC
+	 * and the FILETIME is in intervals of 100 nano seconds
+	 */
+	if( filetime_value < 116444736000000000ULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filetime value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	filetime_value -= 116444736000000000ULL;
+
+	number_of_seconds = (int64_t) ( filetime_value / 10000000 );
+	nano_seconds      = (uint32_t) ( filetime_value % 10000000 ) * 100;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+#if defined( CLOCK_REALTIME_COARSE )
+	if( clock_settings->clock_source == LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE )
+	{
+		clock_identifier = CLOCK_REALTIME_COARSE;
+	}
+#endif
+	if( clock_gettime(
+	     clock_identifier,
+	     &time_specification ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = (int64_t) time_specification.tv_sec;
+	nano_seconds      = (uint32_t) time_specification.tv_nsec;
+
+#else
+	if( time(
+	     &posix_time ) == (time_t) -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = (int64_t) posix_time;
+
+#endif /* defined( WINAPI ) */
+
+	/* A 64-bit number of nano seconds can represent a date and time
+	 * from 1677-09-21 up to 2262-04-11
+	 */
+	if( ( number_of_seconds < -9223372036LL )
+	 || ( number_of_seconds > 9223372035LL )
+	 || ( nano_seconds > 999999999UL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = ( number_of_seconds * 1000000000LL ) + (int64_t) nano_seconds;
+
+	return( 1 );
+}
+
+/* Retrieves the current time of a monotonic clock
+ * The current time is returned as a number of nano seconds since
+ * an unspecified starting point, which does not change while the
+ * system is running
+ * On Windows both clock sources use the performance counter
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_clock_get_monotonic_time(
+     int clock_source,
+     int64_t *nano_seconds,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	DWORD error_code           = 0;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_specification;
+
+	clockid_t clock_identifier = CLOCK_MONOTONIC;
+#endif
+
+	static char *function      = "libcdatetime_clock_get_monotonic_time";
+	int64_t number_of_seconds  = 0;
+	int64_t fraction           = 0;
+
+	if( nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( clock_source != LIBCDATETIME_CLOCK_SOURCE_MONOTONIC )
+	 && ( clock_source != LIBCDATETIME_CLOCK_SOURCE_BOOTTIME ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported clock source: %d.",
+		 function,
+		 clock_source );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( QueryPerformanceFrequency(
+	     &frequency ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve performance counter frequency.",
+		 function );
+
+		return( -1 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( frequency.QuadPart <= 0 )
+	 || ( counter.QuadPart < 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid performance counter value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The counter is split into seconds and a remainder to prevent
+	 * the multiplication from overflowing
+	 */
+	number_of_seconds = (int64_t) ( counter.QuadPart / frequency.QuadPart );
+	fraction          = (int64_t) ( ( ( counter.QuadPart % frequency.QuadPart ) * 1000000000LL ) / frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+#if defined( CLOCK_BOOTTIME )
+	if( clock_source == LIBCDATETIME_CLOCK_SOURCE_BOOTTIME )
+	{
+		clock_identifier = CLOCK_BOOTTIME;
+	}
+#endif
+	if( clock_gettime(
+	     clock_identifier,
+	     &time_specification ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve monotonic time.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = (int64_t) time_specification.tv_sec;
+	fraction          = (int64_t) time_specification.tv_nsec;
+
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: monotonic clock not supported.",
+	 function );
+
+	return( -1 );
+
+#endif /* defined( WINAPI ) */
+
+#if defined( WINAPI ) || defined( HAVE_CLOCK_GETTIME )
+	if( ( number_of_seconds < 0 )
+	 || ( number_of_seconds > 9223372035LL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid monotonic time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*nano_seconds = ( number_of_seconds * 1000000000LL ) + fraction;
+
+	return( 1 );
+#endif
+}
+
+/* Sets the clock source of the process
+ * The clock source is used by timestamps and elements that use
+ * the default clock source. This function is not thread-safe and
+ * should be called before the current time is retrieved by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_set_clock_source(
+     int clock_source,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_set_clock_source";
+
+	if( clock_source == LIBCDATETIME_CLOCK_SOURCE_DEFAULT )
+	{
+		clock_source = LIBCDATETIME_CLOCK_SOURCE_REALTIME;
+	}
+	if( libcdatetime_clock_settings_set_clock_source(
+	     &libcdatetime_process_clock_settings,
+	     clock_source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a callback function as the clock source of the process
+ * The callback function should retrieve the current time as the number
+ * of nano seconds since January 1, 1970 00:00:00 UTC and return 1 if
+ * successful or -1 on error. This function is not thread-safe and
+ * should be called before the current time is retrieved by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_set_clock_callback(
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_set_clock_callback";
+
+	if( libcdatetime_clock_settings_set_clock_callback(
+	     &libcdatetime_process_clock_settings,
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock callback.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
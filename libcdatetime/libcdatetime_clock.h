@@ -0,0 +1,99 @@
+/*
+ * Clock functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_CLOCK_H )
+#define _LIBCDATETIME_CLOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcdatetime_clock_settings libcdatetime_clock_settings_t;
+
+struct libcdatetime_clock_settings
+{
+	/* The clock source
+	 */
+	int clock_source;
+
+	/* The callback function that retrieves the current time
+	 * as the number of nano seconds since January 1, 1970 00:00:00 UTC
+	 */
+	int (*callback_function)(
+	       intptr_t *callback_data,
+	       int64_t *posix_time_in_nano_seconds,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	intptr_t *callback_data;
+};
+
+int libcdatetime_clock_settings_set_clock_source(
+     libcdatetime_clock_settings_t *clock_settings,
+     int clock_source,
+     libcerror_error_t **error );
+
+int libcdatetime_clock_settings_set_clock_callback(
+     libcdatetime_clock_settings_t *clock_settings,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+int libcdatetime_clock_settings_get_current_time(
+     const libcdatetime_clock_settings_t *clock_settings,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+int libcdatetime_clock_get_monotonic_time(
+     int clock_source,
+     int64_t *nano_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_set_clock_source(
+     int clock_source,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_set_clock_callback(
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_CLOCK_H ) */
+
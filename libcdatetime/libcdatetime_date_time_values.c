@@ -0,0 +1,1690 @@
+/*
+ * Date and time values functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libcdatetime_date_time_values.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_support.h"
+
+/* The abbreviated month names as used by the C time string format
+ */
+static const char *libcdatetime_date_time_values_month_names[ 12 ] = {
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+	"Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+/* The abbreviated day of week names as used by the C time and RFC 2822 string formats
+ */
+static const char *libcdatetime_date_time_values_day_of_week_names[ 7 ] = {
+	"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+
+/* The timezone names as used by the RFC 2822 string format
+ */
+static const char *libcdatetime_date_time_values_rfc2822_timezone_names[ 12 ] = {
+	"GMT", "UTC", "UT", "Z", "EST", "EDT", "CST", "CDT", "MST", "MDT", "PST", "PDT" };
+
+/* The offsets of the timezones as used by the RFC 2822 string format in minutes
+ */
+static const int16_t libcdatetime_date_time_values_rfc2822_timezone_offsets[ 12 ] = {
+	0, 0, 0, 0, -300, -240, -360, -300, -420, -360, -480, -420 };
+
+/* Copies a fixed number of decimal digits from a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_digits_from_string(
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            uint8_t number_of_digits,
+            uint32_t *value )
+{
+	size_t safe_string_index = 0;
+	uint32_t safe_value      = 0;
+	uint8_t digit_index      = 0;
+
+	safe_string_index = *string_index;
+
+	for( digit_index = 0;
+	     digit_index < number_of_digits;
+	     digit_index++ )
+	{
+		if( safe_string_index >= string->size )
+		{
+			*string_index = safe_string_index;
+
+			return( 0 );
+		}
+		if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) < (uint8_t) '0' )
+		 || ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) > (uint8_t) '9' ) )
+		{
+			*string_index = safe_string_index;
+
+			return( -1 );
+		}
+		safe_value *= 10;
+		safe_value += libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) - (uint8_t) '0';
+
+		safe_string_index++;
+	}
+	*string_index = safe_string_index;
+	*value        = safe_value;
+
+	return( 1 );
+}
+
+/* Matches a literal in a string
+ * Returns 1 if the literal matches, 0 if the string is too small or -1 if the literal does not match
+ */
+static int libcdatetime_date_time_values_match_literal_in_string(
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            const char *literal,
+            size_t literal_length )
+{
+	size_t literal_index     = 0;
+	size_t safe_string_index = 0;
+
+	safe_string_index = *string_index;
+
+	for( literal_index = 0;
+	     literal_index < literal_length;
+	     literal_index++ )
+	{
+		if( safe_string_index >= string->size )
+		{
+			return( 0 );
+		}
+		if( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) != (uint8_t) literal[ literal_index ] )
+		{
+			return( -1 );
+		}
+		safe_string_index++;
+	}
+	*string_index = safe_string_index;
+
+	return( 1 );
+}
+
+/* Copies an abbreviated month name from a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_month_name_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index )
+{
+	uint8_t month = 0;
+	int result    = 0;
+
+	for( month = 0;
+	     month < 12;
+	     month++ )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          string_index,
+		          libcdatetime_date_time_values_month_names[ month ],
+		          3 );
+
+		if( result != -1 )
+		{
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		date_time_values->month = month + 1;
+	}
+	return( result );
+}
+
+/* Matches an abbreviated day of week name in a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_match_day_of_week_name_in_string(
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index )
+{
+	uint8_t day_of_week = 0;
+	int result          = 0;
+
+	for( day_of_week = 0;
+	     day_of_week < 7;
+	     day_of_week++ )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          string_index,
+		          libcdatetime_date_time_values_day_of_week_names[ day_of_week ],
+		          3 );
+
+		if( result != -1 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Copies a day of month in the format: dd, where a single digit day is space or zero padded
+ * If the day does not need to be padded a single digit is allowed
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_day_of_month_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            uint8_t allow_unpadded )
+{
+	size_t safe_string_index = 0;
+	uint32_t value           = 0;
+	int result               = 0;
+
+	safe_string_index = *string_index;
+
+	if( safe_string_index >= string->size )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) ' ' )
+	{
+		safe_string_index++;
+
+		result = libcdatetime_date_time_values_copy_digits_from_string(
+		          string,
+		          &safe_string_index,
+		          1,
+		          &value );
+	}
+	else
+	{
+		result = libcdatetime_date_time_values_copy_digits_from_string(
+		          string,
+		          &safe_string_index,
+		          1,
+		          &value );
+
+		if( result == 1 )
+		{
+			if( safe_string_index >= string->size )
+			{
+				result = 0;
+			}
+			else if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) >= (uint8_t) '0' )
+			      && ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) <= (uint8_t) '9' ) )
+			{
+				value *= 10;
+				value += libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) - (uint8_t) '0';
+
+				safe_string_index++;
+			}
+			else if( allow_unpadded == 0 )
+			{
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		date_time_values->day_of_month = (uint8_t) value;
+	}
+	*string_index = safe_string_index;
+
+	return( result );
+}
+
+/* Copies a date in the format: yyyy-mm-dd from a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_iso8601_date_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index )
+{
+	uint32_t value = 0;
+	int result     = 0;
+
+	result = libcdatetime_date_time_values_copy_digits_from_string(
+	          string,
+	          string_index,
+	          4,
+	          &value );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	date_time_values->year = (uint16_t) value;
+
+	result = libcdatetime_date_time_values_match_literal_in_string(
+	          string,
+	          string_index,
+	          "-",
+	          1 );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = libcdatetime_date_time_values_copy_digits_from_string(
+	          string,
+	          string_index,
+	          2,
+	          &value );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	date_time_values->month = (uint8_t) value;
+
+	result = libcdatetime_date_time_values_match_literal_in_string(
+	          string,
+	          string_index,
+	          "-",
+	          1 );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = libcdatetime_date_time_values_copy_digits_from_string(
+	          string,
+	          string_index,
+	          2,
+	          &value );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	date_time_values->day_of_month = (uint8_t) value;
+
+	return( 1 );
+}
+
+/* Copies a date in the format: mmm dd, yyyy from a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_ctime_date_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index )
+{
+	uint32_t value = 0;
+	int result     = 0;
+
+	result = libcdatetime_date_time_values_copy_month_name_from_string(
+	          date_time_values,
+	          string,
+	          string_index );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = libcdatetime_date_time_values_match_literal_in_string(
+	          string,
+	          string_index,
+	          " ",
+	          1 );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = libcdatetime_date_time_values_copy_digits_from_string(
+	          string,
+	          string_index,
+	          2,
+	          &value );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	date_time_values->day_of_month = (uint8_t) value;
+
+	result = libcdatetime_date_time_values_match_literal_in_string(
+	          string,
+	          string_index,
+	          ", ",
+	          2 );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = libcdatetime_date_time_values_copy_digits_from_string(
+	          string,
+	          string_index,
+	          4,
+	          &value );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	date_time_values->year = (uint16_t) value;
+
+	return( 1 );
+}
+
+/* Copies an optional fraction of a second in the format: .######### from a string
+ * Both a period and a comma are supported as decimal separator
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_fraction_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            uint8_t parse_flags )
+{
+	size_t safe_string_index = 0;
+	uint32_t fraction_scale  = 0;
+
+	safe_string_index = *string_index;
+
+	if( safe_string_index >= string->size )
+	{
+		if( ( parse_flags & LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) != (uint8_t) '.' )
+	 && ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) != (uint8_t) ',' ) )
+	{
+		return( 1 );
+	}
+	safe_string_index++;
+
+	if( safe_string_index >= string->size )
+	{
+		if( ( parse_flags & LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) < (uint8_t) '0' )
+	 || ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) > (uint8_t) '9' ) )
+	{
+		return( 1 );
+	}
+	/* Digits beyond nano seconds precision are ignored
+	 */
+	fraction_scale = 100000000UL;
+
+	while( safe_string_index < string->size )
+	{
+		if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) < (uint8_t) '0' )
+		 || ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) > (uint8_t) '9' ) )
+		{
+			break;
+		}
+		date_time_values->nano_seconds += ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) - (uint8_t) '0' ) * fraction_scale;
+
+		safe_string_index++;
+
+		fraction_scale /= 10;
+	}
+	*string_index = safe_string_index;
+
+	if( ( safe_string_index >= string->size )
+	 && ( ( parse_flags & LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING ) != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Copies a time in the format: hh:mm:ss[.#########] from a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_time_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            uint8_t parse_flags )
+{
+	uint32_t value = 0;
+	int result     = 0;
+
+	result = libcdatetime_date_time_values_copy_digits_from_string(
+	          string,
+	          string_index,
+	          2,
+	          &value );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	date_time_values->hours = (uint8_t) value;
+
+	result = libcdatetime_date_time_values_match_literal_in_string(
+	          string,
+	          string_index,
+	          ":",
+	          1 );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = libcdatetime_date_time_values_copy_digits_from_string(
+	          string,
+	          string_index,
+	          2,
+	          &value );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	date_time_values->minutes = (uint8_t) value;
+
+	result = libcdatetime_date_time_values_match_literal_in_string(
+	          string,
+	          string_index,
+	          ":",
+	          1 );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	result = libcdatetime_date_time_values_copy_digits_from_string(
+	          string,
+	          string_index,
+	          2,
+	          &value );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	date_time_values->seconds = (uint8_t) value;
+
+	/* The fraction of a second is optional
+	 */
+	return( libcdatetime_date_time_values_copy_fraction_from_string(
+	         date_time_values,
+	         string,
+	         string_index,
+	         parse_flags ) );
+}
+
+/* Copies a timezone indicator from a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_timezone_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            uint32_t string_format_type,
+            uint8_t parse_flags )
+{
+	size_t safe_string_index = 0;
+	uint32_t hours           = 0;
+	uint32_t minutes         = 0;
+	int16_t sign             = 1;
+	int result               = 0;
+
+	/* The timezone indicator is optional, hence a mismatch
+	 * indicates the end of the date and time value
+	 */
+	safe_string_index = *string_index;
+
+	if( safe_string_index >= string->size )
+	{
+		if( ( parse_flags & LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_CTIME )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          &safe_string_index,
+		          " UTC",
+		          4 );
+	}
+	else if( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) 'Z' )
+	{
+		safe_string_index++;
+
+		result = 1;
+	}
+	else if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) '+' )
+	      || ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) '-' ) )
+	{
+		if( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) '-' )
+		{
+			sign = -1;
+		}
+		safe_string_index++;
+
+		result = libcdatetime_date_time_values_copy_digits_from_string(
+		          string,
+		          &safe_string_index,
+		          2,
+		          &hours );
+
+		/* The minutes are optional, hence the timezone indicator can
+		 * be in the format: ±hh, ±hh:mm or ±hhmm
+		 */
+		if( result == 1 )
+		{
+			if( safe_string_index >= string->size )
+			{
+				/* A partial string could continue with the minutes
+				 */
+				if( ( parse_flags & LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING ) != 0 )
+				{
+					result = 0;
+				}
+			}
+			else if( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) ':' )
+			{
+				safe_string_index++;
+
+				result = libcdatetime_date_time_values_copy_digits_from_string(
+				          string,
+				          &safe_string_index,
+				          2,
+				          &minutes );
+			}
+			else if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) >= (uint8_t) '0' )
+			      && ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) <= (uint8_t) '9' ) )
+			{
+				result = libcdatetime_date_time_values_copy_digits_from_string(
+				          string,
+				          &safe_string_index,
+				          2,
+				          &minutes );
+			}
+		}
+		if( ( result == 1 )
+		 && ( ( hours > 23 )
+		  ||  ( minutes > 59 ) ) )
+		{
+			result = -1;
+		}
+	}
+	else
+	{
+		result = -1;
+	}
+	if( result == 0 )
+	{
+		if( ( parse_flags & LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	else if( result == -1 )
+	{
+		return( 1 );
+	}
+	date_time_values->timezone_offset = sign * (int16_t) ( ( hours * 60 ) + minutes );
+
+	*string_index = safe_string_index;
+
+	return( 1 );
+}
+
+/* Copies a date and time in the format: www mmm dd hh:mm:ss yyyy from a string
+ * This is the format used by the C asctime and ctime functions
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_asctime_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index )
+{
+	uint32_t value = 0;
+	int result     = 0;
+
+	result = libcdatetime_date_time_values_match_day_of_week_name_in_string(
+	          string,
+	          string_index );
+
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_month_name_from_string(
+		          date_time_values,
+		          string,
+		          string_index );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_day_of_month_from_string(
+		          date_time_values,
+		          string,
+		          string_index,
+		          0 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		/* The year is mandatory and follows the time, hence the end of
+		 * the string is not the end of the date and time value
+		 */
+		result = libcdatetime_date_time_values_copy_time_from_string(
+		          date_time_values,
+		          string,
+		          string_index,
+		          LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_digits_from_string(
+		          string,
+		          string_index,
+		          4,
+		          &value );
+	}
+	if( result == 1 )
+	{
+		date_time_values->year = (uint16_t) value;
+	}
+	return( result );
+}
+
+/* Copies a date and time in the format: [www, ]d[d] mmm yyyy hh:mm[:ss] zone from a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_rfc2822_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            uint8_t parse_flags )
+{
+	size_t safe_string_index = 0;
+	uint32_t hours           = 0;
+	uint32_t minutes         = 0;
+	uint32_t value           = 0;
+	uint8_t zone_index       = 0;
+	int16_t sign             = 1;
+	int result               = 0;
+
+	safe_string_index = *string_index;
+
+	if( safe_string_index >= string->size )
+	{
+		return( 0 );
+	}
+	/* The day of week is optional
+	 */
+	if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) < (uint8_t) '0' )
+	 || ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) > (uint8_t) '9' ) )
+	{
+		result = libcdatetime_date_time_values_match_day_of_week_name_in_string(
+		          string,
+		          &safe_string_index );
+
+		if( result == 1 )
+		{
+			result = libcdatetime_date_time_values_match_literal_in_string(
+			          string,
+			          &safe_string_index,
+			          ", ",
+			          2 );
+		}
+		if( result != 1 )
+		{
+			*string_index = safe_string_index;
+
+			return( result );
+		}
+	}
+	result = libcdatetime_date_time_values_copy_day_of_month_from_string(
+	          date_time_values,
+	          string,
+	          &safe_string_index,
+	          1 );
+
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          &safe_string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_month_name_from_string(
+		          date_time_values,
+		          string,
+		          &safe_string_index );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          &safe_string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_digits_from_string(
+		          string,
+		          &safe_string_index,
+		          4,
+		          &value );
+	}
+	if( result == 1 )
+	{
+		date_time_values->year = (uint16_t) value;
+
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          &safe_string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_digits_from_string(
+		          string,
+		          &safe_string_index,
+		          2,
+		          &value );
+	}
+	if( result == 1 )
+	{
+		date_time_values->hours = (uint8_t) value;
+
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          &safe_string_index,
+		          ":",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_digits_from_string(
+		          string,
+		          &safe_string_index,
+		          2,
+		          &value );
+	}
+	if( result == 1 )
+	{
+		date_time_values->minutes = (uint8_t) value;
+
+		/* The seconds are optional
+		 */
+		if( safe_string_index >= string->size )
+		{
+			result = 0;
+		}
+		else if( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) ':' )
+		{
+			safe_string_index++;
+
+			result = libcdatetime_date_time_values_copy_digits_from_string(
+			          string,
+			          &safe_string_index,
+			          2,
+			          &value );
+
+			if( result == 1 )
+			{
+				date_time_values->seconds = (uint8_t) value;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          &safe_string_index,
+		          " ",
+		          1 );
+	}
+	if( result != 1 )
+	{
+		*string_index = safe_string_index;
+
+		return( result );
+	}
+	if( safe_string_index >= string->size )
+	{
+		*string_index = safe_string_index;
+
+		return( 0 );
+	}
+	if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) '+' )
+	 || ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) '-' ) )
+	{
+		if( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) '-' )
+		{
+			sign = -1;
+		}
+		safe_string_index++;
+
+		result = libcdatetime_date_time_values_copy_digits_from_string(
+		          string,
+		          &safe_string_index,
+		          2,
+		          &hours );
+
+		if( result == 1 )
+		{
+			result = libcdatetime_date_time_values_copy_digits_from_string(
+			          string,
+			          &safe_string_index,
+			          2,
+			          &minutes );
+		}
+		if( ( result == 1 )
+		 && ( ( hours > 23 )
+		  ||  ( minutes > 59 ) ) )
+		{
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			date_time_values->timezone_offset = sign * (int16_t) ( ( hours * 60 ) + minutes );
+		}
+	}
+	else
+	{
+		for( zone_index = 0;
+		     zone_index < 12;
+		     zone_index++ )
+		{
+			result = libcdatetime_date_time_values_match_literal_in_string(
+			          string,
+			          &safe_string_index,
+			          libcdatetime_date_time_values_rfc2822_timezone_names[ zone_index ],
+			          narrow_string_length(
+			           libcdatetime_date_time_values_rfc2822_timezone_names[ zone_index ] ) );
+
+			/* A truncated name is ambiguous if more data can follow, e.g. UT and UTC
+			 */
+			if( ( result == 1 )
+			 || ( ( result == 0 )
+			  &&  ( ( parse_flags & LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING ) != 0 ) ) )
+			{
+				break;
+			}
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			date_time_values->timezone_offset = libcdatetime_date_time_values_rfc2822_timezone_offsets[ zone_index ];
+		}
+	}
+	*string_index = safe_string_index;
+
+	return( result );
+}
+
+/* Copies a date and time in the format: mmm dd hh:mm:ss[.#########] from a string
+ * This is the format used by BSD syslog (RFC 3164), which does not contain a year
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_syslog_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            uint8_t parse_flags )
+{
+	int result = 0;
+
+	result = libcdatetime_date_time_values_copy_month_name_from_string(
+	          date_time_values,
+	          string,
+	          string_index );
+
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_day_of_month_from_string(
+		          date_time_values,
+		          string,
+		          string_index,
+		          0 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_match_literal_in_string(
+		          string,
+		          string_index,
+		          " ",
+		          1 );
+	}
+	if( result == 1 )
+	{
+		result = libcdatetime_date_time_values_copy_time_from_string(
+		          date_time_values,
+		          string,
+		          string_index,
+		          parse_flags );
+	}
+	return( result );
+}
+
+/* Copies a POSIX time in the format: [-]#[.#########] from a string
+ * Returns 1 if successful, 0 if the string is too small or -1 if the string contains an invalid character
+ */
+static int libcdatetime_date_time_values_copy_posix_time_from_string(
+            libcdatetime_date_time_values_t *date_time_values,
+            const libcdatetime_date_time_values_string_t *string,
+            size_t *string_index,
+            int64_t *posix_time,
+            uint8_t parse_flags )
+{
+	size_t safe_string_index = 0;
+	uint64_t value           = 0;
+	uint8_t is_negative      = 0;
+	uint8_t number_of_digits = 0;
+	int result               = 0;
+
+	safe_string_index = *string_index;
+
+	if( safe_string_index >= string->size )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) == (uint8_t) '-' )
+	{
+		is_negative = 1;
+
+		safe_string_index++;
+	}
+	/* The number of digits is limited to prevent an overflow
+	 */
+	while( safe_string_index < string->size )
+	{
+		if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) < (uint8_t) '0' )
+		 || ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) > (uint8_t) '9' ) )
+		{
+			break;
+		}
+		if( number_of_digits >= 18 )
+		{
+			*string_index = safe_string_index;
+
+			return( -1 );
+		}
+		value *= 10;
+		value += libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) - (uint8_t) '0';
+
+		safe_string_index++;
+
+		number_of_digits++;
+	}
+	*string_index = safe_string_index;
+
+	if( number_of_digits == 0 )
+	{
+		if( safe_string_index >= string->size )
+		{
+			return( 0 );
+		}
+		return( -1 );
+	}
+	result = libcdatetime_date_time_values_copy_fraction_from_string(
+	          date_time_values,
+	          string,
+	          string_index,
+	          parse_flags );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	/* The sign applies to both the seconds and the fraction of a second,
+	 * which can be non-zero for a value without seconds, e.g. -0.5
+	 * A negative POSIX time with a fraction of a second, e.g. -1.5
+	 * is stored as the preceding second and a positive fraction
+	 */
+	if( is_negative == 0 )
+	{
+		*posix_time = (int64_t) value;
+	}
+	else if( date_time_values->nano_seconds == 0 )
+	{
+		*posix_time = -( (int64_t) value );
+	}
+	else
+	{
+		*posix_time                    = -( (int64_t) value ) - 1;
+		date_time_values->nano_seconds = 1000000000UL - date_time_values->nano_seconds;
+	}
+	return( 1 );
+}
+
+/* Parses the date and time values from an UTF-8, UTF-16 or UTF-32 encoded string
+ * The string is expected to be formatted as specified by the string format flags
+ * where the fraction of a second and the timezone indicator are optional
+ * The syslog format does not contain a year, hence the year of the date and
+ * time values is retained and should be set by the caller
+ * If the parse flags contain LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING
+ * the end of the string is not considered the end of the date and time value
+ *
+ * If the string cannot be parsed the parse result is set and the string index is
+ * set to the offset of the first invalid character, or for a value that is
+ * out of bounds, to the offset of the start of the date and time value.
+ * No error is set in this case, which allows to skip unparsable strings cheaply
+ *
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_date_time_values_parse_string_with_index(
+     libcdatetime_date_time_values_t *date_time_values,
+     const libcdatetime_date_time_values_string_t *string,
+     size_t *string_index,
+     uint32_t string_format_flags,
+     uint8_t parse_flags,
+     int *parse_result,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcdatetime_date_time_values_parse_string_with_index";
+	size_t safe_string_index    = 0;
+	int64_t number_of_days      = 0;
+	int64_t posix_time          = 0;
+	uint32_t string_format_type = 0;
+	uint32_t supported_flags    = 0;
+	uint8_t days_in_month       = 0;
+	int result                  = 0;
+
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string->code_unit_size != 1 )
+	 && ( string->code_unit_size != 2 )
+	 && ( string->code_unit_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string code unit size: %" PRIu8 ".",
+		 function,
+		 string->code_unit_size );
+
+		return( -1 );
+	}
+	if( string->size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_index > string->size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse result.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = 0x000000ffUL
+	                | LIBCDATETIME_STRING_FORMAT_FLAG_DATE
+	                | LIBCDATETIME_STRING_FORMAT_FLAG_TIME
+	                | LIBCDATETIME_STRING_FORMAT_FLAG_TIME_MILLI_SECONDS
+	                | LIBCDATETIME_STRING_FORMAT_FLAG_TIME_MICRO_SECONDS
+	                | LIBCDATETIME_STRING_FORMAT_FLAG_TIME_NANO_SECONDS
+	                | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR;
+
+	if( ( string_format_flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_flags );
+
+		return( -1 );
+	}
+	string_format_type = string_format_flags & 0x000000ffUL;
+
+	if( ( string_format_type != LIBCDATETIME_STRING_FORMAT_TYPE_CTIME )
+	 && ( string_format_type != LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 )
+	 && ( string_format_type != LIBCDATETIME_STRING_FORMAT_TYPE_RFC2822 )
+	 && ( string_format_type != LIBCDATETIME_STRING_FORMAT_TYPE_SYSLOG )
+	 && ( string_format_type != LIBCDATETIME_STRING_FORMAT_TYPE_POSIX_TIME ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format type: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_type );
+
+		return( -1 );
+	}
+	/* The C time and ISO 8601 formats can consist of a date and time or a date only
+	 */
+	if( ( ( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_CTIME )
+	  ||  ( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 ) )
+	 && ( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_DATE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_flags );
+
+		return( -1 );
+	}
+	safe_string_index = *string_index;
+
+	date_time_values->hours           = 0;
+	date_time_values->minutes         = 0;
+	date_time_values->seconds         = 0;
+	date_time_values->nano_seconds    = 0;
+	date_time_values->timezone_offset = 0;
+
+	switch( string_format_type )
+	{
+		case LIBCDATETIME_STRING_FORMAT_TYPE_CTIME:
+			/* The C time format is either the format used by this library
+			 * e.g. Jan 01, 1970 00:00:00 or the format used by the C asctime
+			 * function, e.g. Thu Jan  1 00:00:00 1970, which starts with
+			 * the day of the week
+			 */
+			if( ( ( string->size - safe_string_index ) >= 4 )
+			 && ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index + 3 ) == (uint8_t) ' ' )
+			 && ( libcdatetime_date_time_values_match_day_of_week_name_in_string(
+			       string,
+			       &safe_string_index ) == 1 ) )
+			{
+				safe_string_index = *string_index;
+
+				result = libcdatetime_date_time_values_copy_asctime_from_string(
+				          date_time_values,
+				          string,
+				          &safe_string_index );
+
+				break;
+			}
+			safe_string_index = *string_index;
+
+			result = libcdatetime_date_time_values_copy_ctime_date_from_string(
+			          date_time_values,
+			          string,
+			          &safe_string_index );
+
+			if( ( result == 1 )
+			 && ( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_TIME ) != 0 ) )
+			{
+				result = libcdatetime_date_time_values_match_literal_in_string(
+				          string,
+				          &safe_string_index,
+				          " ",
+				          1 );
+
+				if( result == 1 )
+				{
+					result = libcdatetime_date_time_values_copy_time_from_string(
+					          date_time_values,
+					          string,
+					          &safe_string_index,
+					          parse_flags );
+				}
+			}
+			if( result == 1 )
+			{
+				result = libcdatetime_date_time_values_copy_timezone_from_string(
+				          date_time_values,
+				          string,
+				          &safe_string_index,
+				          string_format_type,
+				          parse_flags );
+			}
+			break;
+
+		case LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601:
+			result = libcdatetime_date_time_values_copy_iso8601_date_from_string(
+			          date_time_values,
+			          string,
+			          &safe_string_index );
+
+			if( ( result == 1 )
+			 && ( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_TIME ) != 0 ) )
+			{
+				/* Date and time separator
+				 */
+				if( safe_string_index >= string->size )
+				{
+					result = 0;
+				}
+				else if( ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) != (uint8_t) 'T' )
+				      && ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) != (uint8_t) 't' )
+				      && ( libcdatetime_date_time_values_string_get_code_unit( string, safe_string_index ) != (uint8_t) ' ' ) )
+				{
+					result = -1;
+				}
+				if( result == 1 )
+				{
+					safe_string_index++;
+
+					result = libcdatetime_date_time_values_copy_time_from_string(
+					          date_time_values,
+					          string,
+					          &safe_string_index,
+					          parse_flags );
+				}
+			}
+			if( result == 1 )
+			{
+				result = libcdatetime_date_time_values_copy_timezone_from_string(
+				          date_time_values,
+				          string,
+				          &safe_string_index,
+				          string_format_type,
+				          parse_flags );
+			}
+			break;
+
+		case LIBCDATETIME_STRING_FORMAT_TYPE_RFC2822:
+			result = libcdatetime_date_time_values_copy_rfc2822_from_string(
+			          date_time_values,
+			          string,
+			          &safe_string_index,
+			          parse_flags );
+			break;
+
+		case LIBCDATETIME_STRING_FORMAT_TYPE_SYSLOG:
+			result = libcdatetime_date_time_values_copy_syslog_from_string(
+			          date_time_values,
+			          string,
+			          &safe_string_index,
+			          parse_flags );
+			break;
+
+		case LIBCDATETIME_STRING_FORMAT_TYPE_POSIX_TIME:
+			result = libcdatetime_date_time_values_copy_posix_time_from_string(
+			          date_time_values,
+			          string,
+			          &safe_string_index,
+			          &posix_time,
+			          parse_flags );
+			break;
+	}
+	if( result != 1 )
+	{
+		if( result == 0 )
+		{
+			*parse_result = LIBCDATETIME_PARSE_RESULT_TRUNCATED;
+		}
+		else
+		{
+			*parse_result = LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER;
+		}
+		*string_index = safe_string_index;
+
+		return( 0 );
+	}
+	/* The remaining checks only fail on values out of bounds
+	 */
+	*parse_result = LIBCDATETIME_PARSE_RESULT_VALUE_OUT_OF_BOUNDS;
+
+	if( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_POSIX_TIME )
+	{
+		number_of_days = posix_time / 86400;
+		posix_time    %= 86400;
+
+		if( posix_time < 0 )
+		{
+			number_of_days -= 1;
+			posix_time     += 86400;
+		}
+		date_time_values->hours   = (uint8_t) ( posix_time / 3600 );
+		date_time_values->minutes = (uint8_t) ( ( posix_time / 60 ) % 60 );
+		date_time_values->seconds = (uint8_t) ( posix_time % 60 );
+
+		if( libcdatetime_get_date_values_from_days_since_epoch(
+		     number_of_days,
+		     &( date_time_values->year ),
+		     &( date_time_values->month ),
+		     &( date_time_values->day_of_month ),
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	/* Valid values for the month value are 1 through 12.
+	 */
+	if( ( date_time_values->month == 0 )
+	 || ( date_time_values->month > 12 ) )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_get_days_in_month(
+	     &days_in_month,
+	     date_time_values->year,
+	     date_time_values->month,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve days in month.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( date_time_values->day_of_month == 0 )
+	 || ( date_time_values->day_of_month > days_in_month ) )
+	{
+		return( 0 );
+	}
+	/* Valid values for the hours value are 0 through 23.
+	 */
+	if( date_time_values->hours > 23 )
+	{
+		return( 0 );
+	}
+	/* Valid values for the minutes value are 0 through 59.
+	 */
+	if( date_time_values->minutes > 59 )
+	{
+		return( 0 );
+	}
+	/* Valid values for the seconds value are 0 through 59.
+	 */
+	if( date_time_values->seconds > 59 )
+	{
+		return( 0 );
+	}
+	*string_index = safe_string_index;
+	*parse_result = LIBCDATETIME_PARSE_RESULT_SUCCESS;
+
+	return( 1 );
+}
+
+/* Copies the date and time values from an UTF-8 encoded string
+ * The string is expected to be formatted as specified by the string format flags
+ * where the fraction of a second and the timezone indicator are optional
+ * The syslog format does not contain a year, hence the year of the date and
+ * time values is retained and should be set by the caller
+ * If the parse flags contain LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING
+ * the end of the string is not considered the end of the date and time value
+ * Returns 1 if successful, 0 if the string is too small to contain the date and time value or -1 on error
+ */
+int libcdatetime_date_time_values_copy_from_utf8_string_with_index(
+     libcdatetime_date_time_values_t *date_time_values,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     uint8_t parse_flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_date_time_values_copy_from_utf8_string_with_index";
+	size_t string_index   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = utf8_string;
+	string.size           = utf8_string_size;
+	string.code_unit_size = 1;
+
+	string_index = *utf8_string_index;
+
+	result = libcdatetime_date_time_values_parse_string_with_index(
+	          date_time_values,
+	          &string,
+	          &string_index,
+	          string_format_flags,
+	          parse_flags,
+	          &parse_result,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( parse_result == LIBCDATETIME_PARSE_RESULT_TRUNCATED )
+		{
+			return( 0 );
+		}
+		else if( parse_result == LIBCDATETIME_PARSE_RESULT_VALUE_OUT_OF_BOUNDS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid date and time value out of bounds.",
+			 function );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character at index: %" PRIzd ".",
+			 function,
+			 string_index );
+		}
+		return( -1 );
+	}
+	*utf8_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Retrieves the date and time values as a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * The timezone offset is applied and the fraction of a second is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_date_time_values_get_posix_time(
+     libcdatetime_date_time_values_t *date_time_values,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_date_time_values_get_posix_time";
+	int64_t safe_time     = 0;
+
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_get_days_since_epoch(
+	     &safe_time,
+	     date_time_values->year,
+	     date_time_values->month,
+	     date_time_values->day_of_month,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of days since epoch.",
+		 function );
+
+		return( -1 );
+	}
+	safe_time *= 24;
+	safe_time += date_time_values->hours;
+	safe_time *= 60;
+	safe_time += date_time_values->minutes;
+	safe_time -= date_time_values->timezone_offset;
+	safe_time *= 60;
+	safe_time += date_time_values->seconds;
+
+	*posix_time = safe_time;
+
+	return( 1 );
+}
+
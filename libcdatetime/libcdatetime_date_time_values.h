@@ -0,0 +1,133 @@
+/*
+ * Date and time values functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_DATE_TIME_VALUES_H )
+#define _LIBCDATETIME_DATE_TIME_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAGS
+{
+	/* The string is part of a larger string that has not been fully read
+	 * yet, e.g. the end of a buffer of streamed data
+	 */
+	LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING	= 0x01,
+};
+
+typedef struct libcdatetime_date_time_values_string libcdatetime_date_time_values_string_t;
+
+struct libcdatetime_date_time_values_string
+{
+	/* The string data, which contains UTF-8, UTF-16 or UTF-32 code units
+	 * UTF-16 and UTF-32 code units are stored in host byte order
+	 */
+	const uint8_t *data;
+
+	/* The string size in number of code units
+	 */
+	size_t size;
+
+	/* The size of a code unit in bytes, either 1, 2 or 4
+	 */
+	uint8_t code_unit_size;
+};
+
+/* Retrieves the code unit at a specific index in a string
+ * The code units are read directly, without conversion to UTF-8
+ */
+#define libcdatetime_date_time_values_string_get_code_unit( string, index ) \
+	( ( ( string )->code_unit_size == 1 ) ? (uint32_t) ( ( string )->data )[ index ] \
+	: ( ( ( string )->code_unit_size == 2 ) ? (uint32_t) ( (const uint16_t *) ( string )->data )[ index ] \
+	: ( (const uint32_t *) ( string )->data )[ index ] ) )
+
+typedef struct libcdatetime_date_time_values libcdatetime_date_time_values_t;
+
+struct libcdatetime_date_time_values
+{
+	/* The year
+	 */
+	uint16_t year;
+
+	/* The month
+	 */
+	uint8_t month;
+
+	/* The day of month
+	 */
+	uint8_t day_of_month;
+
+	/* The hours
+	 */
+	uint8_t hours;
+
+	/* The minutes
+	 */
+	uint8_t minutes;
+
+	/* The seconds
+	 */
+	uint8_t seconds;
+
+	/* The fraction of a second in nano seconds
+	 */
+	uint32_t nano_seconds;
+
+	/* The offset of the timezone relative to UTC in minutes
+	 */
+	int16_t timezone_offset;
+};
+
+int libcdatetime_date_time_values_parse_string_with_index(
+     libcdatetime_date_time_values_t *date_time_values,
+     const libcdatetime_date_time_values_string_t *string,
+     size_t *string_index,
+     uint32_t string_format_flags,
+     uint8_t parse_flags,
+     int *parse_result,
+     libcerror_error_t **error );
+
+int libcdatetime_date_time_values_copy_from_utf8_string_with_index(
+     libcdatetime_date_time_values_t *date_time_values,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     uint8_t parse_flags,
+     libcerror_error_t **error );
+
+int libcdatetime_date_time_values_get_posix_time(
+     libcdatetime_date_time_values_t *date_time_values,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_DATE_TIME_VALUES_H ) */
+
@@ -33,10 +33,14 @@
 
 #include <errno.h>
 
+#include "libcdatetime_date_time_values.h"
 #include "libcdatetime_definitions.h"
 #include "libcdatetime_elements.h"
 #include "libcdatetime_libcerror.h"
 #include "libcdatetime_support.h"
+#include "libcdatetime_system_timezone.h"
+#include "libcdatetime_timestamp.h"
+#include "libcdatetime_timezone.h"
 #include "libcdatetime_types.h"
 
 /* Creates date and time elements
@@ -1232,7 +1236,8 @@ int libcdatetime_elements_get_milli_seconds(
      uint16_t *milli_seconds,
      libcerror_error_t **error )
 {
-	static char *function = "libcdatetime_elements_get_milli_seconds";
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_get_milli_seconds";
 
 	if( elements == NULL )
 	{
@@ -1245,6 +1250,8 @@ int libcdatetime_elements_get_milli_seconds(
 
 		return( -1 );
 	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
 	if( milli_seconds == NULL )
 	{
 		libcerror_error_set(
@@ -1256,15 +1263,26 @@ int libcdatetime_elements_get_milli_seconds(
 
 		return( -1 );
 	}
-	/* Seconds is the smallest granularity we have so default to 0.
-	 */
-	*milli_seconds = 0;
+	if( internal_elements->nano_seconds > 999999999UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time member nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*milli_seconds = (uint16_t) ( internal_elements->nano_seconds / 1000000 );
 
 	return( 1 );
 }
 
 #endif
 
+#if defined( WINAPI )
+
 /* Retrieves the micro seconds
  * Returns 1 if successful or -1 on error
  */
@@ -1304,6 +1322,63 @@ int libcdatetime_elements_get_micro_seconds(
 	return( 1 );
 }
 
+#else
+
+/* Retrieves the micro seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_get_micro_seconds(
+     libcdatetime_elements_t *elements,
+     uint16_t *micro_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_get_micro_seconds";
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( micro_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid micro seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_elements->nano_seconds > 999999999UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time member nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*micro_seconds = (uint16_t) ( ( internal_elements->nano_seconds / 1000 ) % 1000 );
+
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+#if defined( WINAPI )
+
 /* Retrieves the nano seconds
  * Returns 1 if successful or -1 on error
  */
@@ -1343,6 +1418,61 @@ int libcdatetime_elements_get_nano_seconds(
 	return( 1 );
 }
 
+#else
+
+/* Retrieves the nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_get_nano_seconds(
+     libcdatetime_elements_t *elements,
+     uint16_t *nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_get_nano_seconds";
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_elements->nano_seconds > 999999999UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time member nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*nano_seconds = (uint16_t) ( internal_elements->nano_seconds % 1000 );
+
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) */
+
 /* Retrieves the time values
  * Returns 1 if successful or -1 on error
  */
@@ -1566,7 +1696,9 @@ int libcdatetime_elements_set_date_and_time_values(
 	internal_elements->tm.tm_hour  = (int) hours;
 	internal_elements->tm.tm_min   = (int) minutes;
 	internal_elements->tm.tm_sec   = (int) seconds;
-	internal_elements->tm.tm_isdst = 0;
+	internal_elements->tm.tm_isdst = -1;
+
+	internal_elements->nano_seconds = 0;
 #endif
 	return( 1 );
 }
@@ -1710,14 +1842,120 @@ int libcdatetime_internal_elements_set_from_time_utc(
 		return( -1 );
 	}
 #endif
+	internal_elements->nano_seconds = 0;
+
 	return( 1 );
 }
 
 #endif /* !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) ) */
 
+#if !defined( WINAPI )
+
+/* Sets the time members from a number of seconds since January 1, 1970 00:00:00
+ * The number of seconds is not converted, hence it can represent either UTC or a local time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_elements_set_tm_from_number_of_seconds(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t number_of_seconds,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcdatetime_internal_elements_set_tm_from_number_of_seconds";
+	int64_t number_of_days = 0;
+	int64_t seconds_of_day = 0;
+	uint16_t day_of_year   = 0;
+	uint16_t year          = 0;
+	uint8_t day_of_month   = 0;
+	uint8_t month          = 0;
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_days = number_of_seconds / 86400;
+	seconds_of_day = number_of_seconds % 86400;
+
+	/* The time of day is relative to the preceding day
+	 */
+	if( seconds_of_day < 0 )
+	{
+		number_of_days -= 1;
+		seconds_of_day += 86400;
+	}
+	if( libcdatetime_get_date_values_from_days_since_epoch(
+	     number_of_days,
+	     &year,
+	     &month,
+	     &day_of_month,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine date values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_get_day_of_year(
+	     &day_of_year,
+	     year,
+	     month,
+	     day_of_month,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine day of year.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( internal_elements->tm ),
+	     0,
+	     sizeof( struct tm ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear time members.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->tm.tm_year = (int) year - 1900;
+	internal_elements->tm.tm_yday = (int) day_of_year;
+	internal_elements->tm.tm_mon  = (int) month - 1;
+	internal_elements->tm.tm_mday = (int) day_of_month;
+	internal_elements->tm.tm_hour = (int) ( seconds_of_day / 3600 );
+	internal_elements->tm.tm_min  = (int) ( ( seconds_of_day / 60 ) % 60 );
+	internal_elements->tm.tm_sec  = (int) ( seconds_of_day % 60 );
+
+	/* January 1, 1970 was a Thursday
+	 */
+	internal_elements->tm.tm_wday = (int) ( ( ( number_of_days % 7 ) + 11 ) % 7 );
+
+	return( 1 );
+}
+
+#endif /* !defined( WINAPI ) */
+
 #if !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) )
 
 /* Sets the date and time elements from a POSIX time value in localtime
+ * The cached system timezone is used if available, otherwise the C runtime
  * Returns 1 if successful or -1 on error
  */
 int libcdatetime_internal_elements_set_from_time_localtime(
@@ -1725,10 +1963,14 @@ int libcdatetime_internal_elements_set_from_time_localtime(
      time_t *time,
      libcerror_error_t **error )
 {
-	static char *function = "libcdatetime_internal_elements_set_from_time_localtime";
+	const libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	libcdatetime_internal_timezone_t *internal_timezone            = NULL;
+	libcdatetime_timezone_t *system_timezone                       = NULL;
+	static char *function                                          = "libcdatetime_internal_elements_set_from_time_localtime";
+	int result                                                     = 0;
 
 #if !defined( HAVE_LOCALTIME_R )
-	struct tm *static_tm  = NULL;
+	struct tm *static_tm                                           = NULL;
 #endif
 
 	if( internal_elements == NULL )
@@ -1753,6 +1995,75 @@ int libcdatetime_internal_elements_set_from_time_localtime(
 
 		return( -1 );
 	}
+	/* The C runtime localtime functions can serialize on a process wide lock,
+	 * hence the cached system timezone is used when available
+	 */
+	result = libcdatetime_system_timezone_get_timezone(
+	          &system_timezone,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve system timezone.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		internal_timezone = (libcdatetime_internal_timezone_t *) system_timezone;
+
+		if( libcdatetime_internal_timezone_get_local_time_type(
+		     internal_timezone,
+		     (int64_t) *time,
+		     &local_time_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve local time type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdatetime_internal_elements_set_tm_from_number_of_seconds(
+		     internal_elements,
+		     (int64_t) *time + local_time_type->utc_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set time elements.",
+			 function );
+
+			goto on_error;
+		}
+		internal_elements->tm.tm_isdst  = (int) local_time_type->is_daylight_saving_time;
+		internal_elements->nano_seconds = 0;
+
+		if( libcdatetime_system_timezone_release_timezone(
+		     &system_timezone,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release system timezone.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
 #if defined( HAVE_LOCALTIME_R )
 	if( localtime_r(
 	     time,
@@ -1797,26 +2108,39 @@ int libcdatetime_internal_elements_set_from_time_localtime(
 		return( -1 );
 	}
 #endif
+	internal_elements->nano_seconds = 0;
+
 	return( 1 );
+
+on_error:
+	if( system_timezone != NULL )
+	{
+		libcdatetime_system_timezone_release_timezone(
+		 &system_timezone,
+		 NULL );
+	}
+	return( -1 );
 }
 
 #endif /* if !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) ) */
 
-#if defined( WINAPI ) && ( WINVER >= 0x0500 )
-
-/* Sets the date and time elements to the current (system) date and time in UTC
- * This function uses the WINAPI function for Windows 2000 or later
+/* Sets the date and time elements from date and time values
+ * The date and time values are converted to UTC
  * Returns 1 if successful or -1 on error
  */
-int libcdatetime_elements_set_current_time_utc(
-     libcdatetime_elements_t *elements,
+int libcdatetime_internal_elements_set_from_date_time_values(
+     libcdatetime_internal_elements_t *internal_elements,
+     libcdatetime_date_time_values_t *date_time_values,
      libcerror_error_t **error )
 {
-	libcdatetime_internal_elements_t *internal_elements = NULL;
-	static char *function                               = "libcdatetime_elements_set_current_time_utc";
-	DWORD error_code                                    = 0;
+	static char *function = "libcdatetime_internal_elements_set_from_date_time_values";
+	int64_t posix_time    = 0;
 
-	if( elements == NULL )
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	uint64_t filetime     = 0;
+#endif
+
+	if( internal_elements == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1827,13 +2151,1542 @@ int libcdatetime_elements_set_current_time_utc(
 
 		return( -1 );
 	}
-	internal_elements = (libcdatetime_internal_elements_t *) elements;
-
-	GetSystemTime(
-	 &( internal_elements->systemtime ) );
-
-	if( SystemTimeToFileTime(
-	     &( internal_elements->systemtime ),
+	if( libcdatetime_date_time_values_get_posix_time(
+	     date_time_values,
+	     &posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC
+	 */
+	if( posix_time < -11644473600LL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	filetime  = (uint64_t) ( posix_time + 11644473600LL ) * 10000000UL;
+	filetime += date_time_values->nano_seconds / 100;
+
+	internal_elements->filetime.dwLowDateTime  = (DWORD) ( filetime & 0xffffffffUL );
+	internal_elements->filetime.dwHighDateTime = (DWORD) ( filetime >> 32 );
+
+	if( libcdatetime_internal_elements_set_from_filetime_utc(
+	     internal_elements,
+	     &( internal_elements->filetime ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from filetime.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI set from date and time values function for Windows NT4 or earlier NOT implemented yet
+
+#else
+	internal_elements->time = (time_t) posix_time;
+
+	if( (int64_t) internal_elements->time != posix_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_time_utc(
+	     internal_elements,
+	     &( internal_elements->time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->nano_seconds = date_time_values->nano_seconds;
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC;
+
+	return( 1 );
+}
+
+/* Sets the date and time elements from a POSIX time in nano seconds in UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc";
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	uint64_t filetime         = 0;
+#else
+	int64_t nano_seconds      = 0;
+	int64_t number_of_seconds = 0;
+#endif
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC and the FILETIME
+	 * is in intervals of 100 nano seconds
+	 */
+	filetime = (uint64_t) ( ( posix_time_in_nano_seconds / 100 ) + 116444736000000000LL );
+
+	internal_elements->filetime.dwLowDateTime  = (DWORD) ( filetime & 0xffffffffUL );
+	internal_elements->filetime.dwHighDateTime = (DWORD) ( filetime >> 32 );
+
+	if( libcdatetime_internal_elements_set_from_filetime_utc(
+	     internal_elements,
+	     &( internal_elements->filetime ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from filetime.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI set from POSIX time in nano seconds function for Windows NT4 or earlier NOT implemented yet
+
+#else
+	number_of_seconds = posix_time_in_nano_seconds / 1000000000LL;
+	nano_seconds      = posix_time_in_nano_seconds % 1000000000LL;
+
+	/* The fraction of a second is relative to the preceding second
+	 */
+	if( nano_seconds < 0 )
+	{
+		number_of_seconds -= 1;
+		nano_seconds      += 1000000000LL;
+	}
+	internal_elements->time = (time_t) number_of_seconds;
+
+	if( (int64_t) internal_elements->time != number_of_seconds )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_time_utc(
+	     internal_elements,
+	     &( internal_elements->time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->nano_seconds = (uint32_t) nano_seconds;
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC;
+
+	return( 1 );
+}
+
+/* Sets the date and time elements from a POSIX time in nano seconds in localtime
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_localtime(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_localtime";
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	FILETIME utc_filetime;
+
+	uint64_t filetime         = 0;
+	DWORD error_code          = 0;
+#else
+	int64_t nano_seconds      = 0;
+	int64_t number_of_seconds = 0;
+#endif
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC and the FILETIME
+	 * is in intervals of 100 nano seconds
+	 */
+	filetime = (uint64_t) ( ( posix_time_in_nano_seconds / 100 ) + 116444736000000000LL );
+
+	utc_filetime.dwLowDateTime  = (DWORD) ( filetime & 0xffffffffUL );
+	utc_filetime.dwHighDateTime = (DWORD) ( filetime >> 32 );
+
+	if( FileTimeToLocalFileTime(
+	     &utc_filetime,
+	     &( internal_elements->filetime ) ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve local filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( FileTimeToSystemTime(
+	     &( internal_elements->filetime ),
+	     &( internal_elements->systemtime ) ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve systemtime.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI set from POSIX time in nano seconds function for Windows NT4 or earlier NOT implemented yet
+
+#else
+	number_of_seconds = posix_time_in_nano_seconds / 1000000000LL;
+	nano_seconds      = posix_time_in_nano_seconds % 1000000000LL;
+
+	/* The fraction of a second is relative to the preceding second
+	 */
+	if( nano_seconds < 0 )
+	{
+		number_of_seconds -= 1;
+		nano_seconds      += 1000000000LL;
+	}
+	internal_elements->time = (time_t) number_of_seconds;
+
+	if( (int64_t) internal_elements->time != number_of_seconds )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_time_localtime(
+	     internal_elements,
+	     &( internal_elements->time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->nano_seconds = (uint32_t) nano_seconds;
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME;
+
+	return( 1 );
+}
+
+/* Sets the date and time elements from a POSIX time in nano seconds with an UTC offset
+ * The UTC offset is in seconds and is added to UTC to obtain the date and time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_utc_offset(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     int32_t utc_offset,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_utc_offset";
+	int64_t local_time_in_nano_seconds = 0;
+	int64_t utc_offset_in_nano_seconds = 0;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	uint64_t filetime                  = 0;
+#endif
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	utc_offset_in_nano_seconds = (int64_t) utc_offset * 1000000000LL;
+
+	if( ( ( utc_offset_in_nano_seconds > 0 )
+	  && ( posix_time_in_nano_seconds > ( (int64_t) INT64_MAX - utc_offset_in_nano_seconds ) ) )
+	 || ( ( utc_offset_in_nano_seconds < 0 )
+	  && ( posix_time_in_nano_seconds < ( (int64_t) INT64_MIN - utc_offset_in_nano_seconds ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time in nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	local_time_in_nano_seconds = posix_time_in_nano_seconds + utc_offset_in_nano_seconds;
+
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	     internal_elements,
+	     local_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from local time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The filetime or time contains the date and time in UTC
+	 * so that the delta between elements with different UTC offsets is correct
+	 */
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	filetime = (uint64_t) ( ( posix_time_in_nano_seconds / 100 ) + 116444736000000000LL );
+
+	internal_elements->filetime.dwLowDateTime  = (DWORD) ( filetime & 0xffffffffUL );
+	internal_elements->filetime.dwHighDateTime = (DWORD) ( filetime >> 32 );
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI set from POSIX time in nano seconds function for Windows NT4 or earlier NOT implemented yet
+
+#else
+	internal_elements->time -= (time_t) utc_offset;
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+	internal_elements->mode       = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_TIMEZONE;
+	internal_elements->utc_offset = utc_offset;
+
+	return( 1 );
+}
+
+/* Sets the date and time elements from a POSIX time in nano seconds with a fixed UTC offset
+ * The UTC offset is in minutes and is added to UTC to obtain the date and time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_fixed_utc_offset(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     int16_t utc_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_fixed_utc_offset";
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utc_offset < LIBCDATETIME_ELEMENTS_MINIMUM_FIXED_UTC_OFFSET )
+	 || ( utc_offset > LIBCDATETIME_ELEMENTS_MAXIMUM_FIXED_UTC_OFFSET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTC offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_utc_offset(
+	     internal_elements,
+	     posix_time_in_nano_seconds,
+	     (int32_t) utc_offset * 60,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements with UTC offset.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->mode             = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_WITH_FIXED_UTC_OFFSET;
+	internal_elements->fixed_utc_offset = utc_offset;
+
+	return( 1 );
+}
+
+/* Sets the date and time elements from a POSIX time in nano seconds in a timezone
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_in_timezone(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error )
+{
+	const libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	static char *function                                          = "libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_in_timezone";
+	int64_t posix_time                                             = 0;
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	/* The fraction of a second is relative to the preceding second
+	 */
+	posix_time = posix_time_in_nano_seconds / 1000000000LL;
+
+	if( ( posix_time_in_nano_seconds % 1000000000LL ) < 0 )
+	{
+		posix_time -= 1;
+	}
+	if( libcdatetime_internal_timezone_get_local_time_type(
+	     (libcdatetime_internal_timezone_t *) timezone,
+	     posix_time,
+	     &local_time_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local time type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_utc_offset(
+	     internal_elements,
+	     posix_time_in_nano_seconds,
+	     local_time_type->utc_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements with UTC offset.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the date and time elements in a timezone from date and time elements in UTC
+ * Only the UTC offset is looked up and only the time of day and the date rollover
+ * are recomputed, hence one set of elements in UTC can be shared by multiple timezones
+ * If timezone is NULL the system timezone is used
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_elements_set_in_timezone_from_utc_elements(
+     libcdatetime_internal_elements_t *internal_elements,
+     const libcdatetime_internal_elements_t *utc_elements,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error )
+{
+	const libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	libcdatetime_timezone_t *system_timezone                       = NULL;
+	static char *function                                          = "libcdatetime_internal_elements_set_in_timezone_from_utc_elements";
+	int64_t posix_time                                             = 0;
+	int64_t posix_time_in_nano_seconds                             = 0;
+	int32_t utc_offset                                             = 0;
+	int result                                                     = 0;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	int64_t number_of_100ns                                        = 0;
+#else
+	int64_t number_of_days                                         = 0;
+	int64_t seconds_of_day                                         = 0;
+	uint16_t day_of_year                                           = 0;
+	uint16_t year                                                  = 0;
+	uint8_t day_of_month                                           = 0;
+	uint8_t day_of_week                                            = 0;
+	uint8_t days_in_month                                          = 0;
+	uint8_t month                                                  = 0;
+#endif
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( utc_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTC elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( utc_elements->mode != LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UTC elements mode.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	number_of_100ns  = ( (int64_t) utc_elements->filetime.dwHighDateTime << 32 ) | utc_elements->filetime.dwLowDateTime;
+	number_of_100ns -= 116444736000000000LL;
+
+	posix_time = number_of_100ns / 10000000LL;
+
+	/* The fraction of a second is relative to the preceding second
+	 */
+	if( ( number_of_100ns % 10000000LL ) < 0 )
+	{
+		posix_time -= 1;
+	}
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI set in timezone from UTC elements function for Windows NT4 or earlier NOT implemented yet
+
+#else
+	posix_time = (int64_t) utc_elements->time;
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+	if( ( posix_time > ( ( (int64_t) INT64_MAX / 1000000000LL ) - 1 ) )
+	 || ( posix_time < ( (int64_t) INT64_MIN / 1000000000LL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	posix_time_in_nano_seconds = number_of_100ns * 100;
+#else
+	posix_time_in_nano_seconds = ( posix_time * 1000000000LL ) + utc_elements->nano_seconds;
+#endif
+
+	if( timezone == NULL )
+	{
+		result = libcdatetime_system_timezone_get_timezone(
+		          &system_timezone,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve system timezone.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_localtime(
+			     internal_elements,
+			     posix_time_in_nano_seconds,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set time elements in localtime.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		timezone = system_timezone;
+	}
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          posix_time,
+	          &local_time_type,
+	          error );
+
+	if( result == 1 )
+	{
+		utc_offset = local_time_type->utc_offset;
+	}
+	/* The system timezone is only needed to determine the UTC offset
+	 */
+	if( system_timezone != NULL )
+	{
+		if( libcdatetime_system_timezone_release_timezone(
+		     &system_timezone,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release system timezone.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local time type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	/* The SYSTEMTIME is determined by the system from the FILETIME
+	 */
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_utc_offset(
+	     internal_elements,
+	     posix_time_in_nano_seconds,
+	     utc_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements with UTC offset.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	seconds_of_day = ( (int64_t) utc_elements->tm.tm_hour * 3600 )
+	               + ( (int64_t) utc_elements->tm.tm_min * 60 )
+	               + (int64_t) utc_elements->tm.tm_sec
+	               + utc_offset;
+
+	number_of_days = seconds_of_day / 86400;
+	seconds_of_day = seconds_of_day % 86400;
+
+	/* The time of day is relative to the preceding day
+	 */
+	if( seconds_of_day < 0 )
+	{
+		number_of_days -= 1;
+		seconds_of_day += 86400;
+	}
+	if( ( utc_elements->tm.tm_year < ( 0 - 1900 ) )
+	 || ( utc_elements->tm.tm_year > ( (int) UINT16_MAX - 1900 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid year value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	year         = (uint16_t) ( utc_elements->tm.tm_year + 1900 );
+	month        = (uint8_t) ( utc_elements->tm.tm_mon + 1 );
+	day_of_month = (uint8_t) utc_elements->tm.tm_mday;
+	day_of_year  = (uint16_t) utc_elements->tm.tm_yday;
+
+	/* The day of week moves along with the date
+	 */
+	day_of_week = (uint8_t) ( ( ( utc_elements->tm.tm_wday + (int) ( number_of_days % 7 ) ) + 7 ) % 7 );
+
+	/* The date only changes when the UTC offset crosses midnight,
+	 * which is at most a couple of days
+	 */
+	if( number_of_days != 0 )
+	{
+		while( number_of_days < 0 )
+		{
+			if( day_of_month > 1 )
+			{
+				day_of_month--;
+			}
+			else
+			{
+				if( month > 1 )
+				{
+					month--;
+				}
+				else
+				{
+					if( year == 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid year value out of bounds.",
+						 function );
+
+						return( -1 );
+					}
+					month = 12;
+					year--;
+				}
+				if( libcdatetime_get_days_in_month(
+				     &day_of_month,
+				     year,
+				     month,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve days in month.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			number_of_days++;
+		}
+		while( number_of_days > 0 )
+		{
+			if( libcdatetime_get_days_in_month(
+			     &days_in_month,
+			     year,
+			     month,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve days in month.",
+				 function );
+
+				return( -1 );
+			}
+			if( day_of_month < days_in_month )
+			{
+				day_of_month++;
+			}
+			else
+			{
+				day_of_month = 1;
+
+				if( month < 12 )
+				{
+					month++;
+				}
+				else
+				{
+					if( year == UINT16_MAX )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid year value out of bounds.",
+						 function );
+
+						return( -1 );
+					}
+					month = 1;
+					year++;
+				}
+			}
+			number_of_days--;
+		}
+		if( libcdatetime_get_day_of_year(
+		     &day_of_year,
+		     year,
+		     month,
+		     day_of_month,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine day of year.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_elements->time         = utc_elements->time;
+	internal_elements->tm           = utc_elements->tm;
+	internal_elements->nano_seconds = utc_elements->nano_seconds;
+
+	internal_elements->tm.tm_year  = (int) year - 1900;
+	internal_elements->tm.tm_yday  = (int) day_of_year;
+	internal_elements->tm.tm_mon   = (int) month - 1;
+	internal_elements->tm.tm_mday  = (int) day_of_month;
+	internal_elements->tm.tm_hour  = (int) ( seconds_of_day / 3600 );
+	internal_elements->tm.tm_min   = (int) ( ( seconds_of_day / 60 ) % 60 );
+	internal_elements->tm.tm_sec   = (int) ( seconds_of_day % 60 );
+	internal_elements->tm.tm_wday  = (int) day_of_week;
+	internal_elements->tm.tm_isdst = (int) local_time_type->is_daylight_saving_time;
+
+	internal_elements->mode       = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_TIMEZONE;
+	internal_elements->utc_offset = local_time_type->utc_offset;
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+	return( 1 );
+}
+
+/* Retrieves the date and time elements as a POSIX time in nano seconds
+ * The date and time elements are converted from localtime to UTC if needed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_elements_get_posix_time_in_nano_seconds(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function                               = "libcdatetime_internal_elements_get_posix_time_in_nano_seconds";
+	int64_t number_of_seconds                           = 0;
+	uint32_t nano_seconds                               = 0;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	FILETIME local_filetime;
+	FILETIME utc_filetime;
+
+	int64_t number_of_100ns                             = 0;
+	DWORD error_code                                    = 0;
+#else
+	struct tm local_tm;
+
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	libcdatetime_timezone_t *system_timezone            = NULL;
+	int64_t number_of_days                              = 0;
+	time_t posix_time                                   = 0;
+	int local_time_policy                               = 0;
+	int result                                          = 0;
+#endif
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_elements->mode != LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC )
+	 && ( internal_elements->mode != LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME )
+	 && ( internal_elements->mode != LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_TIMEZONE )
+	 && ( internal_elements->mode != LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_WITH_FIXED_UTC_OFFSET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	if( SystemTimeToFileTime(
+	     &( internal_elements->systemtime ),
+	     &utc_filetime ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME )
+	{
+		local_filetime = utc_filetime;
+
+		if( LocalFileTimeToFileTime(
+		     &local_filetime,
+		     &utc_filetime ) == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 error_code,
+			 "%s: unable to retrieve UTC filetime.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC and the FILETIME
+	 * is in intervals of 100 nano seconds. A SYSTEMTIME is limited to the
+	 * year 30827 hence the FILETIME fits in a signed 64-bit integer
+	 */
+	number_of_100ns   = ( (int64_t) utc_filetime.dwHighDateTime << 32 ) | utc_filetime.dwLowDateTime;
+	number_of_100ns  -= 116444736000000000LL;
+
+	number_of_seconds = number_of_100ns / 10000000LL;
+	number_of_100ns   = number_of_100ns % 10000000LL;
+
+	/* The fraction of a second is relative to the preceding second
+	 */
+	if( number_of_100ns < 0 )
+	{
+		number_of_seconds -= 1;
+		number_of_100ns   += 10000000LL;
+	}
+	nano_seconds = (uint32_t) number_of_100ns * 100;
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI get POSIX time in nano seconds function for Windows NT4 or earlier NOT implemented yet
+
+#else
+	if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME )
+	{
+		/* mktime can serialize on a process wide lock and does not indicate
+		 * how it resolves an ambiguous or non-existent local time, hence the
+		 * cached system timezone is used when available
+		 */
+		result = libcdatetime_system_timezone_get_timezone(
+		          &system_timezone,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve system timezone.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_elements->mode != LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME )
+	 || ( result != 0 ) )
+	{
+		if( ( internal_elements->tm.tm_year < ( 0 - 1900 ) )
+		 || ( internal_elements->tm.tm_year > ( (int) UINT16_MAX - 1900 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid year value out of bounds.",
+			 function );
+
+			libcdatetime_system_timezone_release_timezone(
+			 &system_timezone,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libcdatetime_get_days_since_epoch(
+		     &number_of_days,
+		     (uint16_t) ( internal_elements->tm.tm_year + 1900 ),
+		     (uint8_t) ( internal_elements->tm.tm_mon + 1 ),
+		     (uint8_t) internal_elements->tm.tm_mday,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of days since epoch.",
+			 function );
+
+			libcdatetime_system_timezone_release_timezone(
+			 &system_timezone,
+			 NULL );
+
+			return( -1 );
+		}
+		number_of_seconds = ( number_of_days * 86400 )
+		                  + ( (int64_t) internal_elements->tm.tm_hour * 3600 )
+		                  + ( (int64_t) internal_elements->tm.tm_min * 60 )
+		                  + (int64_t) internal_elements->tm.tm_sec;
+	}
+	if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME )
+	{
+		if( result != 0 )
+		{
+			internal_timezone = (libcdatetime_internal_timezone_t *) system_timezone;
+
+			/* An ambiguous local time is resolved by the daylight saving time
+			 * indicator if known, where the daylight saving time occurrence is the earliest
+			 */
+			if( internal_elements->tm.tm_isdst == 0 )
+			{
+				local_time_policy = LIBCDATETIME_LOCAL_TIME_POLICY_LATEST;
+			}
+			else
+			{
+				local_time_policy = LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST;
+			}
+			if( libcdatetime_internal_timezone_get_posix_time_from_local_time(
+			     internal_timezone,
+			     number_of_seconds,
+			     local_time_policy,
+			     &number_of_seconds,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to convert localtime to UTC.",
+				 function );
+
+				libcdatetime_system_timezone_release_timezone(
+				 &system_timezone,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			/* mktime can normalize the members of the struct tm
+			 * hence a copy is used
+			 */
+			local_tm = internal_elements->tm;
+
+			posix_time = mktime(
+			              &local_tm );
+
+			if( posix_time == (time_t) -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to convert localtime to UTC.",
+				 function );
+
+				libcdatetime_system_timezone_release_timezone(
+				 &system_timezone,
+				 NULL );
+
+				return( -1 );
+			}
+			number_of_seconds = (int64_t) posix_time;
+		}
+	}
+	if( libcdatetime_system_timezone_release_timezone(
+	     &system_timezone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release system timezone.",
+		 function );
+
+		return( -1 );
+	}
+	nano_seconds = internal_elements->nano_seconds;
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+	/* In timezone mode the date and time elements are relative to the UTC offset
+	 */
+	if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_TIMEZONE )
+	{
+		number_of_seconds -= internal_elements->utc_offset;
+	}
+	else if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_WITH_FIXED_UTC_OFFSET )
+	{
+		number_of_seconds -= (int64_t) internal_elements->fixed_utc_offset * 60;
+	}
+	if( ( number_of_seconds > ( (int64_t) INT64_MAX / 1000000000LL ) )
+	 || ( number_of_seconds < ( (int64_t) INT64_MIN / 1000000000LL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds *= 1000000000LL;
+
+	if( number_of_seconds > ( (int64_t) INT64_MAX - nano_seconds ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = number_of_seconds + nano_seconds;
+
+	return( 1 );
+}
+
+/* Sets the clock source of the elements
+ * Setting the clock source to LIBCDATETIME_CLOCK_SOURCE_DEFAULT makes the elements
+ * use the clock source set for the process
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_set_clock_source(
+     libcdatetime_elements_t *elements,
+     int clock_source,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_set_clock_source";
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( libcdatetime_clock_settings_set_clock_source(
+	     &( internal_elements->clock_settings ),
+	     clock_source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a callback function as the clock source of the elements
+ * The callback function should retrieve the current time as the number
+ * of nano seconds since January 1, 1970 00:00:00 UTC and return 1 if
+ * successful or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_set_clock_callback(
+     libcdatetime_elements_t *elements,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_set_clock_callback";
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( libcdatetime_clock_settings_set_clock_callback(
+	     &( internal_elements->clock_settings ),
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock callback.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+
+/* Sets the date and time elements to the current (system) date and time in UTC
+ * This function uses the WINAPI function for Windows 2000 or later
+ * The current time is retrieved from the clock source of the elements
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_set_current_time_utc(
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_set_current_time_utc";
+	uint64_t filetime                                   = 0;
+	int64_t posix_time_in_nano_seconds                  = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_elements->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC and the FILETIME
+	 * is in intervals of 100 nano seconds
+	 */
+	filetime = (uint64_t) ( ( posix_time_in_nano_seconds / 100 ) + 116444736000000000LL );
+
+	internal_elements->filetime.dwLowDateTime  = (DWORD) ( filetime & 0xffffffffUL );
+	internal_elements->filetime.dwHighDateTime = (DWORD) ( filetime >> 32 );
+
+	if( libcdatetime_internal_elements_set_from_filetime_utc(
+	     internal_elements,
+	     &( internal_elements->filetime ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from filetime.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC;
+
+	return( 1 );
+}
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI set current time in UTC function for Windows NT4 or earlier NOT implemented yet
+
+#elif defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) )
+
+/* Sets the date and time elements to the current (system) date and time in UTC
+ * The current time is retrieved from the clock source of the elements
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_set_current_time_utc(
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_set_current_time_utc";
+	int64_t nano_seconds                                = 0;
+	int64_t number_of_seconds                           = 0;
+	int64_t posix_time_in_nano_seconds                  = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_elements->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = posix_time_in_nano_seconds / 1000000000LL;
+	nano_seconds      = posix_time_in_nano_seconds % 1000000000LL;
+
+	/* The fraction of a second is relative to the preceding second
+	 */
+	if( nano_seconds < 0 )
+	{
+		number_of_seconds -= 1;
+		nano_seconds      += 1000000000LL;
+	}
+	internal_elements->time = (time_t) number_of_seconds;
+
+	if( (int64_t) internal_elements->time != number_of_seconds )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_time_utc(
+	     internal_elements,
+	     &( internal_elements->time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->nano_seconds = (uint32_t) nano_seconds;
+	internal_elements->mode         = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC;
+
+	return( 1 );
+}
+
+#else
+#error Missing get current time in UTC function
+#endif
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+
+/* Sets the date and time elements to the current (system) date and time in localtime
+ * This function uses the WINAPI function for Windows 2000 or later
+ * The current time is retrieved from the clock source of the elements
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_set_current_time_localtime(
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	FILETIME utc_filetime;
+
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_set_current_time_localtime";
+	uint64_t filetime                                   = 0;
+	int64_t posix_time_in_nano_seconds                  = 0;
+	DWORD error_code                                    = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_elements->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC and the FILETIME
+	 * is in intervals of 100 nano seconds
+	 */
+	filetime = (uint64_t) ( ( posix_time_in_nano_seconds / 100 ) + 116444736000000000LL );
+
+	utc_filetime.dwLowDateTime  = (DWORD) ( filetime & 0xffffffffUL );
+	utc_filetime.dwHighDateTime = (DWORD) ( filetime >> 32 );
+
+	if( FileTimeToLocalFileTime(
+	     &utc_filetime,
 	     &( internal_elements->filetime ) ) == 0 )
 	{
 		error_code = GetLastError();
@@ -1841,35 +3694,280 @@ int libcdatetime_elements_set_current_time_utc(
 		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 error_code,
-		 "%s: unable to retrieve filetime.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve local filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( FileTimeToSystemTime(
+	     &( internal_elements->filetime ),
+	     &( internal_elements->systemtime ) ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve systemtime.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME;
+
+	return( 1 );
+}
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI set current time in localtime function for Windows NT4 or earlier NOT implemented yet
+
+#elif defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) )
+
+/* Sets the date and time elements to the current (system) date and time in localtime
+ * The current time is retrieved from the clock source of the elements
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_set_current_time_localtime(
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_set_current_time_localtime";
+	int64_t nano_seconds                                = 0;
+	int64_t number_of_seconds                           = 0;
+	int64_t posix_time_in_nano_seconds                  = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_elements->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = posix_time_in_nano_seconds / 1000000000LL;
+	nano_seconds      = posix_time_in_nano_seconds % 1000000000LL;
+
+	/* The fraction of a second is relative to the preceding second
+	 */
+	if( nano_seconds < 0 )
+	{
+		number_of_seconds -= 1;
+		nano_seconds      += 1000000000LL;
+	}
+	internal_elements->time = (time_t) number_of_seconds;
+
+	if( (int64_t) internal_elements->time != number_of_seconds )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_time_localtime(
+	     internal_elements,
+	     &( internal_elements->time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements->nano_seconds = (uint32_t) nano_seconds;
+	internal_elements->mode         = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME;
+
+	return( 1 );
+}
+
+#else
+#error Missing get current time in localtime function
+#endif
+
+/* Sets the date and time elements to the current (system) date and time in a timezone
+ * The current time is retrieved from the clock source of the elements
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_set_current_time_in_timezone(
+     libcdatetime_elements_t *elements,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_set_current_time_in_timezone";
+	int64_t posix_time_in_nano_seconds                  = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_elements->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_in_timezone(
+	     internal_elements,
+	     posix_time_in_nano_seconds,
+	     timezone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements in timezone.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts the date and time elements to the date and time in a timezone
+ * The date and time elements are converted from localtime to UTC if needed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_convert_to_timezone(
+     libcdatetime_elements_t *elements,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_convert_to_timezone";
+	int64_t posix_time_in_nano_seconds                  = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_get_posix_time_in_nano_seconds(
+	     internal_elements,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_in_timezone(
+	     internal_elements,
+	     posix_time_in_nano_seconds,
+	     timezone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements in timezone.",
 		 function );
 
 		return( -1 );
 	}
-	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC;
-
 	return( 1 );
 }
 
-#elif defined( WINAPI )
-
-/* TODO */
-#error WINAPI set current time in UTC function for Windows NT4 or earlier NOT implemented yet
-
-#elif defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) )
-
-/* Sets the date and time elements to the current (system) date and time in UTC
- * This function uses the POSIX time function or equivalent
+/* Sets the date and time elements to the current (system) date and time with a fixed UTC offset
+ * The UTC offset is in minutes and is added to UTC to obtain the date and time
+ * The current time is retrieved from the clock source of the elements
  * Returns 1 if successful or -1 on error
  */
-int libcdatetime_elements_set_current_time_utc(
+int libcdatetime_elements_set_current_time_with_utc_offset(
      libcdatetime_elements_t *elements,
+     int16_t utc_offset,
      libcerror_error_t **error )
 {
 	libcdatetime_internal_elements_t *internal_elements = NULL;
-	static char *function                               = "libcdatetime_elements_set_current_time_utc";
+	static char *function                               = "libcdatetime_elements_set_current_time_with_utc_offset";
+	int64_t posix_time_in_nano_seconds                  = 0;
 
 	if( elements == NULL )
 	{
@@ -1884,55 +3982,51 @@ int libcdatetime_elements_set_current_time_utc(
 	}
 	internal_elements = (libcdatetime_internal_elements_t *) elements;
 
-	if( time(
-	     &( internal_elements->time ) ) == (time_t) -1 )
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_elements->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 errno,
-		 "%s: unable to retrieve time.",
+		 "%s: unable to retrieve current time.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdatetime_internal_elements_set_from_time_utc(
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_fixed_utc_offset(
 	     internal_elements,
-	     &( internal_elements->time ),
+	     posix_time_in_nano_seconds,
+	     utc_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set time elements from time.",
+		 "%s: unable to set time elements with UTC offset.",
 		 function );
 
 		return( -1 );
 	}
-	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC;
-
 	return( 1 );
 }
 
-#else
-#error Missing get current time in UTC function
-#endif
-
-#if defined( WINAPI ) && ( WINVER >= 0x0500 )
-
-/* Sets the date and time elements to the current (system) date and time in localtime
- * This function uses the WINAPI function for Windows 2000 or later
+/* Converts the date and time elements to the date and time with a fixed UTC offset
+ * The UTC offset is in minutes and is added to UTC to obtain the date and time
+ * The date and time elements are converted from localtime to UTC if needed
  * Returns 1 if successful or -1 on error
  */
-int libcdatetime_elements_set_current_time_localtime(
+int libcdatetime_elements_convert_to_utc_offset(
      libcdatetime_elements_t *elements,
+     int16_t utc_offset,
      libcerror_error_t **error )
 {
 	libcdatetime_internal_elements_t *internal_elements = NULL;
-	static char *function                               = "libcdatetime_elements_set_current_time_localtime";
-	DWORD error_code                                    = 0;
+	static char *function                               = "libcdatetime_elements_convert_to_utc_offset";
+	int64_t posix_time_in_nano_seconds                  = 0;
 
 	if( elements == NULL )
 	{
@@ -1947,47 +4041,48 @@ int libcdatetime_elements_set_current_time_localtime(
 	}
 	internal_elements = (libcdatetime_internal_elements_t *) elements;
 
-	GetLocalTime(
-	 &( internal_elements->systemtime ) );
-
-	if( SystemTimeToFileTime(
-	     &( internal_elements->systemtime ),
-	     &( internal_elements->filetime ) ) == 0 )
+	if( libcdatetime_internal_elements_get_posix_time_in_nano_seconds(
+	     internal_elements,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 error_code,
-		 "%s: unable to retrieve filetime.",
+		 "%s: unable to retrieve POSIX time in nano seconds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME;
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_fixed_utc_offset(
+	     internal_elements,
+	     posix_time_in_nano_seconds,
+	     utc_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements with UTC offset.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
-#elif defined( WINAPI )
-
-/* TODO */
-#error WINAPI set current time in localtime function for Windows NT4 or earlier NOT implemented yet
-
-#elif defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) )
-
-/* Sets the date and time elements to the current (system) date and time in localtime
- * This function uses the POSIX time function or equivalent
- * Returns 1 if successful or -1 on error
+/* Retrieves the offset relative to UTC in minutes
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libcdatetime_elements_set_current_time_localtime(
+int libcdatetime_elements_get_utc_offset(
      libcdatetime_elements_t *elements,
+     int16_t *utc_offset,
      libcerror_error_t **error )
 {
 	libcdatetime_internal_elements_t *internal_elements = NULL;
-	static char *function                               = "libcdatetime_elements_set_current_time_localtime";
+	static char *function                               = "libcdatetime_elements_get_utc_offset";
 
 	if( elements == NULL )
 	{
@@ -2002,60 +4097,94 @@ int libcdatetime_elements_set_current_time_localtime(
 	}
 	internal_elements = (libcdatetime_internal_elements_t *) elements;
 
-	if( time(
-	     &( internal_elements->time ) ) == (time_t) -1 )
+	if( utc_offset == NULL )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 errno,
-		 "%s: unable to retrieve time.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTC offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdatetime_internal_elements_set_from_time_localtime(
-	     internal_elements,
-	     &( internal_elements->time ),
+	if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC )
+	{
+		*utc_offset = 0;
+	}
+	else if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_WITH_FIXED_UTC_OFFSET )
+	{
+		*utc_offset = internal_elements->fixed_utc_offset;
+	}
+	/* The UTC offset of a timezone can contain seconds, which cannot be represented in minutes
+	 */
+	else if( ( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_TIMEZONE )
+	      && ( ( internal_elements->utc_offset % 60 ) == 0 ) )
+	{
+		*utc_offset = (int16_t) ( internal_elements->utc_offset / 60 );
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the delta in seconds between the first and second date and time elements
+ * The number_of_seconds value with be negative if the first date and time
+ * pre-dates the second date and time, the fraction of a second is truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_get_delta_in_seconds(
+     libcdatetime_elements_t *first_elements,
+     libcdatetime_elements_t *second_elements,
+     int64_t *number_of_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_elements_get_delta_in_seconds";
+	int32_t nano_seconds  = 0;
+
+	if( libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	     first_elements,
+	     second_elements,
+	     number_of_seconds,
+	     &nano_seconds,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set time elements from time.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve delta.",
 		 function );
 
 		return( -1 );
 	}
-	internal_elements->mode = LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME;
-
 	return( 1 );
 }
 
-#else
-#error Missing get current time in localtime function
-#endif
-
 #if defined( WINAPI ) && ( WINVER >= 0x0500 )
 
-/* Determines the delta in seconds between the first and second date and time elements
+/* Determines the delta in seconds and the remaining fraction of a second
+ * in nano seconds between the first and second date and time elements
  * This function uses the WINAPI function for Windows 2000 or later
- * The number_of_seconds value with be negative if the first date and time
- * pre-dates the second date and time
+ * The number_of_seconds and nano_seconds values with be negative if the first
+ * date and time pre-dates the second date and time
  * Returns 1 if successful or -1 on error
  */
-int libcdatetime_elements_get_delta_in_seconds(
+int libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
      libcdatetime_elements_t *first_elements,
      libcdatetime_elements_t *second_elements,
      int64_t *number_of_seconds,
+     int32_t *nano_seconds,
      libcerror_error_t **error )
 {
 	libcdatetime_internal_elements_t *internal_first_elements  = NULL;
 	libcdatetime_internal_elements_t *internal_second_elements = NULL;
-	static char *function                                      = "libcdatetime_elements_get_delta_in_seconds";
-	int64_t time_delta                                         = 0;
+	static char *function                                      = "libcdatetime_elements_get_delta_in_seconds_and_nano_seconds";
+	uint64_t first_filetime                                    = 0;
+	uint64_t second_filetime                                   = 0;
+	uint64_t time_delta                                        = 0;
 
 	if( first_elements == NULL )
 	{
@@ -2094,6 +4223,17 @@ int libcdatetime_elements_get_delta_in_seconds(
 
 		return( -1 );
 	}
+	if( nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nano seconds.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_first_elements->mode != internal_second_elements->mode )
 	{
 		libcerror_error_set(
@@ -2105,70 +4245,28 @@ int libcdatetime_elements_get_delta_in_seconds(
 
 		return( -1 );
 	}
-	time_delta = (int64_t) internal_first_elements->filetime.dwHighDateTime - (int64_t) internal_second_elements->filetime.dwHighDateTime;
+	first_filetime   = (uint64_t) internal_first_elements->filetime.dwHighDateTime << 32;
+	first_filetime  |= internal_first_elements->filetime.dwLowDateTime;
 
-	if( time_delta < 0 )
-	{
-		if( (uint64_t) -time_delta > (uint64_t) INT32_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	else
-	{
-		if( (uint64_t) time_delta > (uint64_t) INT64_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	time_delta <<= 32;
-
-	time_delta += (int64_t) internal_first_elements->filetime.dwLowDateTime - (int64_t) internal_second_elements->filetime.dwLowDateTime;
+	second_filetime  = (uint64_t) internal_second_elements->filetime.dwHighDateTime << 32;
+	second_filetime |= internal_second_elements->filetime.dwLowDateTime;
 
-	if( time_delta < 0 )
+	/* The FILETIME is in intervals of 100 nano seconds
+	 */
+	if( first_filetime >= second_filetime )
 	{
-		if( (uint64_t) -time_delta > (uint64_t) INT64_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
+		time_delta = first_filetime - second_filetime;
 
-			return( -1 );
-		}
+		*number_of_seconds = (int64_t) ( time_delta / 10000000UL );
+		*nano_seconds      = (int32_t) ( time_delta % 10000000UL ) * 100;
 	}
 	else
 	{
-		if( (uint64_t) time_delta > (uint64_t) INT64_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
+		time_delta = second_filetime - first_filetime;
 
-			return( -1 );
-		}
+		*number_of_seconds = -( (int64_t) ( time_delta / 10000000UL ) );
+		*nano_seconds      = -( (int32_t) ( time_delta % 10000000UL ) * 100 );
 	}
-	*number_of_seconds = (int64_t) time_delta / 10000000;
-
 	return( 1 );
 }
 
@@ -2179,21 +4277,24 @@ int libcdatetime_elements_get_delta_in_seconds(
 
 #else
 
-/* Determines the delta in seconds between the first and second date and time elements
- * The number_of_seconds value with be negative if the first date and time
- * pre-dates the second date and time
+/* Determines the delta in seconds and the remaining fraction of a second
+ * in nano seconds between the first and second date and time elements
+ * The number_of_seconds and nano_seconds values with be negative if the first
+ * date and time pre-dates the second date and time
  * Returns 1 if successful or -1 on error
  */
-int libcdatetime_elements_get_delta_in_seconds(
+int libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
      libcdatetime_elements_t *first_elements,
      libcdatetime_elements_t *second_elements,
      int64_t *number_of_seconds,
+     int32_t *nano_seconds,
      libcerror_error_t **error )
 {
 	libcdatetime_internal_elements_t *internal_first_elements  = NULL;
 	libcdatetime_internal_elements_t *internal_second_elements = NULL;
-	static char *function                                      = "libcdatetime_elements_get_delta_in_seconds";
-	time_t time_delta                                          = 0;
+	static char *function                                      = "libcdatetime_elements_get_delta_in_seconds_and_nano_seconds";
+	int64_t nano_seconds_delta                                 = 0;
+	int64_t seconds_delta                                      = 0;
 
 	if( first_elements == NULL )
 	{
@@ -2206,69 +4307,161 @@ int libcdatetime_elements_get_delta_in_seconds(
 
 		return( -1 );
 	}
-	internal_first_elements = (libcdatetime_internal_elements_t *) first_elements;
-
-	if( second_elements == NULL )
+	internal_first_elements = (libcdatetime_internal_elements_t *) first_elements;
+
+	if( second_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_second_elements = (libcdatetime_internal_elements_t *) second_elements;
+
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The time_t can be 64-bit hence the delta can overflow
+	 */
+	if( ( ( internal_second_elements->time > 0 )
+	  && ( (int64_t) internal_first_elements->time < ( (int64_t) INT64_MIN + (int64_t) internal_second_elements->time ) ) )
+	 || ( ( internal_second_elements->time < 0 )
+	  && ( (int64_t) internal_first_elements->time > ( (int64_t) INT64_MAX + (int64_t) internal_second_elements->time ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time delta value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	seconds_delta      = (int64_t) internal_first_elements->time - (int64_t) internal_second_elements->time;
+	nano_seconds_delta = (int64_t) internal_first_elements->nano_seconds - (int64_t) internal_second_elements->nano_seconds;
+
+	/* Make sure the fraction has the same sign as the seconds
+	 */
+	if( ( seconds_delta > 0 )
+	 && ( nano_seconds_delta < 0 ) )
+	{
+		seconds_delta      -= 1;
+		nano_seconds_delta += 1000000000LL;
+	}
+	else if( ( seconds_delta < 0 )
+	      && ( nano_seconds_delta > 0 ) )
+	{
+		seconds_delta      += 1;
+		nano_seconds_delta -= 1000000000LL;
+	}
+	*number_of_seconds = seconds_delta;
+	*nano_seconds      = (int32_t) nano_seconds_delta;
+
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+/* Determines the delta in nano seconds between the first and second date and time elements
+ * The number_of_nano_seconds value with be negative if the first date and time
+ * pre-dates the second date and time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_get_delta_in_nano_seconds(
+     libcdatetime_elements_t *first_elements,
+     libcdatetime_elements_t *second_elements,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcdatetime_elements_get_delta_in_nano_seconds";
+	int64_t number_of_seconds = 0;
+	int32_t nano_seconds      = 0;
+
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	     first_elements,
+	     second_elements,
+	     &number_of_seconds,
+	     &nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve delta.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_seconds > ( (int64_t) INT64_MAX / 1000000000LL ) )
+	 || ( number_of_seconds < ( (int64_t) INT64_MIN / 1000000000LL ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid second elements.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time delta value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_second_elements = (libcdatetime_internal_elements_t *) second_elements;
+	number_of_seconds *= 1000000000LL;
 
-	if( number_of_seconds == NULL )
+	/* The fraction has the same sign as the seconds
+	 */
+	if( ( ( nano_seconds > 0 )
+	  && ( number_of_seconds > ( (int64_t) INT64_MAX - nano_seconds ) ) )
+	 || ( ( nano_seconds < 0 )
+	  && ( number_of_seconds < ( (int64_t) INT64_MIN - nano_seconds ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of seconds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time delta value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	time_delta = internal_first_elements->time - internal_second_elements->time;
-
-	if( time_delta < 0 )
-	{
-		if( (uint64_t) -time_delta > (uint64_t) INT64_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	else
-	{
-		if( (uint64_t) time_delta > (uint64_t) INT64_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	*number_of_seconds = (int64_t) time_delta;
+	*number_of_nano_seconds = number_of_seconds + nano_seconds;
 
 	return( 1 );
 }
 
-#endif
-
 #if defined( WINAPI ) && ( WINVER >= 0x0500 )
 
 /* Sets the time elements from the delta in seconds
@@ -2384,6 +4577,252 @@ int libcdatetime_elements_set_from_delta_in_seconds(
 
 #endif
 
+/* Copies the date and time elements to a timestamp
+ * Date and time elements in localtime are converted to UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_copy_to_timestamp(
+     libcdatetime_elements_t *elements,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_elements_copy_to_timestamp";
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_get_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_elements_t *) elements,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the date and time elements from an UTF-8 encoded string
+ * The entire string must consist of the date and time value, where the string
+ * size can include the end of string character
+ * The UTC offset of the string, such as +05:30, is retained as a fixed UTC offset
+ * A string without UTC offset or with an UTC offset of 0 is set in UTC
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_elements_copy_from_utf8_string(
+     libcdatetime_elements_t *elements,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_t date_time_values;
+
+	libcdatetime_internal_elements_t *internal_elements = NULL;
+	static char *function                               = "libcdatetime_elements_copy_from_utf8_string";
+	size_t parse_offset                                 = 0;
+	int64_t posix_time                                  = 0;
+	int64_t posix_time_in_nano_seconds                  = 0;
+	int parse_result                                    = 0;
+	int result                                          = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	internal_elements = (libcdatetime_internal_elements_t *) elements;
+
+	/* The syslog format does not contain a year, for which 1970 is assumed
+	 */
+	date_time_values.year = 1970;
+
+	result = libcdatetime_parse_utf8_string_to_date_time_values(
+	          utf8_string,
+	          utf8_string_size,
+	          string_format_flags,
+	          &date_time_values,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-8 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	/* The POSIX time is in UTC, hence retaining the UTC offset only requires it to be added back
+	 */
+	if( libcdatetime_date_time_values_get_posix_time(
+	     &date_time_values,
+	     &posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( posix_time > ( ( (int64_t) INT64_MAX / 1000000000LL ) - 1 ) )
+	 || ( posix_time < ( (int64_t) INT64_MIN / 1000000000LL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	posix_time_in_nano_seconds = ( posix_time * 1000000000LL ) + date_time_values.nano_seconds;
+
+	if( date_time_values.timezone_offset == 0 )
+	{
+		result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+		          internal_elements,
+		          posix_time_in_nano_seconds,
+		          error );
+	}
+	else
+	{
+		result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_fixed_utc_offset(
+		          internal_elements,
+		          posix_time_in_nano_seconds,
+		          date_time_values.timezone_offset,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset relative to UTC in seconds of date and time elements with an UTC offset
+ * Returns 1 if successful, 0 if the date and time elements have no UTC offset or -1 on error
+ */
+int libcdatetime_internal_elements_get_utc_offset_in_seconds(
+     libcdatetime_internal_elements_t *internal_elements,
+     int32_t *utc_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_internal_elements_get_utc_offset_in_seconds";
+
+	if( internal_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( utc_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTC offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_WITH_FIXED_UTC_OFFSET )
+	{
+		*utc_offset = (int32_t) internal_elements->fixed_utc_offset * 60;
+	}
+	else if( internal_elements->mode == LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_TIMEZONE )
+	{
+		*utc_offset = internal_elements->utc_offset;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Deterimes the size of the string for the date and time elements
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -2397,6 +4836,8 @@ int libcdatetime_elements_get_string_size(
 	static char *function       = "libcdatetime_elements_get_string_size";
 	uint32_t string_format_type = 0;
 	uint32_t supported_flags    = 0;
+	int32_t utc_offset          = 0;
+	int result                  = 0;
 
 	if( elements == NULL )
 	{
@@ -2513,6 +4954,22 @@ int libcdatetime_elements_get_string_size(
 	}
 	if( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR ) != 0 )
 	{
+		result = libcdatetime_internal_elements_get_utc_offset_in_seconds(
+		          (libcdatetime_internal_elements_t *) elements,
+		          &utc_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTC offset.",
+			 function );
+
+			return( -1 );
+		}
 		/* Example: UTC
 		 */
 		if( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_CTIME )
@@ -2521,10 +4978,24 @@ int libcdatetime_elements_get_string_size(
 		}
 		/* Example: Z
 		 */
-		else if( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 )
+		else if( ( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 )
+		      && ( result == 0 ) )
 		{
 			*string_size += 1;
 		}
+		if( result != 0 )
+		{
+			/* Example: +00:00
+			 */
+			*string_size += 6;
+
+			/* Example: +00:00:00
+			 */
+			if( ( utc_offset % 60 ) != 0 )
+			{
+				*string_size += 3;
+			}
+		}
 	}
 	return( 1 );
 }
@@ -2589,6 +5060,9 @@ int libcdatetime_elements_copy_to_string_with_index(
 	uint8_t minutes              = 0;
 	uint8_t month                = 0;
 	uint8_t seconds              = 0;
+	uint8_t utc_offset_sign      = 0;
+	int32_t utc_offset           = 0;
+	int result                   = 0;
 
 	if( elements == NULL )
 	{
@@ -3049,6 +5523,22 @@ int libcdatetime_elements_copy_to_string_with_index(
 	}
 	if( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR ) != 0 )
 	{
+		result = libcdatetime_internal_elements_get_utc_offset_in_seconds(
+		          (libcdatetime_internal_elements_t *) elements,
+		          &utc_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTC offset.",
+			 function );
+
+			return( -1 );
+		}
 		if( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_CTIME )
 		{
 			if( ( internal_string_index + 4 ) > string_size )
@@ -3067,7 +5557,8 @@ int libcdatetime_elements_copy_to_string_with_index(
 			string[ internal_string_index++ ] = (uint8_t) 'T';
 			string[ internal_string_index++ ] = (uint8_t) 'C';
 		}
-		else if( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 )
+		else if( ( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 )
+		      && ( result == 0 ) )
 		{
 			if( ( internal_string_index + 1 ) > string_size )
 			{
@@ -3082,6 +5573,57 @@ int libcdatetime_elements_copy_to_string_with_index(
 			}
 			string[ internal_string_index++ ] = (uint8_t) 'Z';
 		}
+		if( result != 0 )
+		{
+			if( utc_offset < 0 )
+			{
+				utc_offset_sign = (uint8_t) '-';
+				utc_offset      = -utc_offset;
+			}
+			else
+			{
+				utc_offset_sign = (uint8_t) '+';
+			}
+			if( ( internal_string_index + 6 ) > string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: string is too small.",
+				 function );
+
+				return( -1 );
+			}
+			/* Format: +##:## */
+			string[ internal_string_index++ ] = utc_offset_sign;
+			string[ internal_string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( utc_offset / 36000 ) % 10 );
+			string[ internal_string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( utc_offset / 3600 ) % 10 );
+			string[ internal_string_index++ ] = (uint8_t) ':';
+			string[ internal_string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( utc_offset / 600 ) % 6 );
+			string[ internal_string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( utc_offset / 60 ) % 10 );
+
+			/* The UTC offset of a timezone can contain seconds
+			 */
+			if( ( utc_offset % 60 ) != 0 )
+			{
+				if( ( internal_string_index + 3 ) > string_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: string is too small.",
+					 function );
+
+					return( -1 );
+				}
+				/* Format: :## */
+				string[ internal_string_index++ ] = (uint8_t) ':';
+				string[ internal_string_index++ ] = (uint8_t) '0' + (uint8_t) ( ( utc_offset / 10 ) % 6 );
+				string[ internal_string_index++ ] = (uint8_t) '0' + (uint8_t) ( utc_offset % 10 );
+			}
+		}
 	}
 	if( ( internal_string_index + 1 ) > string_size )
 	{
@@ -33,6 +33,8 @@
 #include <time.h>
 #endif /* !defined( WINAPI ) */
 
+#include "libcdatetime_clock.h"
+#include "libcdatetime_date_time_values.h"
 #include "libcdatetime_extern.h"
 #include "libcdatetime_libcerror.h"
 #include "libcdatetime_types.h"
@@ -46,8 +48,15 @@ enum LIBCDATETIME_ELEMENTS_MODES
 	LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_UTC,
 	LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_LOCALTIME,
 	LIBCDATETIME_ELEMENTS_MODE_DURATION,
+	LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_IN_TIMEZONE,
+	LIBCDATETIME_ELEMENTS_MODE_DATE_TIME_WITH_FIXED_UTC_OFFSET,
 };
 
+/* The range of fixed UTC offsets in minutes, which is -23:59 to +23:59
+ */
+#define LIBCDATETIME_ELEMENTS_MINIMUM_FIXED_UTC_OFFSET	-1439
+#define LIBCDATETIME_ELEMENTS_MAXIMUM_FIXED_UTC_OFFSET	1439
+
 typedef struct libcdatetime_internal_elements libcdatetime_internal_elements_t;
 
 struct libcdatetime_internal_elements
@@ -75,12 +84,28 @@ struct libcdatetime_internal_elements
 	 */
 	struct tm tm;
 
+	/* The fraction of a second in nano seconds
+	 */
+	uint32_t nano_seconds;
+
 #endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
 
 	/* Value to indicate how the time elements are used
 	 * e.g. to store a date time in UCT or localtime or a duration
 	 */
 	uint8_t mode;
+
+	/* The offset relative to UTC in seconds of a date time in a timezone
+	 */
+	int32_t utc_offset;
+
+	/* The offset relative to UTC in minutes of a date time with a fixed UTC offset
+	 */
+	int16_t fixed_utc_offset;
+
+	/* The clock settings
+	 */
+	libcdatetime_clock_settings_t clock_settings;
 };
 
 LIBCDATETIME_EXTERN \
@@ -203,6 +228,15 @@ int libcdatetime_internal_elements_set_from_time_utc(
 
 #endif /* !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) ) */
 
+#if !defined( WINAPI )
+
+int libcdatetime_internal_elements_set_tm_from_number_of_seconds(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t number_of_seconds,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
 #if !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) )
 
 int libcdatetime_internal_elements_set_from_time_localtime(
@@ -212,6 +246,66 @@ int libcdatetime_internal_elements_set_from_time_localtime(
 
 #endif /* !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) ) */
 
+int libcdatetime_internal_elements_set_from_date_time_values(
+     libcdatetime_internal_elements_t *internal_elements,
+     libcdatetime_date_time_values_t *date_time_values,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_localtime(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_utc_offset(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     int32_t utc_offset,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_fixed_utc_offset(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     int16_t utc_offset,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_in_timezone(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t posix_time_in_nano_seconds,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_elements_set_in_timezone_from_utc_elements(
+     libcdatetime_internal_elements_t *internal_elements,
+     const libcdatetime_internal_elements_t *utc_elements,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_elements_get_posix_time_in_nano_seconds(
+     libcdatetime_internal_elements_t *internal_elements,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_set_clock_source(
+     libcdatetime_elements_t *elements,
+     int clock_source,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_set_clock_callback(
+     libcdatetime_elements_t *elements,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
 LIBCDATETIME_EXTERN \
 int libcdatetime_elements_set_current_time_utc(
      libcdatetime_elements_t *elements,
@@ -222,6 +316,36 @@ int libcdatetime_elements_set_current_time_localtime(
      libcdatetime_elements_t *elements,
      libcerror_error_t **error );
 
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_set_current_time_in_timezone(
+     libcdatetime_elements_t *elements,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_convert_to_timezone(
+     libcdatetime_elements_t *elements,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_set_current_time_with_utc_offset(
+     libcdatetime_elements_t *elements,
+     int16_t utc_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_convert_to_utc_offset(
+     libcdatetime_elements_t *elements,
+     int16_t utc_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_get_utc_offset(
+     libcdatetime_elements_t *elements,
+     int16_t *utc_offset,
+     libcerror_error_t **error );
+
 LIBCDATETIME_EXTERN \
 int libcdatetime_elements_get_delta_in_seconds(
      libcdatetime_elements_t *first_elements,
@@ -229,12 +353,46 @@ int libcdatetime_elements_get_delta_in_seconds(
      int64_t *number_of_seconds,
      libcerror_error_t **error );
 
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+     libcdatetime_elements_t *first_elements,
+     libcdatetime_elements_t *second_elements,
+     int64_t *number_of_seconds,
+     int32_t *nano_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_get_delta_in_nano_seconds(
+     libcdatetime_elements_t *first_elements,
+     libcdatetime_elements_t *second_elements,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
 LIBCDATETIME_EXTERN \
 int libcdatetime_elements_set_from_delta_in_seconds(
      libcdatetime_elements_t *elements,
      int64_t number_of_seconds,
      libcerror_error_t **error );
 
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_copy_to_timestamp(
+     libcdatetime_elements_t *elements,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_elements_copy_from_utf8_string(
+     libcdatetime_elements_t *elements,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_elements_get_utc_offset_in_seconds(
+     libcdatetime_internal_elements_t *internal_elements,
+     int32_t *utc_offset,
+     libcerror_error_t **error );
+
 LIBCDATETIME_EXTERN \
 int libcdatetime_elements_get_string_size(
      libcdatetime_elements_t *elements,
@@ -0,0 +1,677 @@
+/*
+ * Date and time string format detector functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdatetime_date_time_values.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_elements.h"
+#include "libcdatetime_format_detector.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_support.h"
+#include "libcdatetime_types.h"
+
+/* Creates a format detector
+ * Make sure the value format_detector is referencing, is set to NULL
+ * The reference year is set to the current year in UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_format_detector_initialize(
+     libcdatetime_format_detector_t **format_detector,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_elements_t current_time;
+
+	libcdatetime_internal_format_detector_t *internal_format_detector = NULL;
+	static char *function                                             = "libcdatetime_format_detector_initialize";
+	uint16_t current_year                                             = 0;
+
+	if( format_detector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format detector.",
+		 function );
+
+		return( -1 );
+	}
+	if( *format_detector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid format detector value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &current_time,
+	     0,
+	     sizeof( libcdatetime_internal_elements_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_elements_set_current_time_utc(
+	     (libcdatetime_elements_t *) &current_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set current time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_elements_get_year(
+	     (libcdatetime_elements_t *) &current_time,
+	     &current_year,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current year.",
+		 function );
+
+		return( -1 );
+	}
+	internal_format_detector = memory_allocate_structure(
+	                            libcdatetime_internal_format_detector_t );
+
+	if( internal_format_detector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create format detector.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_format_detector,
+	     0,
+	     sizeof( libcdatetime_internal_format_detector_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear format detector.",
+		 function );
+
+		goto on_error;
+	}
+	internal_format_detector->reference_year = current_year;
+
+	*format_detector = (libcdatetime_format_detector_t *) internal_format_detector;
+
+	return( 1 );
+
+on_error:
+	if( internal_format_detector != NULL )
+	{
+		memory_free(
+		 internal_format_detector );
+	}
+	return( -1 );
+}
+
+/* Frees a format detector
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_format_detector_free(
+     libcdatetime_format_detector_t **format_detector,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_format_detector_t *internal_format_detector = NULL;
+	static char *function                                             = "libcdatetime_format_detector_free";
+
+	if( format_detector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format detector.",
+		 function );
+
+		return( -1 );
+	}
+	if( *format_detector != NULL )
+	{
+		internal_format_detector = (libcdatetime_internal_format_detector_t *) *format_detector;
+		*format_detector         = NULL;
+
+		memory_free(
+		 internal_format_detector );
+	}
+	return( 1 );
+}
+
+/* Sets the reference year
+ * The reference year is used for formats that do not contain a year, e.g. syslog
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_format_detector_set_reference_year(
+     libcdatetime_format_detector_t *format_detector,
+     uint16_t year,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_format_detector_t *internal_format_detector = NULL;
+	static char *function                                             = "libcdatetime_format_detector_set_reference_year";
+
+	if( format_detector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format detector.",
+		 function );
+
+		return( -1 );
+	}
+	internal_format_detector = (libcdatetime_internal_format_detector_t *) format_detector;
+
+	internal_format_detector->reference_year = year;
+
+	return( 1 );
+}
+
+/* Retrieves the string format flags the format detector is locked onto
+ * Returns 1 if successful, 0 if the format detector is not locked or -1 on error
+ */
+int libcdatetime_format_detector_get_string_format_flags(
+     libcdatetime_format_detector_t *format_detector,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_format_detector_t *internal_format_detector = NULL;
+	static char *function                                             = "libcdatetime_format_detector_get_string_format_flags";
+
+	if( format_detector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format detector.",
+		 function );
+
+		return( -1 );
+	}
+	internal_format_detector = (libcdatetime_internal_format_detector_t *) format_detector;
+
+	if( string_format_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string format flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_format_detector->is_locked == 0 )
+	{
+		return( 0 );
+	}
+	*string_format_flags = internal_format_detector->string_format_flags;
+
+	return( 1 );
+}
+
+/* Parses an UTF-8 encoded string into date and time values
+ * When the format detector is locked the string is parsed with the learned
+ * string format flags, otherwise the string format is detected per string.
+ * The format detector locks onto a string format after it was detected for
+ * LIBCDATETIME_FORMAT_DETECTOR_NUMBER_OF_MATCHES_TO_LOCK successive strings
+ * and unlocks when a string no longer matches.
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * no error is set in this case
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_internal_format_detector_parse_utf8_string(
+     libcdatetime_internal_format_detector_t *internal_format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcdatetime_date_time_values_t *date_time_values,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	static char *function        = "libcdatetime_internal_format_detector_parse_utf8_string";
+	uint32_t string_format_flags = 0;
+	int result                   = 0;
+
+	if( internal_format_detector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format detector.",
+		 function );
+
+		return( -1 );
+	}
+	if( date_time_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse result.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_format_detector->is_locked != 0 )
+	{
+		date_time_values->year = internal_format_detector->reference_year;
+
+		result = libcdatetime_parse_utf8_string_to_date_time_values(
+		          utf8_string,
+		          utf8_string_size,
+		          internal_format_detector->string_format_flags,
+		          date_time_values,
+		          parse_result,
+		          parse_offset,
+		          error );
+
+		if( result != 0 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse UTF-8 string.",
+				 function );
+			}
+			return( result );
+		}
+		internal_format_detector->is_locked         = 0;
+		internal_format_detector->number_of_matches = 0;
+	}
+	result = libcdatetime_detect_utf8_string_format(
+	          utf8_string,
+	          utf8_string_size,
+	          &string_format_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to detect string format.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*parse_result = LIBCDATETIME_PARSE_RESULT_UNSUPPORTED_FORMAT;
+		*parse_offset = 0;
+
+		internal_format_detector->number_of_matches = 0;
+
+		return( 0 );
+	}
+	date_time_values->year = internal_format_detector->reference_year;
+
+	result = libcdatetime_parse_utf8_string_to_date_time_values(
+	          utf8_string,
+	          utf8_string_size,
+	          string_format_flags,
+	          date_time_values,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		internal_format_detector->number_of_matches = 0;
+
+		return( 0 );
+	}
+	if( ( internal_format_detector->number_of_matches == 0 )
+	 || ( internal_format_detector->string_format_flags != string_format_flags ) )
+	{
+		internal_format_detector->string_format_flags = string_format_flags;
+		internal_format_detector->number_of_matches   = 1;
+	}
+	else if( internal_format_detector->number_of_matches < LIBCDATETIME_FORMAT_DETECTOR_NUMBER_OF_MATCHES_TO_LOCK )
+	{
+		internal_format_detector->number_of_matches += 1;
+	}
+	if( internal_format_detector->number_of_matches >= LIBCDATETIME_FORMAT_DETECTOR_NUMBER_OF_MATCHES_TO_LOCK )
+	{
+		internal_format_detector->is_locked = 1;
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-8 encoded string into date and time elements
+ * The date and time elements are set in UTC
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case, which makes skipping unparsable strings cheap
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_format_detector_parse_utf8_string_with_parse_result(
+     libcdatetime_format_detector_t *format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcdatetime_elements_t *elements,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libcdatetime_format_detector_parse_utf8_string_with_parse_result";
+	int result            = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdatetime_internal_format_detector_parse_utf8_string(
+	          (libcdatetime_internal_format_detector_t *) format_detector,
+	          utf8_string,
+	          utf8_string_size,
+	          &date_time_values,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_internal_elements_set_from_date_time_values(
+	     (libcdatetime_internal_elements_t *) elements,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements from date time values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-8 encoded string into date and time elements
+ * The date and time elements are set in UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_format_detector_parse_utf8_string(
+     libcdatetime_format_detector_t *format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_format_detector_parse_utf8_string";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_format_detector_parse_utf8_string_with_parse_result(
+	          format_detector,
+	          utf8_string,
+	          utf8_string_size,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-8 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-8 encoded string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case, which makes skipping unparsable strings cheap
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result(
+     libcdatetime_format_detector_t *format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result";
+	int result            = 0;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdatetime_internal_format_detector_parse_utf8_string(
+	          (libcdatetime_internal_format_detector_t *) format_detector,
+	          utf8_string,
+	          utf8_string_size,
+	          &date_time_values,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_date_time_values_get_posix_time(
+	     &date_time_values,
+	     posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-8 encoded string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_format_detector_parse_utf8_string_to_posix_time(
+     libcdatetime_format_detector_t *format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_format_detector_parse_utf8_string_to_posix_time";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result(
+	          format_detector,
+	          utf8_string,
+	          utf8_string_size,
+	          posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-8 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,135 @@
+/*
+ * Date and time string format detector functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_INTERNAL_FORMAT_DETECTOR_H )
+#define _LIBCDATETIME_INTERNAL_FORMAT_DETECTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_date_time_values.h"
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of successive strings with the same format after which
+ * the format detector locks onto the format
+ */
+#define LIBCDATETIME_FORMAT_DETECTOR_NUMBER_OF_MATCHES_TO_LOCK	3
+
+typedef struct libcdatetime_internal_format_detector libcdatetime_internal_format_detector_t;
+
+struct libcdatetime_internal_format_detector
+{
+	/* The string format flags of the most recently detected format
+	 */
+	uint32_t string_format_flags;
+
+	/* The number of successive strings that matched the string format flags
+	 */
+	uint8_t number_of_matches;
+
+	/* Value to indicate the format detector is locked onto the string format flags
+	 */
+	uint8_t is_locked;
+
+	/* The year used for formats that do not contain a year
+	 */
+	uint16_t reference_year;
+};
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_format_detector_initialize(
+     libcdatetime_format_detector_t **format_detector,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_format_detector_free(
+     libcdatetime_format_detector_t **format_detector,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_format_detector_set_reference_year(
+     libcdatetime_format_detector_t *format_detector,
+     uint16_t year,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_format_detector_get_string_format_flags(
+     libcdatetime_format_detector_t *format_detector,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_format_detector_parse_utf8_string(
+     libcdatetime_internal_format_detector_t *internal_format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcdatetime_date_time_values_t *date_time_values,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_format_detector_parse_utf8_string_with_parse_result(
+     libcdatetime_format_detector_t *format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcdatetime_elements_t *elements,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_format_detector_parse_utf8_string(
+     libcdatetime_format_detector_t *format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result(
+     libcdatetime_format_detector_t *format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_format_detector_parse_utf8_string_to_posix_time(
+     libcdatetime_format_detector_t *format_detector,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_INTERNAL_FORMAT_DETECTOR_H ) */
+
@@ -0,0 +1,695 @@
+/*
+ * Time-ordered identifier functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libcdatetime_elements.h"
+#include "libcdatetime_identifier.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_timestamp.h"
+#include "libcdatetime_types.h"
+
+/* The Crockford base32 characters used by ULID strings
+ */
+static const uint8_t libcdatetime_ulid_base32_characters[ 33 ] = \
+	"0123456789ABCDEFGHJKMNPQRSTVWXYZ";
+
+/* The values of the letters A to Z in ULID strings
+ * I and L are read as 1, O is read as 0 and U is not used
+ */
+static const uint8_t libcdatetime_ulid_base32_letter_values[ 26 ] = {
+	10, 11, 12, 13, 14, 15, 16, 17, 1, 18, 19, 1, 20,
+	21, 0, 22, 23, 24, 25, 26, 0xff, 27, 28, 29, 30, 31 };
+
+/* Retrieves the time of a UUID version 7 as the number of milli seconds since January 1, 1970 00:00:00 UTC
+ * The UUID data is stored in big-endian as defined by RFC 9562
+ * The UUID data can be a prefix of the UUID that contains at least the time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_uuidv7_get_posix_time_in_milli_seconds(
+     const uint8_t *uuid_data,
+     size_t uuid_data_size,
+     int64_t *posix_time_in_milli_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_uuidv7_get_posix_time_in_milli_seconds";
+	uint64_t value_64bit  = 0;
+
+	if( uuid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uuid_data_size < LIBCDATETIME_IDENTIFIER_TIME_DATA_SIZE )
+	 || ( uuid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_milli_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in milli seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The version is stored in the upper 4 bits of byte 6
+	 */
+	if( ( uuid_data_size > 6 )
+	 && ( ( uuid_data[ 6 ] >> 4 ) != 7 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UUID version: %" PRIu8 ".",
+		 function,
+		 uuid_data[ 6 ] >> 4 );
+
+		return( -1 );
+	}
+	/* The variant is stored in the upper 2 bits of byte 8
+	 */
+	if( ( uuid_data_size > 8 )
+	 && ( ( uuid_data[ 8 ] & 0xc0 ) != 0x80 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UUID variant.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint48_big_endian(
+	 uuid_data,
+	 value_64bit );
+
+	*posix_time_in_milli_seconds = (int64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Copies the time of a UUID version 7 to a timestamp
+ * The UUID data is stored in big-endian as defined by RFC 9562
+ * The UUID data can be a prefix of the UUID that contains at least the time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_uuidv7_copy_to_timestamp(
+     const uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcdatetime_uuidv7_copy_to_timestamp";
+	int64_t posix_time_in_milli_seconds = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_uuidv7_get_posix_time_in_milli_seconds(
+	     uuid_data,
+	     uuid_data_size,
+	     &posix_time_in_milli_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in milli seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A 48-bit number of milli seconds after April 11, 2262 does not fit
+	 * in a 64-bit number of nano seconds
+	 */
+	if( posix_time_in_milli_seconds > ( (int64_t) INT64_MAX / 1000000 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time in milli seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     posix_time_in_milli_seconds * 1000000,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the time of a UUID version 7 to date and time elements in UTC
+ * The UUID data is stored in big-endian as defined by RFC 9562
+ * The UUID data can be a prefix of the UUID that contains at least the time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_uuidv7_copy_to_elements(
+     const uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcdatetime_uuidv7_copy_to_elements";
+	int64_t posix_time_in_milli_seconds = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_uuidv7_get_posix_time_in_milli_seconds(
+	     uuid_data,
+	     uuid_data_size,
+	     &posix_time_in_milli_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in milli seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A 48-bit number of milli seconds after April 11, 2262 does not fit
+	 * in a 64-bit number of nano seconds
+	 */
+	if( posix_time_in_milli_seconds > ( (int64_t) INT64_MAX / 1000000 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time in milli seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	     (libcdatetime_internal_elements_t *) elements,
+	     posix_time_in_milli_seconds * 1000000,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the time of a ULID as the number of milli seconds since January 1, 1970 00:00:00 UTC
+ * The ULID data is stored in big-endian
+ * The ULID data can be a prefix of the ULID that contains at least the time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ulid_get_posix_time_in_milli_seconds(
+     const uint8_t *ulid_data,
+     size_t ulid_data_size,
+     int64_t *posix_time_in_milli_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_ulid_get_posix_time_in_milli_seconds";
+	uint64_t value_64bit  = 0;
+
+	if( ulid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ULID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ulid_data_size < LIBCDATETIME_IDENTIFIER_TIME_DATA_SIZE )
+	 || ( ulid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid ULID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_milli_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in milli seconds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint48_big_endian(
+	 ulid_data,
+	 value_64bit );
+
+	*posix_time_in_milli_seconds = (int64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Copies the time of a ULID to a timestamp
+ * The ULID data is stored in big-endian
+ * The ULID data can be a prefix of the ULID that contains at least the time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ulid_copy_to_timestamp(
+     const uint8_t *ulid_data,
+     size_t ulid_data_size,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcdatetime_ulid_copy_to_timestamp";
+	int64_t posix_time_in_milli_seconds = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_ulid_get_posix_time_in_milli_seconds(
+	     ulid_data,
+	     ulid_data_size,
+	     &posix_time_in_milli_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in milli seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A 48-bit number of milli seconds after April 11, 2262 does not fit
+	 * in a 64-bit number of nano seconds
+	 */
+	if( posix_time_in_milli_seconds > ( (int64_t) INT64_MAX / 1000000 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time in milli seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     posix_time_in_milli_seconds * 1000000,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the time of a ULID to date and time elements in UTC
+ * The ULID data is stored in big-endian
+ * The ULID data can be a prefix of the ULID that contains at least the time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ulid_copy_to_elements(
+     const uint8_t *ulid_data,
+     size_t ulid_data_size,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcdatetime_ulid_copy_to_elements";
+	int64_t posix_time_in_milli_seconds = 0;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_ulid_get_posix_time_in_milli_seconds(
+	     ulid_data,
+	     ulid_data_size,
+	     &posix_time_in_milli_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in milli seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A 48-bit number of milli seconds after April 11, 2262 does not fit
+	 * in a 64-bit number of nano seconds
+	 */
+	if( posix_time_in_milli_seconds > ( (int64_t) INT64_MAX / 1000000 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time in milli seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	     (libcdatetime_internal_elements_t *) elements,
+	     posix_time_in_milli_seconds * 1000000,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a ULID from an UTF-8 encoded Crockford base32 string
+ * The ULID data is stored in big-endian
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ulid_copy_from_utf8_string(
+     uint8_t *ulid_data,
+     size_t ulid_data_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcdatetime_ulid_copy_from_utf8_string";
+	size_t string_index     = 0;
+	uint64_t lower_64bits   = 0;
+	uint64_t upper_64bits   = 0;
+	uint8_t character       = 0;
+	uint8_t character_value = 0;
+
+	if( ulid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ULID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ulid_data_size < LIBCDATETIME_IDENTIFIER_DATA_SIZE )
+	 || ( ulid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid ULID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length != LIBCDATETIME_ULID_STRING_LENGTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < LIBCDATETIME_ULID_STRING_LENGTH;
+	     string_index++ )
+	{
+		character = utf8_string[ string_index ];
+
+		if( ( character >= (uint8_t) 'a' )
+		 && ( character <= (uint8_t) 'z' ) )
+		{
+			character -= (uint8_t) 'a' - (uint8_t) 'A';
+		}
+		if( ( character >= (uint8_t) '0' )
+		 && ( character <= (uint8_t) '9' ) )
+		{
+			character_value = character - (uint8_t) '0';
+		}
+		else if( ( character >= (uint8_t) 'A' )
+		      && ( character <= (uint8_t) 'Z' ) )
+		{
+			character_value = libcdatetime_ulid_base32_letter_values[ character - (uint8_t) 'A' ];
+		}
+		else
+		{
+			character_value = 0xff;
+		}
+		if( character_value == 0xff )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character: 0x%02" PRIx8 " at index: %" PRIzd ".",
+			 function,
+			 utf8_string[ string_index ],
+			 string_index );
+
+			return( -1 );
+		}
+		/* 26 characters of 5 bits contain 130 bits of which the upper 2 bits must be 0
+		 */
+		if( ( upper_64bits >> 59 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid ULID string value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		upper_64bits = ( upper_64bits << 5 ) | ( lower_64bits >> 59 );
+		lower_64bits = ( lower_64bits << 5 ) | character_value;
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 ulid_data,
+	 upper_64bits );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( ulid_data[ 8 ] ),
+	 lower_64bits );
+
+	return( 1 );
+}
+
+/* Copies a ULID to an UTF-8 encoded Crockford base32 string
+ * The ULID data is stored in big-endian
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ulid_copy_to_utf8_string(
+     const uint8_t *ulid_data,
+     size_t ulid_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_ulid_copy_to_utf8_string";
+	size_t string_index   = 0;
+	uint64_t lower_64bits = 0;
+	uint64_t upper_64bits = 0;
+
+	if( ulid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ULID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ulid_data_size < LIBCDATETIME_IDENTIFIER_DATA_SIZE )
+	 || ( ulid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid ULID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < ( LIBCDATETIME_ULID_STRING_LENGTH + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 ulid_data,
+	 upper_64bits );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( ulid_data[ 8 ] ),
+	 lower_64bits );
+
+	string_index = LIBCDATETIME_ULID_STRING_LENGTH;
+
+	utf8_string[ string_index ] = 0;
+
+	while( string_index > 0 )
+	{
+		string_index--;
+
+		utf8_string[ string_index ] = libcdatetime_ulid_base32_characters[ lower_64bits & 0x1f ];
+
+		lower_64bits   = ( lower_64bits >> 5 ) | ( upper_64bits << 59 );
+		upper_64bits >>= 5;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,113 @@
+/*
+ * Time-ordered identifier functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_IDENTIFIER_H )
+#define _LIBCDATETIME_IDENTIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a UUID version 7 or ULID
+ */
+#define LIBCDATETIME_IDENTIFIER_DATA_SIZE		16
+
+/* The size of the time prefix of a UUID version 7 or ULID
+ */
+#define LIBCDATETIME_IDENTIFIER_TIME_DATA_SIZE		6
+
+/* The number of characters of a ULID string
+ */
+#define LIBCDATETIME_ULID_STRING_LENGTH			26
+
+/* The largest number of milli seconds that fits in the time prefix
+ */
+#define LIBCDATETIME_IDENTIFIER_MAXIMUM_TIME		0xffffffffffffLL
+
+int libcdatetime_uuidv7_get_posix_time_in_milli_seconds(
+     const uint8_t *uuid_data,
+     size_t uuid_data_size,
+     int64_t *posix_time_in_milli_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_uuidv7_copy_to_timestamp(
+     const uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_uuidv7_copy_to_elements(
+     const uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+int libcdatetime_ulid_get_posix_time_in_milli_seconds(
+     const uint8_t *ulid_data,
+     size_t ulid_data_size,
+     int64_t *posix_time_in_milli_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ulid_copy_to_timestamp(
+     const uint8_t *ulid_data,
+     size_t ulid_data_size,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ulid_copy_to_elements(
+     const uint8_t *ulid_data,
+     size_t ulid_data_size,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ulid_copy_from_utf8_string(
+     uint8_t *ulid_data,
+     size_t ulid_data_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ulid_copy_to_utf8_string(
+     const uint8_t *ulid_data,
+     size_t ulid_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_IDENTIFIER_H ) */
+
@@ -0,0 +1,996 @@
+/*
+ * Time-ordered identifier generator functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <wincrypt.h>
+
+#else
+#if defined( HAVE_SYS_RANDOM_H )
+#include <sys/random.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+
+#endif /* defined( WINAPI ) */
+
+#include "libcdatetime_clock.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_identifier.h"
+#include "libcdatetime_identifier_generator.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+/* Creates a identifier generator
+ * Make sure the value identifier_generator is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_initialize(
+     libcdatetime_identifier_generator_t **identifier_generator,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_identifier_generator_t *internal_identifier_generator = NULL;
+	static char *function                                                       = "libcdatetime_identifier_generator_initialize";
+
+	if( identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_generator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid identifier generator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_identifier_generator = memory_allocate_structure(
+	                                 libcdatetime_internal_identifier_generator_t );
+
+	if( internal_identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifier generator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_identifier_generator,
+	     0,
+	     sizeof( libcdatetime_internal_identifier_generator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identifier generator.",
+		 function );
+
+		goto on_error;
+	}
+	/* Make sure the random data is retrieved on first use
+	 */
+	internal_identifier_generator->random_data_offset                 = LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE;
+	internal_identifier_generator->uuidv7_posix_time_in_milli_seconds = -1;
+	internal_identifier_generator->ulid_posix_time_in_milli_seconds   = -1;
+
+	*identifier_generator = (libcdatetime_identifier_generator_t *) internal_identifier_generator;
+
+	return( 1 );
+
+on_error:
+	if( internal_identifier_generator != NULL )
+	{
+		memory_free(
+		 internal_identifier_generator );
+	}
+	return( -1 );
+}
+
+/* Frees a identifier generator
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_free(
+     libcdatetime_identifier_generator_t **identifier_generator,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_identifier_generator_t *internal_identifier_generator = NULL;
+	static char *function                                                       = "libcdatetime_identifier_generator_free";
+
+	if( identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_generator != NULL )
+	{
+		internal_identifier_generator = (libcdatetime_internal_identifier_generator_t *) *identifier_generator;
+		*identifier_generator         = NULL;
+
+		memory_free(
+		 internal_identifier_generator );
+	}
+	return( 1 );
+}
+
+/* Sets the clock source of the identifier generator
+ * Setting the clock source to LIBCDATETIME_CLOCK_SOURCE_DEFAULT makes the timestamp
+ * generator use the clock source set for the process
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_set_clock_source(
+     libcdatetime_identifier_generator_t *identifier_generator,
+     int clock_source,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_identifier_generator_t *internal_identifier_generator = NULL;
+	static char *function                                                       = "libcdatetime_identifier_generator_set_clock_source";
+
+	if( identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_identifier_generator = (libcdatetime_internal_identifier_generator_t *) identifier_generator;
+
+	if( libcdatetime_clock_settings_set_clock_source(
+	     &( internal_identifier_generator->clock_settings ),
+	     clock_source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a callback function as the clock source of the identifier generator
+ * The callback function should retrieve the current time as the number
+ * of nano seconds since January 1, 1970 00:00:00 UTC and return 1 if
+ * successful or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_set_clock_callback(
+     libcdatetime_identifier_generator_t *identifier_generator,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_identifier_generator_t *internal_identifier_generator = NULL;
+	static char *function                                                       = "libcdatetime_identifier_generator_set_clock_callback";
+
+	if( identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_identifier_generator = (libcdatetime_internal_identifier_generator_t *) identifier_generator;
+
+	if( libcdatetime_clock_settings_set_clock_callback(
+	     &( internal_identifier_generator->clock_settings ),
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock callback.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Reads random data from the system
+ * This function uses the WINAPI cryptographic service provider
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_read_system_random_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	HCRYPTPROV provider_handle = 0;
+	static char *function      = "libcdatetime_identifier_generator_read_system_random_data";
+	DWORD error_code           = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( CryptAcquireContext(
+	     &provider_handle,
+	     NULL,
+	     NULL,
+	     PROV_RSA_FULL,
+	     CRYPT_VERIFYCONTEXT | CRYPT_SILENT ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to acquire cryptographic service provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( CryptGenRandom(
+	     provider_handle,
+	     (DWORD) data_size,
+	     (BYTE *) data ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve random data.",
+		 function );
+
+		CryptReleaseContext(
+		 provider_handle,
+		 0 );
+
+		return( -1 );
+	}
+	CryptReleaseContext(
+	 provider_handle,
+	 0 );
+
+	return( 1 );
+}
+
+#elif defined( HAVE_GETRANDOM )
+
+/* Reads random data from the system
+ * This function uses the POSIX getrandom function
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_read_system_random_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_identifier_generator_read_system_random_data";
+	size_t data_offset    = 0;
+	ssize_t read_count    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		read_count = getrandom(
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              0 );
+
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 errno,
+			 "%s: unable to retrieve random data.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += (size_t) read_count;
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H )
+
+/* Reads random data from the system
+ * This function reads from /dev/urandom
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_read_system_random_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_identifier_generator_read_system_random_data";
+	size_t data_offset    = 0;
+	ssize_t read_count    = 0;
+	int file_descriptor   = -1;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	file_descriptor = open(
+	                   "/dev/urandom",
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open: /dev/urandom.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		read_count = read(
+		              file_descriptor,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset );
+
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from: /dev/urandom.",
+			 function );
+
+			goto on_error;
+		}
+		else if( read_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from: /dev/urandom.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (size_t) read_count;
+	}
+	close(
+	 file_descriptor );
+
+	return( 1 );
+
+on_error:
+	close(
+	 file_descriptor );
+
+	return( -1 );
+}
+
+#else
+#error Missing read system random data function
+#endif /* defined( WINAPI ) */
+
+/* Retrieves random data of the identifier generator
+ * The random data is retrieved from the system in batches of
+ * LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_identifier_generator_get_random_data(
+     libcdatetime_internal_identifier_generator_t *internal_identifier_generator,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_internal_identifier_generator_get_random_data";
+
+	if( internal_identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_identifier_generator->random_data_offset > LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid identifier generator - random data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE - internal_identifier_generator->random_data_offset ) )
+	{
+		if( libcdatetime_identifier_generator_read_system_random_data(
+		     internal_identifier_generator->random_data,
+		     LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read random data from system.",
+			 function );
+
+			return( -1 );
+		}
+		internal_identifier_generator->random_data_offset = 0;
+	}
+	if( memory_copy(
+	     data,
+	     &( internal_identifier_generator->random_data[ internal_identifier_generator->random_data_offset ] ),
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy random data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure random data is never handed out twice
+	 */
+	if( memory_set(
+	     &( internal_identifier_generator->random_data[ internal_identifier_generator->random_data_offset ] ),
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear random data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_identifier_generator->random_data_offset += data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the current time of the identifier generator
+ * The current time is retrieved from the clock source of the identifier generator
+ * and rounded down to milli seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_identifier_generator_get_current_time(
+     libcdatetime_internal_identifier_generator_t *internal_identifier_generator,
+     int64_t *posix_time_in_milli_seconds,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_internal_identifier_generator_get_current_time";
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( internal_identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_milli_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in milli seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_identifier_generator->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The time prefix of an identifier cannot represent a date and time before
+	 * January 1, 1970 00:00:00 UTC
+	 */
+	if( posix_time_in_nano_seconds < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*posix_time_in_milli_seconds = posix_time_in_nano_seconds / 1000000;
+
+	return( 1 );
+}
+
+/* Retrieves the next UUID version 7 of the identifier generator
+ * The UUID data is stored in big-endian as defined by RFC 9562 so that
+ * the UUIDs sort in the order they were generated
+ * UUIDs generated in the same milli second are ordered by a 12-bit counter,
+ * that starts at a random value, in the rand_a field. The rand_b field
+ * contains random data. When the counter overflows or the clock goes
+ * backwards the time of the last UUID is advanced by a milli second
+ * The identifier generator is not thread-safe, use an identifier generator per thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_get_next_uuidv7(
+     libcdatetime_identifier_generator_t *identifier_generator,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t random_data[ 10 ];
+
+	libcdatetime_internal_identifier_generator_t *internal_identifier_generator = NULL;
+	static char *function                                                       = "libcdatetime_identifier_generator_get_next_uuidv7";
+	int64_t posix_time_in_milli_seconds                                         = 0;
+	uint16_t counter                                                            = 0;
+
+	if( identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_identifier_generator = (libcdatetime_internal_identifier_generator_t *) identifier_generator;
+
+	if( uuid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uuid_data_size < LIBCDATETIME_IDENTIFIER_DATA_SIZE )
+	 || ( uuid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_identifier_generator_get_current_time(
+	     internal_identifier_generator,
+	     &posix_time_in_milli_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_identifier_generator_get_random_data(
+	     internal_identifier_generator,
+	     random_data,
+	     10,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve random data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The counter starts with the upper bit cleared so that at least
+	 * 2048 UUIDs can be generated in the same milli second
+	 */
+	byte_stream_copy_to_uint16_big_endian(
+	 random_data,
+	 counter );
+
+	counter &= 0x07ff;
+
+	if( posix_time_in_milli_seconds <= internal_identifier_generator->uuidv7_posix_time_in_milli_seconds )
+	{
+		posix_time_in_milli_seconds = internal_identifier_generator->uuidv7_posix_time_in_milli_seconds;
+
+		if( internal_identifier_generator->uuidv7_counter < 0x0fff )
+		{
+			counter = internal_identifier_generator->uuidv7_counter + 1;
+		}
+		else
+		{
+			posix_time_in_milli_seconds += 1;
+		}
+	}
+	if( posix_time_in_milli_seconds > LIBCDATETIME_IDENTIFIER_MAXIMUM_TIME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time in milli seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint48_big_endian(
+	 uuid_data,
+	 posix_time_in_milli_seconds );
+
+	uuid_data[ 6 ] = (uint8_t) ( 0x70 | ( counter >> 8 ) );
+	uuid_data[ 7 ] = (uint8_t) ( counter & 0xff );
+	uuid_data[ 8 ] = (uint8_t) ( 0x80 | ( random_data[ 2 ] & 0x3f ) );
+
+	if( memory_copy(
+	     &( uuid_data[ 9 ] ),
+	     &( random_data[ 3 ] ),
+	     7 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy random data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_identifier_generator->uuidv7_posix_time_in_milli_seconds = posix_time_in_milli_seconds;
+	internal_identifier_generator->uuidv7_counter                     = counter;
+
+	return( 1 );
+}
+
+/* Retrieves the next ULID of the identifier generator
+ * The ULID data is stored in big-endian so that the ULIDs sort in the order
+ * they were generated
+ * ULIDs generated in the same milli second, or when the clock goes backwards,
+ * use the random part of the last ULID incremented by 1
+ * The identifier generator is not thread-safe, use an identifier generator per thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_identifier_generator_get_next_ulid(
+     libcdatetime_identifier_generator_t *identifier_generator,
+     uint8_t *ulid_data,
+     size_t ulid_data_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_identifier_generator_t *internal_identifier_generator = NULL;
+	static char *function                                                       = "libcdatetime_identifier_generator_get_next_ulid";
+	int64_t posix_time_in_milli_seconds                                         = 0;
+	int byte_index                                                              = 0;
+
+	if( identifier_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_identifier_generator = (libcdatetime_internal_identifier_generator_t *) identifier_generator;
+
+	if( ulid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ULID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ulid_data_size < LIBCDATETIME_IDENTIFIER_DATA_SIZE )
+	 || ( ulid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid ULID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_identifier_generator_get_current_time(
+	     internal_identifier_generator,
+	     &posix_time_in_milli_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_milli_seconds > LIBCDATETIME_IDENTIFIER_MAXIMUM_TIME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time in milli seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_milli_seconds > internal_identifier_generator->ulid_posix_time_in_milli_seconds )
+	{
+		if( libcdatetime_internal_identifier_generator_get_random_data(
+		     internal_identifier_generator,
+		     internal_identifier_generator->ulid_random_data,
+		     10,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve random data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_identifier_generator->ulid_posix_time_in_milli_seconds = posix_time_in_milli_seconds;
+	}
+	else
+	{
+		/* The random part cannot be incremented when all its bits are set
+		 */
+		for( byte_index = 0;
+		     byte_index < 10;
+		     byte_index++ )
+		{
+			if( internal_identifier_generator->ulid_random_data[ byte_index ] != 0xff )
+			{
+				break;
+			}
+		}
+		if( byte_index >= 10 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid ULID random data value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		for( byte_index = 9;
+		     byte_index >= 0;
+		     byte_index-- )
+		{
+			internal_identifier_generator->ulid_random_data[ byte_index ] += 1;
+
+			if( internal_identifier_generator->ulid_random_data[ byte_index ] != 0 )
+			{
+				break;
+			}
+		}
+		posix_time_in_milli_seconds = internal_identifier_generator->ulid_posix_time_in_milli_seconds;
+	}
+	byte_stream_copy_from_uint48_big_endian(
+	 ulid_data,
+	 posix_time_in_milli_seconds );
+
+	if( memory_copy(
+	     &( ulid_data[ 6 ] ),
+	     internal_identifier_generator->ulid_random_data,
+	     10 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy random data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
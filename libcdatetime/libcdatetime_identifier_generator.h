@@ -0,0 +1,135 @@
+/*
+ * Time-ordered identifier generator functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_IDENTIFIER_GENERATOR_H )
+#define _LIBCDATETIME_IDENTIFIER_GENERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_clock.h"
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the random data that is retrieved from the system at once
+ */
+#define LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE	512
+
+typedef struct libcdatetime_internal_identifier_generator libcdatetime_internal_identifier_generator_t;
+
+struct libcdatetime_internal_identifier_generator
+{
+	/* The random data
+	 */
+	uint8_t random_data[ LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE ];
+
+	/* The offset of the unused random data
+	 */
+	size_t random_data_offset;
+
+	/* The time of the last UUID version 7 as the number of milli seconds since January 1, 1970 00:00:00 UTC
+	 */
+	int64_t uuidv7_posix_time_in_milli_seconds;
+
+	/* The counter of the last UUID version 7
+	 */
+	uint16_t uuidv7_counter;
+
+	/* The time of the last ULID as the number of milli seconds since January 1, 1970 00:00:00 UTC
+	 */
+	int64_t ulid_posix_time_in_milli_seconds;
+
+	/* The random part of the last ULID
+	 */
+	uint8_t ulid_random_data[ 10 ];
+
+	/* The clock settings
+	 */
+	libcdatetime_clock_settings_t clock_settings;
+};
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_identifier_generator_initialize(
+     libcdatetime_identifier_generator_t **identifier_generator,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_identifier_generator_free(
+     libcdatetime_identifier_generator_t **identifier_generator,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_identifier_generator_set_clock_source(
+     libcdatetime_identifier_generator_t *identifier_generator,
+     int clock_source,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_identifier_generator_set_clock_callback(
+     libcdatetime_identifier_generator_t *identifier_generator,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+int libcdatetime_identifier_generator_read_system_random_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_identifier_generator_get_random_data(
+     libcdatetime_internal_identifier_generator_t *internal_identifier_generator,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_identifier_generator_get_current_time(
+     libcdatetime_internal_identifier_generator_t *internal_identifier_generator,
+     int64_t *posix_time_in_milli_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_identifier_generator_get_next_uuidv7(
+     libcdatetime_identifier_generator_t *identifier_generator,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_identifier_generator_get_next_ulid(
+     libcdatetime_identifier_generator_t *identifier_generator,
+     uint8_t *ulid_data,
+     size_t ulid_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_IDENTIFIER_GENERATOR_H ) */
+
@@ -0,0 +1,557 @@
+/*
+ * Monotonic timestamp functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdatetime_clock.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_monotonic_timestamp.h"
+#include "libcdatetime_timestamp.h"
+#include "libcdatetime_types.h"
+
+/* Creates a monotonic timestamp
+ * Make sure the value monotonic_timestamp is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_monotonic_timestamp_initialize(
+     libcdatetime_monotonic_timestamp_t **monotonic_timestamp,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_monotonic_timestamp_t *internal_monotonic_timestamp = NULL;
+	static char *function                                                     = "libcdatetime_monotonic_timestamp_initialize";
+
+	if( monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( *monotonic_timestamp != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid monotonic timestamp value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_monotonic_timestamp = memory_allocate_structure(
+	                                libcdatetime_internal_monotonic_timestamp_t );
+
+	if( internal_monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create monotonic timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_monotonic_timestamp,
+	     0,
+	     sizeof( libcdatetime_internal_monotonic_timestamp_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear monotonic timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	internal_monotonic_timestamp->clock_source = LIBCDATETIME_CLOCK_SOURCE_MONOTONIC;
+
+	*monotonic_timestamp = (libcdatetime_monotonic_timestamp_t *) internal_monotonic_timestamp;
+
+	return( 1 );
+
+on_error:
+	if( internal_monotonic_timestamp != NULL )
+	{
+		memory_free(
+		 internal_monotonic_timestamp );
+	}
+	return( -1 );
+}
+
+/* Frees a monotonic timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_monotonic_timestamp_free(
+     libcdatetime_monotonic_timestamp_t **monotonic_timestamp,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_monotonic_timestamp_t *internal_monotonic_timestamp = NULL;
+	static char *function                                                     = "libcdatetime_monotonic_timestamp_free";
+
+	if( monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( *monotonic_timestamp != NULL )
+	{
+		internal_monotonic_timestamp = (libcdatetime_internal_monotonic_timestamp_t *) *monotonic_timestamp;
+		*monotonic_timestamp         = NULL;
+
+		memory_free(
+		 internal_monotonic_timestamp );
+	}
+	return( 1 );
+}
+
+/* Copies the monotonic timestamp
+ * The reference, if captured, is copied as well
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_monotonic_timestamp_copy(
+     libcdatetime_monotonic_timestamp_t *destination_monotonic_timestamp,
+     const libcdatetime_monotonic_timestamp_t *source_monotonic_timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_monotonic_timestamp_copy";
+
+	if( destination_monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     destination_monotonic_timestamp,
+	     source_monotonic_timestamp,
+	     sizeof( libcdatetime_internal_monotonic_timestamp_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the clock source of the monotonic timestamp
+ * Setting the clock source to LIBCDATETIME_CLOCK_SOURCE_DEFAULT makes the monotonic
+ * timestamp use LIBCDATETIME_CLOCK_SOURCE_MONOTONIC
+ * Changing the clock source discards the current value and reference
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_monotonic_timestamp_set_clock_source(
+     libcdatetime_monotonic_timestamp_t *monotonic_timestamp,
+     int clock_source,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_monotonic_timestamp_t *internal_monotonic_timestamp = NULL;
+	static char *function                                                     = "libcdatetime_monotonic_timestamp_set_clock_source";
+
+	if( monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_monotonic_timestamp = (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp;
+
+	if( clock_source == LIBCDATETIME_CLOCK_SOURCE_DEFAULT )
+	{
+		clock_source = LIBCDATETIME_CLOCK_SOURCE_MONOTONIC;
+	}
+	if( ( clock_source != LIBCDATETIME_CLOCK_SOURCE_MONOTONIC )
+	 && ( clock_source != LIBCDATETIME_CLOCK_SOURCE_BOOTTIME ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported clock source: %d.",
+		 function,
+		 clock_source );
+
+		return( -1 );
+	}
+	if( internal_monotonic_timestamp->clock_source != clock_source )
+	{
+		internal_monotonic_timestamp->clock_source                         = clock_source;
+		internal_monotonic_timestamp->nano_seconds                         = 0;
+		internal_monotonic_timestamp->reference_nano_seconds               = 0;
+		internal_monotonic_timestamp->reference_posix_time_in_nano_seconds = 0;
+		internal_monotonic_timestamp->has_reference                        = 0;
+	}
+	return( 1 );
+}
+
+/* Captures the reference used to convert the monotonic timestamp into a wall clock time
+ * The reference pairs a reading of the monotonic clock with the current time
+ * of the clock source set for the process. The monotonic clock is read before
+ * and after the current time and the midpoint of both readings is used
+ * The reference should be recaptured when the system time was changed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_monotonic_timestamp_capture_reference(
+     libcdatetime_monotonic_timestamp_t *monotonic_timestamp,
+     libcerror_error_t **error )
+{
+	libcdatetime_clock_settings_t clock_settings;
+
+	libcdatetime_internal_monotonic_timestamp_t *internal_monotonic_timestamp = NULL;
+	static char *function                                                     = "libcdatetime_monotonic_timestamp_capture_reference";
+	int64_t first_nano_seconds                                                = 0;
+	int64_t posix_time_in_nano_seconds                                        = 0;
+	int64_t second_nano_seconds                                               = 0;
+
+	if( monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_monotonic_timestamp = (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp;
+
+	/* Clock settings with the default clock source use the clock source of the process
+	 */
+	if( memory_set(
+	     &clock_settings,
+	     0,
+	     sizeof( libcdatetime_clock_settings_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear clock settings.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_get_monotonic_time(
+	     internal_monotonic_timestamp->clock_source,
+	     &first_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first monotonic time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_settings_get_current_time(
+	     &clock_settings,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_get_monotonic_time(
+	     internal_monotonic_timestamp->clock_source,
+	     &second_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve second monotonic time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The monotonic time values are never negative
+	 */
+	internal_monotonic_timestamp->reference_nano_seconds               = first_nano_seconds + ( ( second_nano_seconds - first_nano_seconds ) / 2 );
+	internal_monotonic_timestamp->reference_posix_time_in_nano_seconds = posix_time_in_nano_seconds;
+	internal_monotonic_timestamp->has_reference                        = 1;
+
+	return( 1 );
+}
+
+/* Sets the monotonic timestamp to the current time of its clock source
+ * The reference is captured if the monotonic timestamp does not have one yet
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_monotonic_timestamp_set_current_time(
+     libcdatetime_monotonic_timestamp_t *monotonic_timestamp,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_monotonic_timestamp_t *internal_monotonic_timestamp = NULL;
+	static char *function                                                     = "libcdatetime_monotonic_timestamp_set_current_time";
+
+	if( monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_monotonic_timestamp = (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp;
+
+	if( internal_monotonic_timestamp->has_reference == 0 )
+	{
+		if( libcdatetime_monotonic_timestamp_capture_reference(
+		     monotonic_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to capture reference.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdatetime_clock_get_monotonic_time(
+	     internal_monotonic_timestamp->clock_source,
+	     &( internal_monotonic_timestamp->nano_seconds ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set current time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the delta in nano seconds between the first and second monotonic timestamp
+ * The number_of_nano_seconds value with be negative if the first monotonic timestamp
+ * pre-dates the second monotonic timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+     libcdatetime_monotonic_timestamp_t *first_monotonic_timestamp,
+     libcdatetime_monotonic_timestamp_t *second_monotonic_timestamp,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_monotonic_timestamp_t *internal_first_monotonic_timestamp  = NULL;
+	libcdatetime_internal_monotonic_timestamp_t *internal_second_monotonic_timestamp = NULL;
+	static char *function                                                            = "libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds";
+
+	if( first_monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_first_monotonic_timestamp = (libcdatetime_internal_monotonic_timestamp_t *) first_monotonic_timestamp;
+
+	if( second_monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_second_monotonic_timestamp = (libcdatetime_internal_monotonic_timestamp_t *) second_monotonic_timestamp;
+
+	if( internal_first_monotonic_timestamp->clock_source != internal_second_monotonic_timestamp->clock_source )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid second monotonic timestamp - clock source mismatch.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The monotonic time values are never negative hence the delta cannot overflow
+	 */
+	*number_of_nano_seconds = internal_first_monotonic_timestamp->nano_seconds - internal_second_monotonic_timestamp->nano_seconds;
+
+	return( 1 );
+}
+
+/* Copies the monotonic timestamp to a timestamp
+ * The wall clock time is determined relative to the reference of the monotonic timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_monotonic_timestamp_copy_to_timestamp(
+     libcdatetime_monotonic_timestamp_t *monotonic_timestamp,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_monotonic_timestamp_t *internal_monotonic_timestamp = NULL;
+	static char *function                                                     = "libcdatetime_monotonic_timestamp_copy_to_timestamp";
+	int64_t delta_in_nano_seconds                                             = 0;
+	int64_t posix_time_in_nano_seconds                                        = 0;
+
+	if( monotonic_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid monotonic timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_monotonic_timestamp = (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp;
+
+	if( internal_monotonic_timestamp->has_reference == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid monotonic timestamp - missing reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	/* The monotonic time values are never negative hence the delta cannot overflow
+	 */
+	delta_in_nano_seconds = internal_monotonic_timestamp->nano_seconds - internal_monotonic_timestamp->reference_nano_seconds;
+
+	if( ( ( delta_in_nano_seconds > 0 )
+	  && ( internal_monotonic_timestamp->reference_posix_time_in_nano_seconds > ( (int64_t) INT64_MAX - delta_in_nano_seconds ) ) )
+	 || ( ( delta_in_nano_seconds < 0 )
+	  && ( internal_monotonic_timestamp->reference_posix_time_in_nano_seconds < ( (int64_t) INT64_MIN - delta_in_nano_seconds ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid POSIX time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	posix_time_in_nano_seconds = internal_monotonic_timestamp->reference_posix_time_in_nano_seconds + delta_in_nano_seconds;
+
+	if( libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,111 @@
+/*
+ * Monotonic timestamp functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_MONOTONIC_TIMESTAMP_H )
+#define _LIBCDATETIME_MONOTONIC_TIMESTAMP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcdatetime_internal_monotonic_timestamp libcdatetime_internal_monotonic_timestamp_t;
+
+struct libcdatetime_internal_monotonic_timestamp
+{
+	/* The clock source
+	 */
+	int clock_source;
+
+	/* The number of nano seconds of the monotonic clock
+	 */
+	int64_t nano_seconds;
+
+	/* The number of nano seconds of the monotonic clock of the reference
+	 */
+	int64_t reference_nano_seconds;
+
+	/* The number of nano seconds since January 1, 1970 00:00:00 UTC of the reference
+	 */
+	int64_t reference_posix_time_in_nano_seconds;
+
+	/* Value to indicate the reference was captured
+	 */
+	uint8_t has_reference;
+};
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_monotonic_timestamp_initialize(
+     libcdatetime_monotonic_timestamp_t **monotonic_timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_monotonic_timestamp_free(
+     libcdatetime_monotonic_timestamp_t **monotonic_timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_monotonic_timestamp_copy(
+     libcdatetime_monotonic_timestamp_t *destination_monotonic_timestamp,
+     const libcdatetime_monotonic_timestamp_t *source_monotonic_timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_monotonic_timestamp_set_clock_source(
+     libcdatetime_monotonic_timestamp_t *monotonic_timestamp,
+     int clock_source,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_monotonic_timestamp_capture_reference(
+     libcdatetime_monotonic_timestamp_t *monotonic_timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_monotonic_timestamp_set_current_time(
+     libcdatetime_monotonic_timestamp_t *monotonic_timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+     libcdatetime_monotonic_timestamp_t *first_monotonic_timestamp,
+     libcdatetime_monotonic_timestamp_t *second_monotonic_timestamp,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_monotonic_timestamp_copy_to_timestamp(
+     libcdatetime_monotonic_timestamp_t *monotonic_timestamp,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_MONOTONIC_TIMESTAMP_H ) */
+
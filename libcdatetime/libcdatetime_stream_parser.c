@@ -0,0 +1,856 @@
+/*
+ * Date and time stream parser functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdatetime_date_time_values.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_elements.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_stream_parser.h"
+#include "libcdatetime_types.h"
+
+/* Determines if a byte is white space that separates date and time values
+ */
+#define libcdatetime_stream_parser_is_white_space( byte_value ) \
+	( ( byte_value == (uint8_t) ' ' ) \
+	 || ( byte_value == (uint8_t) '\t' ) \
+	 || ( byte_value == (uint8_t) '\n' ) \
+	 || ( byte_value == (uint8_t) '\r' ) )
+
+/* Creates a stream parser
+ * Make sure the value stream_parser is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_stream_parser_initialize(
+     libcdatetime_stream_parser_t **stream_parser,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                         = "libcdatetime_stream_parser_initialize";
+	uint32_t string_format_type                                   = 0;
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_parser != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream parser value already set.",
+		 function );
+
+		return( -1 );
+	}
+	string_format_type = string_format_flags & 0x000000ffUL;
+
+	if( ( ( string_format_type != LIBCDATETIME_STRING_FORMAT_TYPE_CTIME )
+	  &&  ( string_format_type != LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 ) )
+	 || ( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_DATE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_flags );
+
+		return( -1 );
+	}
+	internal_stream_parser = memory_allocate_structure(
+	                          libcdatetime_internal_stream_parser_t );
+
+	if( internal_stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream parser.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_stream_parser,
+	     0,
+	     sizeof( libcdatetime_internal_stream_parser_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream parser.",
+		 function );
+
+		goto on_error;
+	}
+	internal_stream_parser->string_format_flags = string_format_flags;
+
+	*stream_parser = (libcdatetime_stream_parser_t *) internal_stream_parser;
+
+	return( 1 );
+
+on_error:
+	if( internal_stream_parser != NULL )
+	{
+		memory_free(
+		 internal_stream_parser );
+	}
+	return( -1 );
+}
+
+/* Frees a stream parser
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_stream_parser_free(
+     libcdatetime_stream_parser_t **stream_parser,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                         = "libcdatetime_stream_parser_free";
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_parser != NULL )
+	{
+		internal_stream_parser = (libcdatetime_internal_stream_parser_t *) *stream_parser;
+		*stream_parser         = NULL;
+
+		memory_free(
+		 internal_stream_parser );
+	}
+	return( 1 );
+}
+
+/* Resets a stream parser
+ * Discards any pending data
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_stream_parser_reset(
+     libcdatetime_stream_parser_t *stream_parser,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                         = "libcdatetime_stream_parser_reset";
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = (libcdatetime_internal_stream_parser_t *) stream_parser;
+
+	internal_stream_parser->pending_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retains the pending data that follows a date and time value
+ * Leading white space is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_stream_parser_retain_pending_data(
+     libcdatetime_internal_stream_parser_t *internal_stream_parser,
+     size_t pending_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcdatetime_internal_stream_parser_retain_pending_data";
+	size_t pending_data_index = 0;
+
+	if( internal_stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( pending_data_offset > internal_stream_parser->pending_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pending data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( pending_data_offset < internal_stream_parser->pending_data_size )
+	{
+		if( !libcdatetime_stream_parser_is_white_space(
+		      internal_stream_parser->pending_data[ pending_data_offset ] ) )
+		{
+			break;
+		}
+		pending_data_offset++;
+	}
+	/* The pending data is moved to the start of the buffer, the regions
+	 * can overlap hence the data is copied per byte in forward order
+	 */
+	for( pending_data_index = pending_data_offset;
+	     pending_data_index < internal_stream_parser->pending_data_size;
+	     pending_data_index++ )
+	{
+		internal_stream_parser->pending_data[ pending_data_index - pending_data_offset ] = internal_stream_parser->pending_data[ pending_data_index ];
+	}
+	internal_stream_parser->pending_data_size -= pending_data_offset;
+
+	return( 1 );
+}
+
+/* Parses a date and time value from UTF-8 encoded data
+ * The data can be provided in successive buffers, where a date and time value
+ * is allowed to be split across buffers. The data offset is updated to point
+ * to the data following the date and time value, or to the end of the data
+ * if the buffer was consumed without completing a value
+ * White space that precedes a date and time value is skipped
+ *
+ * The parse result is set to LIBCDATETIME_PARSE_RESULT_SUCCESS if a value was parsed
+ * or to LIBCDATETIME_PARSE_RESULT_TRUNCATED if more data is needed
+ *
+ * If the data contains an invalid date and time value the parse result is set to
+ * one of the other LIBCDATETIME_PARSE_RESULTS values and the parse offset to the
+ * offset of the invalid data, where invalid data in previously buffered data is
+ * reported at the data offset. No error is created in this case. The pending data
+ * is discarded and the data offset is set to the first white space that follows
+ * the invalid data, or to the end of the data if there is none. Parsing can then
+ * be resumed by calling this function again with the updated data offset
+ *
+ * Returns 1 if successful, 0 if more data is needed or the data could not be parsed or -1 on error
+ */
+int libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+     libcdatetime_stream_parser_t *stream_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcdatetime_elements_t *elements,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+	libcdatetime_date_time_values_t date_time_values;
+
+	libcdatetime_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                         = "libcdatetime_stream_parser_parse_utf8_data_with_parse_result";
+	size_t copy_size                                              = 0;
+	size_t previous_pending_data_size                             = 0;
+	size_t safe_data_offset                                       = 0;
+	size_t string_index                                           = 0;
+	int result                                                    = 0;
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = (libcdatetime_internal_stream_parser_t *) stream_parser;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_offset > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse result.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	string.code_unit_size = 1;
+
+	if( internal_stream_parser->pending_data_size == 0 )
+	{
+		while( safe_data_offset < data_size )
+		{
+			if( !libcdatetime_stream_parser_is_white_space(
+			      data[ safe_data_offset ] ) )
+			{
+				break;
+			}
+			safe_data_offset++;
+		}
+		if( safe_data_offset >= data_size )
+		{
+			*data_offset  = safe_data_offset;
+			*parse_result = LIBCDATETIME_PARSE_RESULT_TRUNCATED;
+			*parse_offset = safe_data_offset;
+
+			return( 0 );
+		}
+		/* Parse the value directly from the buffer when no data is pending
+		 */
+		string.data  = data;
+		string.size  = data_size;
+		string_index = safe_data_offset;
+
+		result = libcdatetime_date_time_values_parse_string_with_index(
+		          &date_time_values,
+		          &string,
+		          &string_index,
+		          internal_stream_parser->string_format_flags,
+		          LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING,
+		          parse_result,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse date and time value at offset: %" PRIzd ".",
+			 function,
+			 safe_data_offset );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( *parse_result == LIBCDATETIME_PARSE_RESULT_TRUNCATED ) )
+		{
+			copy_size = data_size - safe_data_offset;
+
+			if( copy_size > LIBCDATETIME_STREAM_PARSER_MAXIMUM_PENDING_DATA_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid date and time value size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     internal_stream_parser->pending_data,
+			     &( data[ safe_data_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy pending data.",
+				 function );
+
+				return( -1 );
+			}
+			internal_stream_parser->pending_data_size = copy_size;
+
+			*data_offset  = data_size;
+			*parse_offset = data_size;
+
+			return( 0 );
+		}
+		else if( result == 0 )
+		{
+			/* Skip the invalid data up to the next white space
+			 */
+			*parse_offset    = string_index;
+			safe_data_offset = string_index;
+
+			while( safe_data_offset < data_size )
+			{
+				if( libcdatetime_stream_parser_is_white_space(
+				     data[ safe_data_offset ] ) )
+				{
+					break;
+				}
+				safe_data_offset++;
+			}
+			*data_offset = safe_data_offset;
+
+			return( 0 );
+		}
+		safe_data_offset = string_index;
+	}
+	else
+	{
+		/* Complete the pending value with the start of the buffer
+		 */
+		previous_pending_data_size = internal_stream_parser->pending_data_size;
+
+		copy_size = LIBCDATETIME_STREAM_PARSER_MAXIMUM_PENDING_DATA_SIZE - previous_pending_data_size;
+
+		if( copy_size > ( data_size - safe_data_offset ) )
+		{
+			copy_size = data_size - safe_data_offset;
+		}
+		if( copy_size > 0 )
+		{
+			if( memory_copy(
+			     &( internal_stream_parser->pending_data[ previous_pending_data_size ] ),
+			     &( data[ safe_data_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				return( -1 );
+			}
+			internal_stream_parser->pending_data_size += copy_size;
+		}
+		string.data  = internal_stream_parser->pending_data;
+		string.size  = internal_stream_parser->pending_data_size;
+		string_index = 0;
+
+		result = libcdatetime_date_time_values_parse_string_with_index(
+		          &date_time_values,
+		          &string,
+		          &string_index,
+		          internal_stream_parser->string_format_flags,
+		          LIBCDATETIME_DATE_TIME_VALUES_PARSE_FLAG_PARTIAL_STRING,
+		          parse_result,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse date and time value from pending data.",
+			 function );
+
+			internal_stream_parser->pending_data_size = 0;
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( *parse_result == LIBCDATETIME_PARSE_RESULT_TRUNCATED ) )
+		{
+			if( internal_stream_parser->pending_data_size >= LIBCDATETIME_STREAM_PARSER_MAXIMUM_PENDING_DATA_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid date and time value size value exceeds maximum.",
+				 function );
+
+				internal_stream_parser->pending_data_size = 0;
+
+				return( -1 );
+			}
+			*data_offset  = data_size;
+			*parse_offset = data_size;
+
+			return( 0 );
+		}
+		else if( result == 0 )
+		{
+			/* Skip the invalid data up to the next white space, where invalid data
+			 * in previously buffered data is reported at the start of the buffer
+			 */
+			if( string_index >= previous_pending_data_size )
+			{
+				*parse_offset = safe_data_offset + string_index - previous_pending_data_size;
+			}
+			else
+			{
+				*parse_offset = safe_data_offset;
+			}
+			while( string_index < internal_stream_parser->pending_data_size )
+			{
+				if( libcdatetime_stream_parser_is_white_space(
+				     internal_stream_parser->pending_data[ string_index ] ) )
+				{
+					break;
+				}
+				string_index++;
+			}
+			if( string_index < previous_pending_data_size )
+			{
+				/* The invalid data ended within previously buffered data, hence the data
+				 * that follows it remains pending and none of the buffer is consumed
+				 */
+				internal_stream_parser->pending_data_size = previous_pending_data_size;
+
+				if( libcdatetime_internal_stream_parser_retain_pending_data(
+				     internal_stream_parser,
+				     string_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to retain pending data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				safe_data_offset += string_index - previous_pending_data_size;
+
+				while( safe_data_offset < data_size )
+				{
+					if( libcdatetime_stream_parser_is_white_space(
+					     data[ safe_data_offset ] ) )
+					{
+						break;
+					}
+					safe_data_offset++;
+				}
+				internal_stream_parser->pending_data_size = 0;
+			}
+			*data_offset = safe_data_offset;
+
+			return( 0 );
+		}
+		if( string_index >= previous_pending_data_size )
+		{
+			safe_data_offset += string_index - previous_pending_data_size;
+
+			internal_stream_parser->pending_data_size = 0;
+		}
+		else
+		{
+			/* The value ended within previously buffered data, hence the data
+			 * that follows it remains pending and none of the buffer is consumed
+			 */
+			internal_stream_parser->pending_data_size = previous_pending_data_size;
+
+			if( libcdatetime_internal_stream_parser_retain_pending_data(
+			     internal_stream_parser,
+			     string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to retain pending data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libcdatetime_internal_elements_set_from_date_time_values(
+	     (libcdatetime_internal_elements_t *) elements,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements from date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	*data_offset  = safe_data_offset;
+	*parse_result = LIBCDATETIME_PARSE_RESULT_SUCCESS;
+	*parse_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Parses a date and time value from UTF-8 encoded data
+ * The data can be provided in successive buffers, where a date and time value
+ * is allowed to be split across buffers. The data offset is updated to point
+ * to the data following the date and time value, or to the end of the data
+ * if the buffer was consumed without completing a value
+ * White space that precedes a date and time value is skipped
+ *
+ * If the data contains an invalid date and time value an error is returned,
+ * the pending data is discarded and the data offset is set to the first white
+ * space that follows the invalid data, or to the end of the data if there is
+ * none. Parsing can then be resumed by calling this function again with the
+ * updated data offset
+ *
+ * Returns 1 if successful, 0 if more data is needed or -1 on error
+ */
+int libcdatetime_stream_parser_parse_utf8_data(
+     libcdatetime_stream_parser_t *stream_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_stream_parser_parse_utf8_data";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          data,
+	          data_size,
+	          data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      && ( parse_result != LIBCDATETIME_PARSE_RESULT_TRUNCATED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse date and time value, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Parses the pending data as a complete date and time value
+ * This function is intended to be called at the end of the stream
+ * Returns 1 if successful, 0 if no data is pending or -1 on error
+ */
+int libcdatetime_stream_parser_flush(
+     libcdatetime_stream_parser_t *stream_parser,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_t date_time_values;
+
+	libcdatetime_internal_stream_parser_t *internal_stream_parser = NULL;
+	static char *function                                         = "libcdatetime_stream_parser_flush";
+	size_t string_index                                           = 0;
+	int result                                                    = 0;
+
+	if( stream_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_parser = (libcdatetime_internal_stream_parser_t *) stream_parser;
+
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream_parser->pending_data_size == 0 )
+	{
+		return( 0 );
+	}
+	result = libcdatetime_date_time_values_copy_from_utf8_string_with_index(
+	          &date_time_values,
+	          internal_stream_parser->pending_data,
+	          internal_stream_parser->pending_data_size,
+	          &string_index,
+	          internal_stream_parser->string_format_flags,
+	          0,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: incomplete date and time value in pending data.",
+			 function );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse date and time value from pending data.",
+			 function );
+		}
+		internal_stream_parser->pending_data_size = 0;
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_stream_parser_retain_pending_data(
+	     internal_stream_parser,
+	     string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to retain pending data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_date_time_values(
+	     (libcdatetime_internal_elements_t *) elements,
+	     &date_time_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements from date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
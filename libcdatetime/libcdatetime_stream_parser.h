@@ -0,0 +1,112 @@
+/*
+ * Date and time stream parser functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_INTERNAL_STREAM_PARSER_H )
+#define _LIBCDATETIME_INTERNAL_STREAM_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of the data of a date and time value that can be buffered
+ * between calls, which is sufficient for the supported string formats
+ */
+#define LIBCDATETIME_STREAM_PARSER_MAXIMUM_PENDING_DATA_SIZE	64
+
+typedef struct libcdatetime_internal_stream_parser libcdatetime_internal_stream_parser_t;
+
+struct libcdatetime_internal_stream_parser
+{
+	/* The string format flags
+	 */
+	uint32_t string_format_flags;
+
+	/* The pending data
+	 * Contains the start of a date and time value of which the remainder
+	 * is expected in a subsequent buffer
+	 */
+	uint8_t pending_data[ LIBCDATETIME_STREAM_PARSER_MAXIMUM_PENDING_DATA_SIZE ];
+
+	/* The pending data size
+	 */
+	size_t pending_data_size;
+};
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_stream_parser_initialize(
+     libcdatetime_stream_parser_t **stream_parser,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_stream_parser_free(
+     libcdatetime_stream_parser_t **stream_parser,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_stream_parser_reset(
+     libcdatetime_stream_parser_t *stream_parser,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_stream_parser_retain_pending_data(
+     libcdatetime_internal_stream_parser_t *internal_stream_parser,
+     size_t pending_data_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+     libcdatetime_stream_parser_t *stream_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcdatetime_elements_t *elements,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_stream_parser_parse_utf8_data(
+     libcdatetime_stream_parser_t *stream_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_stream_parser_flush(
+     libcdatetime_stream_parser_t *stream_parser,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_INTERNAL_STREAM_PARSER_H ) */
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libcdatetime_date_time_values.h"
 #include "libcdatetime_definitions.h"
 #include "libcdatetime_libcerror.h"
 #include "libcdatetime_support.h"
@@ -250,3 +251,1512 @@ int libcdatetime_get_day_of_year(
 	return( 1 );
 }
 
+/* Determines the number of days between January 1, 1970 and the date
+ * The number of days is negative if the date pre-dates January 1, 1970
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_get_days_since_epoch(
+     int64_t *number_of_days,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day_of_month,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_get_days_since_epoch";
+	int64_t day_of_era    = 0;
+	int64_t day_of_year   = 0;
+	int64_t era           = 0;
+	int64_t safe_year     = 0;
+	int64_t year_of_era   = 0;
+	uint8_t days_in_month = 0;
+
+	if( number_of_days == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of days.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_get_days_in_month(
+	     &days_in_month,
+	     year,
+	     month,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve days in month.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( day_of_month == 0 )
+	 || ( day_of_month > days_in_month ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid day of month value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The calculation uses a year that starts on March 1 so that
+	 * the leap day is the last day of the year and eras of 400 years
+	 */
+	safe_year = (int64_t) year;
+
+	if( month <= 2 )
+	{
+		safe_year -= 1;
+	}
+	if( safe_year >= 0 )
+	{
+		era = safe_year / 400;
+	}
+	else
+	{
+		era = ( safe_year - 399 ) / 400;
+	}
+	year_of_era = safe_year - ( era * 400 );
+
+	if( month > 2 )
+	{
+		day_of_year = ( ( 153 * ( (int64_t) month - 3 ) ) + 2 ) / 5;
+	}
+	else
+	{
+		day_of_year = ( ( 153 * ( (int64_t) month + 9 ) ) + 2 ) / 5;
+	}
+	day_of_year += (int64_t) day_of_month - 1;
+
+	day_of_era = ( year_of_era * 365 ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) + day_of_year;
+
+	/* 719468 is the number of days between March 1, 0000 and January 1, 1970
+	 */
+	*number_of_days = ( era * 146097 ) + day_of_era - 719468;
+
+	return( 1 );
+}
+
+/* Determines the date of a number of days since January 1, 1970
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_get_date_values_from_days_since_epoch(
+     int64_t number_of_days,
+     uint16_t *year,
+     uint8_t *month,
+     uint8_t *day_of_month,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_get_date_values_from_days_since_epoch";
+	int64_t day_of_era    = 0;
+	int64_t day_of_year   = 0;
+	int64_t era           = 0;
+	int64_t month_of_year = 0;
+	int64_t safe_year     = 0;
+	int64_t year_of_era   = 0;
+
+	if( year == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid year.",
+		 function );
+
+		return( -1 );
+	}
+	if( month == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid month.",
+		 function );
+
+		return( -1 );
+	}
+	if( day_of_month == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid day of month.",
+		 function );
+
+		return( -1 );
+	}
+	/* The supported range is January 1, 0000 through December 31, 65535
+	 */
+	if( ( number_of_days < -719528 )
+	 || ( number_of_days > 23217003 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of days value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The calculation uses a year that starts on March 1, see
+	 * libcdatetime_get_days_since_epoch
+	 */
+	number_of_days += 719468;
+
+	if( number_of_days >= 0 )
+	{
+		era = number_of_days / 146097;
+	}
+	else
+	{
+		era = ( number_of_days - 146096 ) / 146097;
+	}
+	day_of_era  = number_of_days - ( era * 146097 );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( year_of_era * 365 ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+
+	month_of_year = ( ( 5 * day_of_year ) + 2 ) / 153;
+
+	*day_of_month = (uint8_t) ( day_of_year - ( ( ( 153 * month_of_year ) + 2 ) / 5 ) + 1 );
+
+	if( month_of_year < 10 )
+	{
+		*month = (uint8_t) ( month_of_year + 3 );
+	}
+	else
+	{
+		*month = (uint8_t) ( month_of_year - 9 );
+	}
+	safe_year = year_of_era + ( era * 400 );
+
+	if( *month <= 2 )
+	{
+		safe_year += 1;
+	}
+	*year = (uint16_t) safe_year;
+
+	return( 1 );
+}
+
+/* Parses a string into date and time values
+ * The entire string must consist of the date and time value, where the string
+ * size can include the end of string character
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_string_to_date_time_values(
+     const libcdatetime_date_time_values_string_t *string,
+     uint32_t string_format_flags,
+     libcdatetime_date_time_values_t *date_time_values,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t safe_string;
+
+	static char *function = "libcdatetime_parse_string_to_date_time_values";
+	size_t string_index   = 0;
+	int result            = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse result.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_string = *string;
+
+	if( ( safe_string.size > 0 )
+	 && ( safe_string.size <= (size_t) SSIZE_MAX )
+	 && ( libcdatetime_date_time_values_string_get_code_unit( &safe_string, safe_string.size - 1 ) == 0 ) )
+	{
+		safe_string.size -= 1;
+	}
+	result = libcdatetime_date_time_values_parse_string_with_index(
+	          date_time_values,
+	          &safe_string,
+	          &string_index,
+	          string_format_flags,
+	          0,
+	          parse_result,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( string_index == safe_string.size )
+		{
+			*parse_offset = 0;
+
+			return( 1 );
+		}
+		*parse_result = LIBCDATETIME_PARSE_RESULT_TRAILING_DATA;
+	}
+	*parse_offset = string_index;
+
+	return( 0 );
+}
+
+/* Parses an UTF-8 encoded string into date and time values
+ * The entire string must consist of the date and time value, where the string
+ * size can include the end of string character
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * no error is set in this case
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_utf8_string_to_date_time_values(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcdatetime_date_time_values_t *date_time_values,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_parse_utf8_string_to_date_time_values";
+	int result            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = utf8_string;
+	string.size           = utf8_string_size;
+	string.code_unit_size = 1;
+
+	result = libcdatetime_parse_string_to_date_time_values(
+	          &string,
+	          string_format_flags,
+	          date_time_values,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Parses a string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * no error is set in this case
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_string_to_posix_time_with_parse_result(
+     const libcdatetime_date_time_values_string_t *string,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libcdatetime_parse_string_to_posix_time_with_parse_result";
+	int result            = 0;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The syslog format does not contain a year, for which 1970 is assumed
+	 */
+	date_time_values.year = 1970;
+
+	result = libcdatetime_parse_string_to_date_time_values(
+	          string,
+	          string_format_flags,
+	          &date_time_values,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_date_time_values_get_posix_time(
+	     &date_time_values,
+	     posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses a string into a POSIX time value in nano seconds
+ * The POSIX time value contains the number of nano seconds since January 1, 1970 00:00:00 UTC
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * no error is set in this case
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_string_to_posix_time_in_nano_seconds_with_parse_result(
+     const libcdatetime_date_time_values_string_t *string,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_t date_time_values;
+
+	static char *function = "libcdatetime_parse_string_to_posix_time_in_nano_seconds_with_parse_result";
+	int64_t safe_time     = 0;
+	int result            = 0;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	/* The syslog format does not contain a year, for which 1970 is assumed
+	 */
+	date_time_values.year = 1970;
+
+	result = libcdatetime_parse_string_to_date_time_values(
+	          string,
+	          string_format_flags,
+	          &date_time_values,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_date_time_values_get_posix_time(
+	     &date_time_values,
+	     &safe_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	/* A 64-bit POSIX time in nano seconds can represent the years 1677 through 2262
+	 */
+	if( ( safe_time < -9223372036LL )
+	 || ( safe_time > 9223372035LL ) )
+	{
+		*parse_result = LIBCDATETIME_PARSE_RESULT_VALUE_OUT_OF_BOUNDS;
+		*parse_offset = 0;
+
+		return( 0 );
+	}
+	*posix_time = ( safe_time * 1000000000LL ) + date_time_values.nano_seconds;
+
+	return( 1 );
+}
+
+/* Parses an UTF-8 encoded string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case, which makes skipping unparsable strings cheap
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_parse_utf8_string_to_posix_time_with_parse_result";
+	int result            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = utf8_string;
+	string.size           = utf8_string_size;
+	string.code_unit_size = 1;
+
+	result = libcdatetime_parse_string_to_posix_time_with_parse_result(
+	          &string,
+	          string_format_flags,
+	          posix_time,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Parses an UTF-8 encoded string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_parse_utf8_string_to_posix_time(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_parse_utf8_string_to_posix_time";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          utf8_string,
+	          utf8_string_size,
+	          string_format_flags,
+	          posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-8 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-8 encoded string into a POSIX time value in nano seconds
+ * The POSIX time value contains the number of nano seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case, which makes skipping unparsable strings cheap
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result";
+	int result            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = utf8_string;
+	string.size           = utf8_string_size;
+	string.code_unit_size = 1;
+
+	result = libcdatetime_parse_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          &string,
+	          string_format_flags,
+	          posix_time,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Parses an UTF-8 encoded string into a POSIX time value in nano seconds
+ * The POSIX time value contains the number of nano seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          utf8_string,
+	          utf8_string_size,
+	          string_format_flags,
+	          posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-8 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-16 encoded string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case, which makes skipping unparsable strings cheap
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_utf16_string_to_posix_time_with_parse_result(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_parse_utf16_string_to_posix_time_with_parse_result";
+	int result            = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = (const uint8_t *) utf16_string;
+	string.size           = utf16_string_size;
+	string.code_unit_size = 2;
+
+	result = libcdatetime_parse_string_to_posix_time_with_parse_result(
+	          &string,
+	          string_format_flags,
+	          posix_time,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-16 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Parses an UTF-16 encoded string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_parse_utf16_string_to_posix_time(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_parse_utf16_string_to_posix_time";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_parse_utf16_string_to_posix_time_with_parse_result(
+	          utf16_string,
+	          utf16_string_size,
+	          string_format_flags,
+	          posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-16 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-16 encoded string into a POSIX time value in nano seconds
+ * The POSIX time value contains the number of nano seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case, which makes skipping unparsable strings cheap
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_utf16_string_to_posix_time_in_nano_seconds_with_parse_result(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_parse_utf16_string_to_posix_time_in_nano_seconds_with_parse_result";
+	int result            = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = (const uint8_t *) utf16_string;
+	string.size           = utf16_string_size;
+	string.code_unit_size = 2;
+
+	result = libcdatetime_parse_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          &string,
+	          string_format_flags,
+	          posix_time,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-16 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Parses an UTF-16 encoded string into a POSIX time value in nano seconds
+ * The POSIX time value contains the number of nano seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_parse_utf16_string_to_posix_time_in_nano_seconds(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_parse_utf16_string_to_posix_time_in_nano_seconds";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_parse_utf16_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          utf16_string,
+	          utf16_string_size,
+	          string_format_flags,
+	          posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-16 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-32 encoded string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case, which makes skipping unparsable strings cheap
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_utf32_string_to_posix_time_with_parse_result(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_parse_utf32_string_to_posix_time_with_parse_result";
+	int result            = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = (const uint8_t *) utf32_string;
+	string.size           = utf32_string_size;
+	string.code_unit_size = 4;
+
+	result = libcdatetime_parse_string_to_posix_time_with_parse_result(
+	          &string,
+	          string_format_flags,
+	          posix_time,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-32 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Parses an UTF-32 encoded string into a POSIX time value
+ * The POSIX time value contains the number of seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_parse_utf32_string_to_posix_time(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_parse_utf32_string_to_posix_time";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_parse_utf32_string_to_posix_time_with_parse_result(
+	          utf32_string,
+	          utf32_string_size,
+	          string_format_flags,
+	          posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-32 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Parses an UTF-32 encoded string into a POSIX time value in nano seconds
+ * The POSIX time value contains the number of nano seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * If the string cannot be parsed the parse result and parse offset are set,
+ * where the parse offset contains the offset of the first invalid character.
+ * No error is set in this case, which makes skipping unparsable strings cheap
+ * Returns 1 if successful, 0 if the string could not be parsed or -1 on error
+ */
+int libcdatetime_parse_utf32_string_to_posix_time_in_nano_seconds_with_parse_result(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_parse_utf32_string_to_posix_time_in_nano_seconds_with_parse_result";
+	int result            = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = (const uint8_t *) utf32_string;
+	string.size           = utf32_string_size;
+	string.code_unit_size = 4;
+
+	result = libcdatetime_parse_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          &string,
+	          string_format_flags,
+	          posix_time,
+	          parse_result,
+	          parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-32 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Parses an UTF-32 encoded string into a POSIX time value in nano seconds
+ * The POSIX time value contains the number of nano seconds since January 1, 1970 00:00:00 UTC
+ * The date and time elements are not used, the value is determined directly from the string
+ * For the syslog format, which does not contain a year, the year 1970 is assumed
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_parse_utf32_string_to_posix_time_in_nano_seconds(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_parse_utf32_string_to_posix_time_in_nano_seconds";
+	size_t parse_offset   = 0;
+	int parse_result      = 0;
+	int result            = 0;
+
+	result = libcdatetime_parse_utf32_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          utf32_string,
+	          utf32_string_size,
+	          string_format_flags,
+	          posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to parse UTF-32 string, parse result: %d at offset: %" PRIzd ".",
+		 function,
+		 parse_result,
+		 parse_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Detects the format of a date and time value in a string
+ * The format is determined from the first characters and the position of
+ * separators, the string is not validated. The string size can include
+ * the end of string character
+ * Returns 1 if successful, 0 if the format was not detected or -1 on error
+ */
+int libcdatetime_detect_string_format(
+     const libcdatetime_date_time_values_string_t *string,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function      = "libcdatetime_detect_string_format";
+	size_t string_size         = 0;
+	uint32_t safe_format_flags = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string->size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_format_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string format flags.",
+		 function );
+
+		return( -1 );
+	}
+	string_size = string->size;
+
+	if( ( string_size > 0 )
+	 && ( libcdatetime_date_time_values_string_get_code_unit( string, string_size - 1 ) == 0 ) )
+	{
+		string_size -= 1;
+	}
+	if( string_size < 2 )
+	{
+		if( ( string_size == 1 )
+		 && ( libcdatetime_date_time_values_string_get_code_unit( string, 0 ) >= (uint8_t) '0' )
+		 && ( libcdatetime_date_time_values_string_get_code_unit( string, 0 ) <= (uint8_t) '9' ) )
+		{
+			*string_format_flags = LIBCDATETIME_STRING_FORMAT_TYPE_POSIX_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME;
+
+			return( 1 );
+		}
+		return( 0 );
+	}
+	if( ( ( libcdatetime_date_time_values_string_get_code_unit( string, 0 ) >= (uint8_t) '0' )
+	  &&  ( libcdatetime_date_time_values_string_get_code_unit( string, 0 ) <= (uint8_t) '9' ) )
+	 || ( libcdatetime_date_time_values_string_get_code_unit( string, 0 ) == (uint8_t) '-' ) )
+	{
+		/* yyyy-mm-dd[Thh:mm:ss]
+		 */
+		if( ( string_size >= 10 )
+		 && ( libcdatetime_date_time_values_string_get_code_unit( string, 4 ) == (uint8_t) '-' )
+		 && ( libcdatetime_date_time_values_string_get_code_unit( string, 7 ) == (uint8_t) '-' ) )
+		{
+			safe_format_flags = LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE;
+
+			if( ( string_size >= 19 )
+			 && ( ( libcdatetime_date_time_values_string_get_code_unit( string, 10 ) == (uint8_t) 'T' )
+			  ||  ( libcdatetime_date_time_values_string_get_code_unit( string, 10 ) == (uint8_t) 't' )
+			  ||  ( libcdatetime_date_time_values_string_get_code_unit( string, 10 ) == (uint8_t) ' ' ) )
+			 && ( libcdatetime_date_time_values_string_get_code_unit( string, 13 ) == (uint8_t) ':' ) )
+			{
+				safe_format_flags |= LIBCDATETIME_STRING_FORMAT_FLAG_TIME;
+			}
+		}
+		/* d[d] mmm yyyy hh:mm
+		 */
+		else if( ( libcdatetime_date_time_values_string_get_code_unit( string, 0 ) != (uint8_t) '-' )
+		      && ( string_size >= 3 )
+		      && ( ( libcdatetime_date_time_values_string_get_code_unit( string, 1 ) == (uint8_t) ' ' )
+		       ||  ( libcdatetime_date_time_values_string_get_code_unit( string, 2 ) == (uint8_t) ' ' ) ) )
+		{
+			safe_format_flags = LIBCDATETIME_STRING_FORMAT_TYPE_RFC2822 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME;
+		}
+		else if( ( libcdatetime_date_time_values_string_get_code_unit( string, 1 ) >= (uint8_t) '0' )
+		      && ( libcdatetime_date_time_values_string_get_code_unit( string, 1 ) <= (uint8_t) '9' ) )
+		{
+			safe_format_flags = LIBCDATETIME_STRING_FORMAT_TYPE_POSIX_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME;
+		}
+	}
+	else if( ( libcdatetime_date_time_values_string_get_code_unit( string, 0 ) >= (uint8_t) 'A' )
+	      && ( libcdatetime_date_time_values_string_get_code_unit( string, 0 ) <= (uint8_t) 'Z' )
+	      && ( string_size >= 8 ) )
+	{
+		/* www, d[d] mmm yyyy hh:mm
+		 */
+		if( libcdatetime_date_time_values_string_get_code_unit( string, 3 ) == (uint8_t) ',' )
+		{
+			safe_format_flags = LIBCDATETIME_STRING_FORMAT_TYPE_RFC2822 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME;
+		}
+		else if( libcdatetime_date_time_values_string_get_code_unit( string, 3 ) == (uint8_t) ' ' )
+		{
+			/* mmm dd, yyyy[ hh:mm:ss]
+			 */
+			if( libcdatetime_date_time_values_string_get_code_unit( string, 6 ) == (uint8_t) ',' )
+			{
+				safe_format_flags = LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE;
+
+				if( ( string_size >= 21 )
+				 && ( libcdatetime_date_time_values_string_get_code_unit( string, 12 ) == (uint8_t) ' ' ) )
+				{
+					safe_format_flags |= LIBCDATETIME_STRING_FORMAT_FLAG_TIME;
+				}
+			}
+			/* www mmm dd hh:mm:ss yyyy
+			 */
+			else if( ( libcdatetime_date_time_values_string_get_code_unit( string, 4 ) >= (uint8_t) 'A' )
+			      && ( libcdatetime_date_time_values_string_get_code_unit( string, 4 ) <= (uint8_t) 'Z' ) )
+			{
+				safe_format_flags = LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME;
+			}
+			/* mmm dd hh:mm:ss
+			 */
+			else if( libcdatetime_date_time_values_string_get_code_unit( string, 6 ) == (uint8_t) ' ' )
+			{
+				safe_format_flags = LIBCDATETIME_STRING_FORMAT_TYPE_SYSLOG | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME;
+			}
+		}
+	}
+	if( safe_format_flags == 0 )
+	{
+		return( 0 );
+	}
+	*string_format_flags = safe_format_flags;
+
+	return( 1 );
+}
+
+/* Detects the format of a date and time value in an UTF-8 encoded string
+ * The format is determined from the first characters and the position of
+ * separators, the string is not validated. The string size can include
+ * the end of string character
+ * Returns 1 if successful, 0 if the format was not detected or -1 on error
+ */
+int libcdatetime_detect_utf8_string_format(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_detect_utf8_string_format";
+	int result            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = utf8_string;
+	string.size           = utf8_string_size;
+	string.code_unit_size = 1;
+
+	result = libcdatetime_detect_string_format(
+	          &string,
+	          string_format_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to detect format of UTF-8 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Detects the format of a date and time value in an UTF-16 encoded string
+ * The format is determined from the first characters and the position of
+ * separators, the string is not validated. The string size can include
+ * the end of string character
+ * Returns 1 if successful, 0 if the format was not detected or -1 on error
+ */
+int libcdatetime_detect_utf16_string_format(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_detect_utf16_string_format";
+	int result            = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = (const uint8_t *) utf16_string;
+	string.size           = utf16_string_size;
+	string.code_unit_size = 2;
+
+	result = libcdatetime_detect_string_format(
+	          &string,
+	          string_format_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to detect format of UTF-16 string.",
+		 function );
+	}
+	return( result );
+}
+
+/* Detects the format of a date and time value in an UTF-32 encoded string
+ * The format is determined from the first characters and the position of
+ * separators, the string is not validated. The string size can include
+ * the end of string character
+ * Returns 1 if successful, 0 if the format was not detected or -1 on error
+ */
+int libcdatetime_detect_utf32_string_format(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_date_time_values_string_t string;
+
+	static char *function = "libcdatetime_detect_utf32_string_format";
+	int result            = 0;
+
+	if( utf32_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-32 string.",
+		 function );
+
+		return( -1 );
+	}
+	string.data           = (const uint8_t *) utf32_string;
+	string.size           = utf32_string_size;
+	string.code_unit_size = 4;
+
+	result = libcdatetime_detect_string_format(
+	          &string,
+	          string_format_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to detect format of UTF-32 string.",
+		 function );
+	}
+	return( result );
+}
+
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libcdatetime_date_time_values.h"
 #include "libcdatetime_extern.h"
 #include "libcdatetime_libcerror.h"
 
@@ -56,6 +57,187 @@ int libcdatetime_get_day_of_year(
      uint8_t day_of_month,
      libcerror_error_t **error );
 
+int libcdatetime_get_days_since_epoch(
+     int64_t *number_of_days,
+     uint16_t year,
+     uint8_t month,
+     uint8_t day_of_month,
+     libcerror_error_t **error );
+
+int libcdatetime_get_date_values_from_days_since_epoch(
+     int64_t number_of_days,
+     uint16_t *year,
+     uint8_t *month,
+     uint8_t *day_of_month,
+     libcerror_error_t **error );
+
+int libcdatetime_parse_string_to_date_time_values(
+     const libcdatetime_date_time_values_string_t *string,
+     uint32_t string_format_flags,
+     libcdatetime_date_time_values_t *date_time_values,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+int libcdatetime_parse_utf8_string_to_date_time_values(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcdatetime_date_time_values_t *date_time_values,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+int libcdatetime_parse_string_to_posix_time_with_parse_result(
+     const libcdatetime_date_time_values_string_t *string,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+int libcdatetime_parse_string_to_posix_time_in_nano_seconds_with_parse_result(
+     const libcdatetime_date_time_values_string_t *string,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf8_string_to_posix_time(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf16_string_to_posix_time_with_parse_result(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf16_string_to_posix_time(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf16_string_to_posix_time_in_nano_seconds_with_parse_result(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf16_string_to_posix_time_in_nano_seconds(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf32_string_to_posix_time_with_parse_result(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf32_string_to_posix_time(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf32_string_to_posix_time_in_nano_seconds_with_parse_result(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     int *parse_result,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_parse_utf32_string_to_posix_time_in_nano_seconds(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t string_format_flags,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+int libcdatetime_detect_string_format(
+     const libcdatetime_date_time_values_string_t *string,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_detect_utf8_string_format(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_detect_utf16_string_format(
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_detect_utf32_string_format(
+     const uint32_t *utf32_string,
+     size_t utf32_string_size,
+     uint32_t *string_format_flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1025 @@
+/*
+ * System timezone functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_INOTIFY_H ) && !defined( WINAPI )
+#include <sys/inotify.h>
+#endif
+
+#if defined( HAVE_POLL_H ) && !defined( WINAPI )
+#include <poll.h>
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <sched.h>
+#endif
+
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_ERRNO_H ) && !defined( WINAPI )
+#include <errno.h>
+#endif
+
+#include "libcdatetime_atomic.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_system_timezone.h"
+#include "libcdatetime_timezone.h"
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+
+/* The changes of the directory that contains the localtime file that are watched,
+ * which include replacing the localtime file or its symbolic link
+ */
+#define LIBCDATETIME_SYSTEM_TIMEZONE_DIRECTORY_WATCH_MASK \
+	( IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE )
+
+/* The changes of the localtime file, or the target of its symbolic link, that are watched
+ */
+#define LIBCDATETIME_SYSTEM_TIMEZONE_FILE_WATCH_MASK \
+	( IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF )
+
+#endif /* defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+
+/* The system timezone used for conversions into localtime
+ * The system timezone is zero initialized, where a state of 0 corresponds
+ * with LIBCDATETIME_SYSTEM_TIMEZONE_STATE_NOT_READ. The watcher values are
+ * set when the watcher is started
+ */
+static libcdatetime_system_timezone_t libcdatetime_system_timezone_process_timezone = { 0 };
+
+/* Reads the system timezone
+ * The TZ value contains the value of the TZ environment variable or NULL if not set.
+ * A TZ value that starts with a '/' refers to a TZif file, other values refer to
+ * a named timezone in the zoneinfo directory or contain a POSIX TZ rule string.
+ * Without a TZ value the system timezone
+ * is read from LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH
+ * Returns 1 if successful, 0 if the system timezone is not available as TZif data or -1 on error
+ */
+int libcdatetime_system_timezone_read(
+     const char *tz_value,
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error )
+{
+	static char *function         = "libcdatetime_system_timezone_read";
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+	libcerror_error_t *read_error = NULL;
+	int result                    = 0;
+#endif
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timezone != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( tz_value != NULL )
+	{
+		/* A leading ':' indicates an implementation-defined value
+		 */
+		if( tz_value[ 0 ] == ':' )
+		{
+			tz_value++;
+		}
+		/* An empty TZ value indicates UTC, which is left to the C runtime
+		 */
+		if( tz_value[ 0 ] == 0 )
+		{
+			return( 0 );
+		}
+	}
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+	if( libcdatetime_timezone_initialize(
+	     timezone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timezone.",
+		 function );
+
+		goto on_error;
+	}
+	if( tz_value == NULL )
+	{
+		result = libcdatetime_timezone_read_file(
+		          *timezone,
+		          LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH,
+		          &read_error );
+	}
+	else if( tz_value[ 0 ] == '/' )
+	{
+		result = libcdatetime_timezone_read_file(
+		          *timezone,
+		          tz_value,
+		          &read_error );
+	}
+	else
+	{
+		result = libcdatetime_timezone_read_zoneinfo(
+		          *timezone,
+		          tz_value,
+		          &read_error );
+
+		/* A TZ value that does not refer to a named timezone can contain a POSIX TZ rule string
+		 */
+		if( result != 1 )
+		{
+			libcerror_error_free(
+			 &read_error );
+
+			if( libcdatetime_timezone_free(
+			     timezone,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free timezone.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdatetime_timezone_initialize(
+			     timezone,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create timezone.",
+				 function );
+
+				goto on_error;
+			}
+			result = libcdatetime_timezone_read_rule_string(
+			          *timezone,
+			          tz_value,
+			          narrow_string_length( tz_value ) + 1,
+			          &read_error );
+		}
+	}
+	/* A missing or unsupported file, or a TZ value that contains an unsupported
+	 * POSIX TZ rule string, is not considered an error
+	 */
+	if( result != 1 )
+	{
+		libcerror_error_free(
+		 &read_error );
+
+		if( libcdatetime_timezone_free(
+		     timezone,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free timezone.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( *timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 timezone,
+		 NULL );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+}
+
+/* Retrieves the system timezone
+ * The system timezone is read once and then published, after which it is
+ * shared by all threads without locking
+ * If successful the timezone must be released with libcdatetime_system_timezone_release_timezone,
+ * which allows the watcher to determine when a replaced timezone is no longer used
+ * Returns 1 if successful, 0 if the system timezone is not available or -1 on error
+ */
+int libcdatetime_system_timezone_get_timezone(
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_t *system_timezone = NULL;
+	static char *function                    = "libcdatetime_system_timezone_get_timezone";
+	uint32_t state                           = 0;
+	int result                               = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	state = libcdatetime_atomic_load_uint32(
+	         &( libcdatetime_system_timezone_process_timezone.state ) );
+
+	if( state == LIBCDATETIME_SYSTEM_TIMEZONE_STATE_NOT_READ )
+	{
+		/* Only a single thread reads the system timezone, other threads fall back
+		 * to the C runtime until the system timezone has been published
+		 */
+		if( libcdatetime_atomic_compare_and_swap_uint32(
+		     &( libcdatetime_system_timezone_process_timezone.state ),
+		     LIBCDATETIME_SYSTEM_TIMEZONE_STATE_NOT_READ,
+		     LIBCDATETIME_SYSTEM_TIMEZONE_STATE_READING ) != 0 )
+		{
+			result = libcdatetime_system_timezone_read(
+			          getenv( "TZ" ),
+			          &system_timezone,
+			          error );
+
+			if( result == 1 )
+			{
+				libcdatetime_atomic_store_pointer(
+				 &( libcdatetime_system_timezone_process_timezone.timezone ),
+				 system_timezone );
+
+				state = LIBCDATETIME_SYSTEM_TIMEZONE_STATE_READ;
+			}
+			else
+			{
+				state = LIBCDATETIME_SYSTEM_TIMEZONE_STATE_UNAVAILABLE;
+			}
+			libcdatetime_atomic_store_uint32(
+			 &( libcdatetime_system_timezone_process_timezone.state ),
+			 state );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read system timezone.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( state != LIBCDATETIME_SYSTEM_TIMEZONE_STATE_READ )
+	{
+		return( 0 );
+	}
+	/* The reader is registered before the timezone is retrieved, the full memory
+	 * barrier guarantees that the watcher either observes the reader or that
+	 * the reader retrieves the timezone published by the watcher
+	 */
+	libcdatetime_atomic_increment_uint32(
+	 &( libcdatetime_system_timezone_process_timezone.number_of_readers ) );
+
+	libcdatetime_atomic_thread_fence();
+
+	system_timezone = (libcdatetime_timezone_t *) libcdatetime_atomic_load_pointer(
+	                                               &( libcdatetime_system_timezone_process_timezone.timezone ) );
+
+	/* The watcher can make the system timezone unavailable after the state was retrieved
+	 */
+	if( system_timezone == NULL )
+	{
+		libcdatetime_atomic_decrement_uint32(
+		 &( libcdatetime_system_timezone_process_timezone.number_of_readers ) );
+
+		return( 0 );
+	}
+	*timezone = system_timezone;
+
+	return( 1 );
+}
+
+/* Releases a system timezone retrieved by libcdatetime_system_timezone_get_timezone
+ * The timezone should not be used after it was released
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_system_timezone_release_timezone(
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_system_timezone_release_timezone";
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timezone != NULL )
+	{
+		libcdatetime_atomic_decrement_uint32(
+		 &( libcdatetime_system_timezone_process_timezone.number_of_readers ) );
+
+		*timezone = NULL;
+	}
+	return( 1 );
+}
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+
+/* Frees the retired timezones if no thread uses a system timezone
+ * A thread that retrieves the system timezone after a timezone was retired
+ * cannot retrieve the retired timezone, hence if no thread uses a system
+ * timezone none of the retired timezones is used.
+ * This function is only called by the watcher thread or when the watcher is stopped
+ * Returns 1 if successful, 0 if the retired timezones can still be used or -1 on error
+ */
+int libcdatetime_system_timezone_free_retired_timezones(
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_system_timezone_free_retired_timezones";
+	int result            = 1;
+	int timezone_index    = 0;
+
+	/* The full memory barrier guarantees that a reader that is not observed
+	 * retrieves the timezone published before the retired timezones were retired
+	 */
+	libcdatetime_atomic_thread_fence();
+
+	if( libcdatetime_atomic_load_uint32(
+	     &( libcdatetime_system_timezone_process_timezone.number_of_readers ) ) != 0 )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_system_timezone_process_timezone.retired_timezones != NULL )
+	{
+		for( timezone_index = 0;
+		     timezone_index < libcdatetime_system_timezone_process_timezone.number_of_retired_timezones;
+		     timezone_index++ )
+		{
+			if( libcdatetime_timezone_free(
+			     &( libcdatetime_system_timezone_process_timezone.retired_timezones[ timezone_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free retired timezone: %d.",
+				 function,
+				 timezone_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 libcdatetime_system_timezone_process_timezone.retired_timezones );
+
+		libcdatetime_system_timezone_process_timezone.retired_timezones           = NULL;
+		libcdatetime_system_timezone_process_timezone.number_of_retired_timezones = 0;
+	}
+	return( result );
+}
+
+/* Rereads the system timezone from LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH and publishes it
+ * The timezone that was published before is retired, since other threads can still use it.
+ * Retired timezones are freed once no thread uses a system timezone.
+ * This function is only called by the watcher thread
+ * Returns 1 if successful, 0 if the system timezone is no longer available or -1 on error
+ */
+int libcdatetime_system_timezone_reload(
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_t **retired_timezones = NULL;
+	libcdatetime_timezone_t *previous_timezone  = NULL;
+	libcdatetime_timezone_t *system_timezone    = NULL;
+	static char *function                       = "libcdatetime_system_timezone_reload";
+	int number_of_retired_timezones             = 0;
+	int result                                  = 0;
+
+	number_of_retired_timezones = libcdatetime_system_timezone_process_timezone.number_of_retired_timezones;
+
+	if( number_of_retired_timezones >= (int) ( INT_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of retired timezones value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The space to retire the previous timezone is reserved in advance
+	 * so that publishing the system timezone cannot fail
+	 */
+	retired_timezones = (libcdatetime_timezone_t **) memory_reallocate(
+	                                                  libcdatetime_system_timezone_process_timezone.retired_timezones,
+	                                                  sizeof( libcdatetime_timezone_t * ) * ( number_of_retired_timezones + 1 ) );
+
+	if( retired_timezones == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize retired timezones.",
+		 function );
+
+		return( -1 );
+	}
+	libcdatetime_system_timezone_process_timezone.retired_timezones = retired_timezones;
+
+	result = libcdatetime_system_timezone_read(
+	          NULL,
+	          &system_timezone,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read system timezone.",
+		 function );
+
+		return( -1 );
+	}
+	previous_timezone = (libcdatetime_timezone_t *) libcdatetime_atomic_load_pointer(
+	                                                 &( libcdatetime_system_timezone_process_timezone.timezone ) );
+
+	/* The timezone is published before the state, so that a thread that
+	 * retrieves the state as read also retrieves the timezone
+	 */
+	if( result == 1 )
+	{
+		libcdatetime_atomic_store_pointer(
+		 &( libcdatetime_system_timezone_process_timezone.timezone ),
+		 system_timezone );
+
+		libcdatetime_atomic_store_uint32(
+		 &( libcdatetime_system_timezone_process_timezone.state ),
+		 LIBCDATETIME_SYSTEM_TIMEZONE_STATE_READ );
+	}
+	else
+	{
+		libcdatetime_atomic_store_uint32(
+		 &( libcdatetime_system_timezone_process_timezone.state ),
+		 LIBCDATETIME_SYSTEM_TIMEZONE_STATE_UNAVAILABLE );
+
+		libcdatetime_atomic_store_pointer(
+		 &( libcdatetime_system_timezone_process_timezone.timezone ),
+		 NULL );
+	}
+	if( previous_timezone != NULL )
+	{
+		retired_timezones[ number_of_retired_timezones ] = previous_timezone;
+
+		libcdatetime_system_timezone_process_timezone.number_of_retired_timezones += 1;
+	}
+	if( libcdatetime_system_timezone_free_retired_timezones(
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free retired timezones.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* The system timezone watcher thread start function
+ * Returns NULL
+ */
+void *libcdatetime_system_timezone_watcher_thread_start_function(
+       void *arguments )
+{
+	struct pollfd poll_descriptors[ 2 ];
+
+	/* The events data is aligned for the inotify_event structure
+	 */
+	uint64_t events_data[ 512 ];
+
+	libcdatetime_system_timezone_t *system_timezone = NULL;
+	struct inotify_event *event                     = NULL;
+	const char *file_name                           = NULL;
+	ssize_t read_count                              = 0;
+	size_t events_data_offset                       = 0;
+	size_t file_name_size                           = 0;
+	int file_watch_descriptor                       = 0;
+	int is_changed                                  = 0;
+	int result                                      = 0;
+
+	system_timezone = (libcdatetime_system_timezone_t *) arguments;
+
+	/* The file name is the part of the localtime path after the last separator
+	 */
+	file_name = narrow_string_search_character_reverse(
+	             LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH,
+	             (int) '/',
+	             narrow_string_length( LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH ) + 1 );
+
+	if( file_name == NULL )
+	{
+		return( NULL );
+	}
+	file_name     += 1;
+	file_name_size = narrow_string_length( file_name ) + 1;
+
+	do
+	{
+		poll_descriptors[ 0 ].fd      = system_timezone->notify_file_descriptor;
+		poll_descriptors[ 0 ].events  = POLLIN;
+		poll_descriptors[ 0 ].revents = 0;
+		poll_descriptors[ 1 ].fd      = system_timezone->stop_file_descriptors[ 0 ];
+		poll_descriptors[ 1 ].events  = POLLIN;
+		poll_descriptors[ 1 ].revents = 0;
+
+		result = poll(
+		          poll_descriptors,
+		          2,
+		          -1 );
+
+		if( result == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			break;
+		}
+		if( poll_descriptors[ 1 ].revents != 0 )
+		{
+			break;
+		}
+		if( ( poll_descriptors[ 0 ].revents & POLLIN ) == 0 )
+		{
+			break;
+		}
+		read_count = read(
+		              system_timezone->notify_file_descriptor,
+		              (void *) events_data,
+		              sizeof( events_data ) );
+
+		if( read_count <= 0 )
+		{
+			if( ( read_count == -1 )
+			 && ( errno == EINTR ) )
+			{
+				continue;
+			}
+			break;
+		}
+		is_changed         = 0;
+		events_data_offset = 0;
+
+		while( ( events_data_offset + sizeof( struct inotify_event ) ) <= (size_t) read_count )
+		{
+			event = (struct inotify_event *) &( ( (uint8_t *) events_data )[ events_data_offset ] );
+
+			if( event->wd == system_timezone->file_watch_descriptor )
+			{
+				is_changed = 1;
+			}
+			else if( ( event->wd == system_timezone->directory_watch_descriptor )
+			      && ( event->len >= file_name_size )
+			      && ( narrow_string_compare(
+			            event->name,
+			            file_name,
+			            file_name_size ) == 0 ) )
+			{
+				is_changed = 1;
+			}
+			events_data_offset += sizeof( struct inotify_event ) + event->len;
+		}
+		if( is_changed == 0 )
+		{
+			continue;
+		}
+		/* Errors are ignored, the previous system timezone remains available
+		 */
+		libcdatetime_system_timezone_reload(
+		 NULL );
+
+		/* The localtime file or the target of its symbolic link can have been
+		 * replaced, hence the watch is moved to the current file
+		 */
+		file_watch_descriptor = inotify_add_watch(
+		                         system_timezone->notify_file_descriptor,
+		                         LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH,
+		                         LIBCDATETIME_SYSTEM_TIMEZONE_FILE_WATCH_MASK );
+
+		if( ( system_timezone->file_watch_descriptor != -1 )
+		 && ( system_timezone->file_watch_descriptor != file_watch_descriptor ) )
+		{
+			inotify_rm_watch(
+			 system_timezone->notify_file_descriptor,
+			 system_timezone->file_watch_descriptor );
+		}
+		system_timezone->file_watch_descriptor = file_watch_descriptor;
+	}
+	while( 1 );
+
+	return( NULL );
+}
+
+#endif /* defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+
+/* Starts watching the system timezone for changes
+ * The watcher thread rereads the system timezone when LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH,
+ * or the target of its symbolic link, changes and publishes it without blocking other threads.
+ * This function is not thread-safe
+ * Returns 1 if successful, 0 if the system timezone is determined by the TZ environment variable or -1 on error
+ */
+int libcdatetime_start_system_timezone_watcher(
+     libcerror_error_t **error )
+{
+	static char *function                    = "libcdatetime_start_system_timezone_watcher";
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+	libcdatetime_timezone_t *system_timezone = NULL;
+	char *directory_path                     = NULL;
+	const char *last_separator               = NULL;
+	size_t directory_path_length             = 0;
+	size_t path_length                       = 0;
+	uint32_t state                           = 0;
+	int result                               = 0;
+#endif
+
+#if !defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: system timezone watcher not supported.",
+	 function );
+
+	return( -1 );
+#else
+	if( libcdatetime_system_timezone_process_timezone.is_watching != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid system timezone - watcher is already running.",
+		 function );
+
+		return( -1 );
+	}
+	if( getenv( "TZ" ) != NULL )
+	{
+		return( 0 );
+	}
+	libcdatetime_system_timezone_process_timezone.notify_file_descriptor     = -1;
+	libcdatetime_system_timezone_process_timezone.directory_watch_descriptor = -1;
+	libcdatetime_system_timezone_process_timezone.file_watch_descriptor      = -1;
+	libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 0 ] = -1;
+	libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 1 ] = -1;
+
+	path_length = narrow_string_length(
+	               LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH );
+
+	last_separator = narrow_string_search_character_reverse(
+	                  LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH,
+	                  (int) '/',
+	                  path_length + 1 );
+
+	if( last_separator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported localtime path.",
+		 function );
+
+		goto on_error;
+	}
+	directory_path_length = (size_t) ( last_separator - LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH );
+
+	/* The localtime file can be stored in the root directory
+	 */
+	if( directory_path_length == 0 )
+	{
+		directory_path_length = 1;
+	}
+	directory_path = narrow_string_allocate(
+	                  directory_path_length + 1 );
+
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory path.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     directory_path,
+	     LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	directory_path[ directory_path_length ] = 0;
+
+	libcdatetime_system_timezone_process_timezone.notify_file_descriptor = inotify_init1(
+	                                                                        IN_CLOEXEC );
+
+	if( libcdatetime_system_timezone_process_timezone.notify_file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 errno,
+		 "%s: unable to create inotify instance.",
+		 function );
+
+		goto on_error;
+	}
+	libcdatetime_system_timezone_process_timezone.directory_watch_descriptor = inotify_add_watch(
+	                                                                            libcdatetime_system_timezone_process_timezone.notify_file_descriptor,
+	                                                                            directory_path,
+	                                                                            LIBCDATETIME_SYSTEM_TIMEZONE_DIRECTORY_WATCH_MASK );
+
+	if( libcdatetime_system_timezone_process_timezone.directory_watch_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 errno,
+		 "%s: unable to watch directory: %s.",
+		 function,
+		 directory_path );
+
+		goto on_error;
+	}
+	memory_free(
+	 directory_path );
+
+	directory_path = NULL;
+
+	/* A missing localtime file is not considered an error, since it is
+	 * detected by the directory watch when it is created
+	 */
+	libcdatetime_system_timezone_process_timezone.file_watch_descriptor = inotify_add_watch(
+	                                                                       libcdatetime_system_timezone_process_timezone.notify_file_descriptor,
+	                                                                       LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH,
+	                                                                       LIBCDATETIME_SYSTEM_TIMEZONE_FILE_WATCH_MASK );
+
+	if( pipe(
+	     libcdatetime_system_timezone_process_timezone.stop_file_descriptors ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 errno,
+		 "%s: unable to create stop pipe.",
+		 function );
+
+		goto on_error;
+	}
+	/* The watcher thread becomes the only thread that publishes the system timezone,
+	 * hence the system timezone must have been read before the thread is started.
+	 * Since the watches were added before, changes made while reading are not missed
+	 */
+	do
+	{
+		if( libcdatetime_system_timezone_get_timezone(
+		     &system_timezone,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve system timezone.",
+			 function );
+
+			goto on_error;
+		}
+		state = libcdatetime_atomic_load_uint32(
+		         &( libcdatetime_system_timezone_process_timezone.state ) );
+
+		if( state == LIBCDATETIME_SYSTEM_TIMEZONE_STATE_READING )
+		{
+			sched_yield();
+		}
+	}
+	while( state == LIBCDATETIME_SYSTEM_TIMEZONE_STATE_READING );
+
+	result = pthread_create(
+	          &( libcdatetime_system_timezone_process_timezone.watcher_thread ),
+	          NULL,
+	          &libcdatetime_system_timezone_watcher_thread_start_function,
+	          (void *) &libcdatetime_system_timezone_process_timezone );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 result,
+		 "%s: unable to create thread.",
+		 function );
+
+		goto on_error;
+	}
+	libcdatetime_system_timezone_process_timezone.is_watching = 1;
+
+	return( 1 );
+
+on_error:
+	if( libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 1 ] != -1 )
+	{
+		close(
+		 libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 1 ] );
+
+		libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 1 ] = -1;
+	}
+	if( libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 0 ] );
+
+		libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 0 ] = -1;
+	}
+	if( libcdatetime_system_timezone_process_timezone.notify_file_descriptor != -1 )
+	{
+		close(
+		 libcdatetime_system_timezone_process_timezone.notify_file_descriptor );
+
+		libcdatetime_system_timezone_process_timezone.notify_file_descriptor = -1;
+	}
+	if( directory_path != NULL )
+	{
+		memory_free(
+		 directory_path );
+	}
+	return( -1 );
+
+#endif /* !defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+}
+
+/* Stops watching the system timezone for changes
+ * The system timezone that was published last remains in use. The timezones it
+ * replaced are freed if no other thread uses them, otherwise they are retained.
+ * This function is not thread-safe
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_stop_system_timezone_watcher(
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_stop_system_timezone_watcher";
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+	uint8_t stop_data     = 0;
+	int result            = 0;
+
+	if( libcdatetime_system_timezone_process_timezone.is_watching != 0 )
+	{
+		if( write(
+		     libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 1 ],
+		     &stop_data,
+		     1 ) != 1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 errno,
+			 "%s: unable to signal watcher thread to stop.",
+			 function );
+
+			return( -1 );
+		}
+		result = pthread_join(
+		          libcdatetime_system_timezone_process_timezone.watcher_thread,
+		          NULL );
+
+		if( result != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 result,
+			 "%s: unable to join thread.",
+			 function );
+
+			return( -1 );
+		}
+		/* Closing the inotify file descriptor also removes the watches
+		 */
+		close(
+		 libcdatetime_system_timezone_process_timezone.notify_file_descriptor );
+
+		close(
+		 libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 0 ] );
+
+		close(
+		 libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 1 ] );
+
+		libcdatetime_system_timezone_process_timezone.notify_file_descriptor     = -1;
+		libcdatetime_system_timezone_process_timezone.directory_watch_descriptor = -1;
+		libcdatetime_system_timezone_process_timezone.file_watch_descriptor      = -1;
+		libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 0 ] = -1;
+		libcdatetime_system_timezone_process_timezone.stop_file_descriptors[ 1 ] = -1;
+		libcdatetime_system_timezone_process_timezone.is_watching                = 0;
+	}
+	/* Retired timezones that can still be used by other threads are retained
+	 * and freed by a subsequent reload or stop
+	 */
+	if( libcdatetime_system_timezone_free_retired_timezones(
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free retired timezones.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+
+	return( 1 );
+}
+
@@ -0,0 +1,142 @@
+/*
+ * System timezone functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_SYSTEM_TIMEZONE_H )
+#define _LIBCDATETIME_SYSTEM_TIMEZONE_H
+
+#include <common.h>
+#include <types.h>
+
+#if !defined( WINAPI ) && defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H )
+#include <pthread.h>
+#endif
+
+#include "libcdatetime_atomic.h"
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_FOPEN ) && defined( HAVE_SYS_INOTIFY_H ) && defined( HAVE_INOTIFY_INIT1 ) && defined( HAVE_POLL_H ) && defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER	1
+#endif
+
+/* The TZif file that contains the system timezone if the TZ environment variable is not set
+ */
+#if !defined( LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH )
+#define LIBCDATETIME_SYSTEM_TIMEZONE_LOCALTIME_PATH	"/etc/localtime"
+#endif
+
+typedef struct libcdatetime_system_timezone libcdatetime_system_timezone_t;
+
+struct libcdatetime_system_timezone
+{
+	/* The state
+	 */
+	uint32_t state;
+
+	/* The timezone, which is immutable once published
+	 */
+	libcdatetime_timezone_t *timezone;
+
+	/* The number of threads that retrieved the timezone and did not release it yet
+	 */
+	uint32_t number_of_readers;
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+	/* The timezones that were replaced by the watcher
+	 * These are freed once no thread uses a system timezone, since other threads can still use them
+	 */
+	libcdatetime_timezone_t **retired_timezones;
+
+	/* The number of retired timezones
+	 */
+	int number_of_retired_timezones;
+
+	/* Value to indicate the watcher thread is running
+	 */
+	uint8_t is_watching;
+
+	/* The watcher thread
+	 */
+	pthread_t watcher_thread;
+
+	/* The inotify file descriptor
+	 */
+	int notify_file_descriptor;
+
+	/* The watch descriptor of the directory that contains the localtime file
+	 */
+	int directory_watch_descriptor;
+
+	/* The watch descriptor of the localtime file, or the target of its symbolic link
+	 */
+	int file_watch_descriptor;
+
+	/* The file descriptors of the pipe that signals the watcher thread to stop
+	 */
+	int stop_file_descriptors[ 2 ];
+#endif
+};
+
+int libcdatetime_system_timezone_read(
+     const char *tz_value,
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error );
+
+int libcdatetime_system_timezone_get_timezone(
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error );
+
+int libcdatetime_system_timezone_release_timezone(
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error );
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+
+int libcdatetime_system_timezone_free_retired_timezones(
+     libcerror_error_t **error );
+
+int libcdatetime_system_timezone_reload(
+     libcerror_error_t **error );
+
+void *libcdatetime_system_timezone_watcher_thread_start_function(
+       void *arguments );
+
+#endif /* defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_start_system_timezone_watcher(
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_stop_system_timezone_watcher(
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_SYSTEM_TIMEZONE_H ) */
+
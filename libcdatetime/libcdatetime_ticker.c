@@ -0,0 +1,1326 @@
+/*
+ * Ticker functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+#endif /* !defined( WINAPI ) */
+
+#include <errno.h>
+
+#include "libcdatetime_atomic.h"
+#include "libcdatetime_clock.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_ticker.h"
+#include "libcdatetime_timestamp.h"
+#include "libcdatetime_types.h"
+
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && !defined( WINAPI ) && defined( HAVE_CLOCK_GETTIME ) && defined( HAVE_PTHREAD_CONDATTR_SETCLOCK ) && defined( CLOCK_MONOTONIC )
+#define LIBCDATETIME_TICKER_WAIT_CLOCK	CLOCK_MONOTONIC
+
+#elif defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && !defined( WINAPI ) && defined( HAVE_CLOCK_GETTIME )
+#define LIBCDATETIME_TICKER_WAIT_CLOCK	CLOCK_REALTIME
+#endif
+
+/* Creates a ticker
+ * Make sure the value ticker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ticker_initialize(
+     libcdatetime_ticker_t **ticker,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+	static char *function                           = "libcdatetime_ticker_initialize";
+
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && !defined( WINAPI )
+	pthread_condattr_t condition_attributes;
+
+	int condition_initialized                       = 0;
+	int mutex_initialized                           = 0;
+	int result                                      = 0;
+#endif
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ticker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ticker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_ticker = memory_allocate_structure(
+	                   libcdatetime_internal_ticker_t );
+
+	if( internal_ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ticker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_ticker,
+	     0,
+	     sizeof( libcdatetime_internal_ticker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear ticker.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && !defined( WINAPI )
+	result = pthread_mutex_init(
+	          &( internal_ticker->mutex ),
+	          NULL );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 result,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	mutex_initialized = 1;
+
+	result = pthread_condattr_init(
+	          &condition_attributes );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 result,
+		 "%s: unable to initialize condition attributes.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_PTHREAD_CONDATTR_SETCLOCK ) && defined( LIBCDATETIME_TICKER_WAIT_CLOCK )
+	/* Wait on a clock that is not affected when the system time is changed
+	 */
+	result = pthread_condattr_setclock(
+	          &condition_attributes,
+	          LIBCDATETIME_TICKER_WAIT_CLOCK );
+
+	if( result == 0 )
+#endif
+	{
+		result = pthread_cond_init(
+		          &( internal_ticker->stop_condition ),
+		          &condition_attributes );
+	}
+	pthread_condattr_destroy(
+	 &condition_attributes );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 result,
+		 "%s: unable to initialize stop condition.",
+		 function );
+
+		goto on_error;
+	}
+	condition_initialized = 1;
+
+#endif /* defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && !defined( WINAPI ) */
+
+	*ticker = (libcdatetime_ticker_t *) internal_ticker;
+
+	return( 1 );
+
+on_error:
+	if( internal_ticker != NULL )
+	{
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && !defined( WINAPI )
+		if( condition_initialized != 0 )
+		{
+			pthread_cond_destroy(
+			 &( internal_ticker->stop_condition ) );
+		}
+		if( mutex_initialized != 0 )
+		{
+			pthread_mutex_destroy(
+			 &( internal_ticker->mutex ) );
+		}
+#endif
+		memory_free(
+		 internal_ticker );
+	}
+	return( -1 );
+}
+
+/* Frees a ticker
+ * The ticker thread is stopped if it is running
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ticker_free(
+     libcdatetime_ticker_t **ticker,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+	static char *function                           = "libcdatetime_ticker_free";
+	int result                                      = 1;
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *ticker != NULL )
+	{
+		internal_ticker = (libcdatetime_internal_ticker_t *) *ticker;
+		*ticker         = NULL;
+
+		if( libcdatetime_ticker_stop(
+		     (libcdatetime_ticker_t *) internal_ticker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop ticker.",
+			 function );
+
+			result = -1;
+		}
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && !defined( WINAPI )
+		pthread_cond_destroy(
+		 &( internal_ticker->stop_condition ) );
+
+		pthread_mutex_destroy(
+		 &( internal_ticker->mutex ) );
+#endif
+		memory_free(
+		 internal_ticker );
+	}
+	return( result );
+}
+
+/* Sets the clock source of the ticker
+ * The clock source is one of the LIBCDATETIME_CLOCK_SOURCES values,
+ * LIBCDATETIME_CLOCK_SOURCE_DEFAULT makes the ticker use the clock source
+ * of the process
+ * The clock source cannot be changed while the ticker thread is running
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ticker_set_clock_source(
+     libcdatetime_ticker_t *ticker,
+     int clock_source,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+	static char *function                           = "libcdatetime_ticker_set_clock_source";
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_ticker = (libcdatetime_internal_ticker_t *) ticker;
+
+	if( internal_ticker->is_running != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ticker - thread is running.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_settings_set_clock_source(
+	     &( internal_ticker->clock_settings ),
+	     clock_source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a callback function as the clock source of the ticker
+ * The callback function should retrieve the current time as the number
+ * of nano seconds since January 1, 1970 00:00:00 UTC and return 1 if
+ * successful or -1 on error
+ * The clock source cannot be changed while the ticker thread is running
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ticker_set_clock_callback(
+     libcdatetime_ticker_t *ticker,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+	static char *function                           = "libcdatetime_ticker_set_clock_callback";
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_ticker = (libcdatetime_internal_ticker_t *) ticker;
+
+	if( internal_ticker->is_running != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ticker - thread is running.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_settings_set_clock_callback(
+	     &( internal_ticker->clock_settings ),
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock callback.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a consistent copy of the values
+ * The values are protected by a sequence lock, readers retry
+ * while the values are being updated and never block the writer
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_ticker_get_values(
+     libcdatetime_internal_ticker_t *internal_ticker,
+     libcdatetime_ticker_values_t *values,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcdatetime_internal_ticker_get_values";
+	uint32_t sequence_number = 0;
+
+	if( internal_ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	for( ;; )
+	{
+		sequence_number = libcdatetime_atomic_load_uint32(
+		                   &( internal_ticker->sequence_number ) );
+
+		if( ( sequence_number & 1 ) == 0 )
+		{
+			memory_copy(
+			 values,
+			 &( internal_ticker->values ),
+			 sizeof( libcdatetime_ticker_values_t ) );
+
+			/* Make sure the values are read before the sequence number is checked
+			 */
+			libcdatetime_atomic_thread_fence();
+
+			if( libcdatetime_atomic_load_uint32(
+			     &( internal_ticker->sequence_number ) ) == sequence_number )
+			{
+				break;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Publishes the values
+ * Concurrent writers are serialized by the sequence number
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_ticker_set_values(
+     libcdatetime_internal_ticker_t *internal_ticker,
+     const libcdatetime_ticker_values_t *values,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcdatetime_internal_ticker_set_values";
+	uint32_t sequence_number = 0;
+
+	if( internal_ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	/* An odd sequence number marks the values as being updated
+	 */
+	for( ;; )
+	{
+		sequence_number = libcdatetime_atomic_load_uint32(
+		                   &( internal_ticker->sequence_number ) );
+
+		if( ( ( sequence_number & 1 ) == 0 )
+		 && ( libcdatetime_atomic_compare_and_swap_uint32(
+		       &( internal_ticker->sequence_number ),
+		       sequence_number,
+		       sequence_number + 1 ) != 0 ) )
+		{
+			break;
+		}
+	}
+	memory_copy(
+	 &( internal_ticker->values ),
+	 values,
+	 sizeof( libcdatetime_ticker_values_t ) );
+
+	libcdatetime_atomic_store_uint32(
+	 &( internal_ticker->sequence_number ),
+	 sequence_number + 2 );
+
+	return( 1 );
+}
+
+/* Refreshes the current time of the ticker
+ * The strings are only rendered again when the second changes
+ * This function can be used without starting the ticker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ticker_refresh(
+     libcdatetime_ticker_t *ticker,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+	libcdatetime_internal_timestamp_t timestamp;
+	libcdatetime_ticker_values_t values;
+
+	static char *function                           = "libcdatetime_ticker_refresh";
+	int64_t number_of_seconds                       = 0;
+	int64_t posix_time_in_nano_seconds              = 0;
+	int64_t previous_number_of_seconds              = 0;
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_ticker = (libcdatetime_internal_ticker_t *) ticker;
+
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_ticker->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_ticker_get_values(
+	     internal_ticker,
+	     &values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The fraction of a second is relative to the preceding second
+	 */
+	number_of_seconds = posix_time_in_nano_seconds / 1000000000LL;
+
+	if( ( posix_time_in_nano_seconds % 1000000000LL ) < 0 )
+	{
+		number_of_seconds -= 1;
+	}
+	previous_number_of_seconds = values.posix_time_in_nano_seconds / 1000000000LL;
+
+	if( ( values.posix_time_in_nano_seconds % 1000000000LL ) < 0 )
+	{
+		previous_number_of_seconds -= 1;
+	}
+	if( ( values.is_set == 0 )
+	 || ( number_of_seconds != previous_number_of_seconds ) )
+	{
+		if( memory_set(
+		     &timestamp,
+		     0,
+		     sizeof( libcdatetime_internal_timestamp_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear timestamp.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+		     &timestamp,
+		     number_of_seconds * 1000000000LL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set timestamp.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdatetime_timestamp_copy_to_string(
+		     (libcdatetime_timestamp_t *) &timestamp,
+		     values.iso8601_string,
+		     21,
+		     LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy timestamp to ISO 8601 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdatetime_timestamp_copy_to_string(
+		     (libcdatetime_timestamp_t *) &timestamp,
+		     values.ctime_string,
+		     26,
+		     LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy timestamp to ctime string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	values.posix_time_in_nano_seconds = posix_time_in_nano_seconds;
+	values.is_set                     = 1;
+
+	if( libcdatetime_internal_ticker_set_values(
+	     internal_ticker,
+	     &values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI )
+
+/* The ticker thread start function
+ * Returns 0
+ */
+DWORD WINAPI libcdatetime_ticker_thread_start_function(
+              LPVOID arguments )
+{
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+
+	internal_ticker = (libcdatetime_internal_ticker_t *) arguments;
+
+	do
+	{
+		/* Errors are ignored, the previous values remain available
+		 */
+		libcdatetime_ticker_refresh(
+		 (libcdatetime_ticker_t *) internal_ticker,
+		 NULL );
+	}
+	while( WaitForSingleObject(
+	        internal_ticker->stop_event_handle,
+	        (DWORD) internal_ticker->interval_in_milli_seconds ) == WAIT_TIMEOUT );
+
+	return( 0 );
+}
+
+#elif defined( LIBCDATETIME_HAVE_TICKER_THREAD )
+
+/* Determines the time until which the ticker thread waits
+ */
+void libcdatetime_ticker_get_wait_deadline(
+      uint32_t interval_in_milli_seconds,
+      struct timespec *deadline )
+{
+#if defined( LIBCDATETIME_TICKER_WAIT_CLOCK )
+	if( clock_gettime(
+	     LIBCDATETIME_TICKER_WAIT_CLOCK,
+	     deadline ) != 0 )
+#endif
+	{
+		deadline->tv_sec  = time( NULL );
+		deadline->tv_nsec = 0;
+	}
+	deadline->tv_sec  += (time_t) ( interval_in_milli_seconds / 1000 );
+	deadline->tv_nsec += (long) ( interval_in_milli_seconds % 1000 ) * 1000000L;
+
+	if( deadline->tv_nsec >= 1000000000L )
+	{
+		deadline->tv_sec  += 1;
+		deadline->tv_nsec -= 1000000000L;
+	}
+}
+
+/* The ticker thread start function
+ * Returns NULL
+ */
+void *libcdatetime_ticker_thread_start_function(
+       void *arguments )
+{
+	struct timespec deadline;
+
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+	int result                                      = 0;
+
+	internal_ticker = (libcdatetime_internal_ticker_t *) arguments;
+
+	pthread_mutex_lock(
+	 &( internal_ticker->mutex ) );
+
+	while( internal_ticker->stop_requested == 0 )
+	{
+		pthread_mutex_unlock(
+		 &( internal_ticker->mutex ) );
+
+		/* Errors are ignored, the previous values remain available
+		 */
+		libcdatetime_ticker_refresh(
+		 (libcdatetime_ticker_t *) internal_ticker,
+		 NULL );
+
+		libcdatetime_ticker_get_wait_deadline(
+		 internal_ticker->interval_in_milli_seconds,
+		 &deadline );
+
+		pthread_mutex_lock(
+		 &( internal_ticker->mutex ) );
+
+		while( internal_ticker->stop_requested == 0 )
+		{
+			result = pthread_cond_timedwait(
+			          &( internal_ticker->stop_condition ),
+			          &( internal_ticker->mutex ),
+			          &deadline );
+
+			if( result == ETIMEDOUT )
+			{
+				break;
+			}
+		}
+	}
+	pthread_mutex_unlock(
+	 &( internal_ticker->mutex ) );
+
+	return( NULL );
+}
+
+#endif /* defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI ) */
+
+/* Starts the ticker thread
+ * The thread refreshes the current time every interval
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ticker_start(
+     libcdatetime_ticker_t *ticker,
+     uint32_t interval_in_milli_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+	static char *function                           = "libcdatetime_ticker_start";
+
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI )
+	DWORD error_code                                = 0;
+
+#elif defined( LIBCDATETIME_HAVE_TICKER_THREAD )
+	int result                                      = 0;
+#endif
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_ticker = (libcdatetime_internal_ticker_t *) ticker;
+
+	if( internal_ticker->is_running != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid ticker - thread is already running.",
+		 function );
+
+		return( -1 );
+	}
+	if( interval_in_milli_seconds == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid interval in milli seconds value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( LIBCDATETIME_HAVE_TICKER_THREAD )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: ticker thread not supported.",
+	 function );
+
+	return( -1 );
+#else
+	/* Make sure the values are available when this function returns
+	 */
+	if( libcdatetime_ticker_refresh(
+	     ticker,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to refresh ticker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_ticker->interval_in_milli_seconds = interval_in_milli_seconds;
+
+#if defined( WINAPI )
+	internal_ticker->stop_event_handle = CreateEvent(
+	                                      NULL,
+	                                      TRUE,
+	                                      FALSE,
+	                                      NULL );
+
+	if( internal_ticker->stop_event_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 error_code,
+		 "%s: unable to create stop event.",
+		 function );
+
+		return( -1 );
+	}
+	internal_ticker->thread_handle = CreateThread(
+	                                  NULL,
+	                                  0,
+	                                  &libcdatetime_ticker_thread_start_function,
+	                                  (LPVOID) internal_ticker,
+	                                  0,
+	                                  NULL );
+
+	if( internal_ticker->thread_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 error_code,
+		 "%s: unable to create thread.",
+		 function );
+
+		CloseHandle(
+		 internal_ticker->stop_event_handle );
+
+		internal_ticker->stop_event_handle = NULL;
+
+		return( -1 );
+	}
+#else
+	internal_ticker->stop_requested = 0;
+
+	result = pthread_create(
+	          &( internal_ticker->thread ),
+	          NULL,
+	          &libcdatetime_ticker_thread_start_function,
+	          (void *) internal_ticker );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 result,
+		 "%s: unable to create thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( WINAPI ) */
+
+	internal_ticker->is_running = 1;
+
+	return( 1 );
+
+#endif /* !defined( LIBCDATETIME_HAVE_TICKER_THREAD ) */
+}
+
+/* Stops the ticker thread
+ * The last published values remain available
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_ticker_stop(
+     libcdatetime_ticker_t *ticker,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_ticker_t *internal_ticker = NULL;
+	static char *function                           = "libcdatetime_ticker_stop";
+
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI )
+	DWORD error_code                                = 0;
+	int result                                      = 1;
+
+#elif defined( LIBCDATETIME_HAVE_TICKER_THREAD )
+	int result                                      = 0;
+#endif
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	internal_ticker = (libcdatetime_internal_ticker_t *) ticker;
+
+	if( internal_ticker->is_running == 0 )
+	{
+		return( 1 );
+	}
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI )
+	if( SetEvent(
+	     internal_ticker->stop_event_handle ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to signal stop event.",
+		 function );
+
+		return( -1 );
+	}
+	if( WaitForSingleObject(
+	     internal_ticker->thread_handle,
+	     INFINITE ) == WAIT_FAILED )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 error_code,
+		 "%s: unable to join thread.",
+		 function );
+
+		result = -1;
+	}
+	CloseHandle(
+	 internal_ticker->thread_handle );
+
+	CloseHandle(
+	 internal_ticker->stop_event_handle );
+
+	internal_ticker->thread_handle     = NULL;
+	internal_ticker->stop_event_handle = NULL;
+	internal_ticker->is_running        = 0;
+
+	return( result );
+
+#elif defined( LIBCDATETIME_HAVE_TICKER_THREAD )
+	pthread_mutex_lock(
+	 &( internal_ticker->mutex ) );
+
+	internal_ticker->stop_requested = 1;
+
+	pthread_cond_signal(
+	 &( internal_ticker->stop_condition ) );
+
+	pthread_mutex_unlock(
+	 &( internal_ticker->mutex ) );
+
+	result = pthread_join(
+	          internal_ticker->thread,
+	          NULL );
+
+	internal_ticker->is_running = 0;
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 result,
+		 "%s: unable to join thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#else
+	internal_ticker->is_running = 0;
+
+	return( 1 );
+
+#endif /* defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI ) */
+}
+
+/* Retrieves the current time of the ticker
+ * The current time is the number of nano seconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful, 0 if the ticker has not been refreshed or -1 on error
+ */
+int libcdatetime_ticker_get_posix_time_in_nano_seconds(
+     libcdatetime_ticker_t *ticker,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_ticker_values_t values;
+
+	static char *function = "libcdatetime_ticker_get_posix_time_in_nano_seconds";
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_ticker_get_values(
+	     (libcdatetime_internal_ticker_t *) ticker,
+	     &values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values.",
+		 function );
+
+		return( -1 );
+	}
+	if( values.is_set == 0 )
+	{
+		return( 0 );
+	}
+	*posix_time_in_nano_seconds = values.posix_time_in_nano_seconds;
+
+	return( 1 );
+}
+
+/* Copies the current time of the ticker to a timestamp
+ * Returns 1 if successful, 0 if the ticker has not been refreshed or -1 on error
+ */
+int libcdatetime_ticker_copy_to_timestamp(
+     libcdatetime_ticker_t *ticker,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_ticker_copy_to_timestamp";
+	int64_t posix_time_in_nano_seconds = 0;
+	int result                         = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdatetime_ticker_get_posix_time_in_nano_seconds(
+	          ticker,
+	          &posix_time_in_nano_seconds,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+		     (libcdatetime_internal_timestamp_t *) timestamp,
+		     posix_time_in_nano_seconds,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set timestamp.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Copies the pre-rendered string of the current second of the ticker
+ * The string format flags should contain either
+ * LIBCDATETIME_STRING_FORMAT_TYPE_CTIME or LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601
+ * and LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME, optionally combined with
+ * LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR
+ * The string size should include the end of string character
+ * Returns 1 if successful, 0 if the ticker has not been refreshed or -1 on error
+ */
+int libcdatetime_ticker_copy_to_string(
+     libcdatetime_ticker_t *ticker,
+     uint8_t *string,
+     size_t string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_ticker_values_t values;
+
+	uint8_t *values_string      = NULL;
+	static char *function       = "libcdatetime_ticker_copy_to_string";
+	size_t string_length        = 0;
+	uint32_t string_format_type = 0;
+	uint32_t supported_flags    = 0;
+
+	if( ticker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ticker.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = 0x000000ffUL
+	                | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME
+	                | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR;
+
+	if( ( ( string_format_flags & ~( supported_flags ) ) != 0 )
+	 || ( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME ) != LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_flags );
+
+		return( -1 );
+	}
+	string_format_type = string_format_flags & 0x000000ffUL;
+
+	/* Example: Jan 01, 1970 00:00:00 UTC
+	 */
+	if( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_CTIME )
+	{
+		values_string = values.ctime_string;
+		string_length = 21;
+
+		if( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR ) != 0 )
+		{
+			string_length += 4;
+		}
+	}
+	/* Example: 1970-01-01T00:00:00Z
+	 */
+	else if( string_format_type == LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 )
+	{
+		values_string = values.iso8601_string;
+		string_length = 19;
+
+		if( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR ) != 0 )
+		{
+			string_length += 1;
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format type: 0x%08" PRIx32 ".",
+		 function,
+		 string_format_type );
+
+		return( -1 );
+	}
+	if( string_size < ( string_length + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_ticker_get_values(
+	     (libcdatetime_internal_ticker_t *) ticker,
+	     &values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values.",
+		 function );
+
+		return( -1 );
+	}
+	if( values.is_set == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     string,
+	     values_string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	string[ string_length ] = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,216 @@
+/*
+ * Ticker functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_TICKER_H )
+#define _LIBCDATETIME_TICKER_H
+
+#include <common.h>
+#include <types.h>
+
+#if !defined( WINAPI ) && defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H )
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "libcdatetime_atomic.h"
+#include "libcdatetime_clock.h"
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && ( defined( WINAPI ) || defined( HAVE_PTHREAD_H ) )
+#define LIBCDATETIME_HAVE_TICKER_THREAD	1
+#endif
+
+typedef struct libcdatetime_ticker_values libcdatetime_ticker_values_t;
+
+struct libcdatetime_ticker_values
+{
+	/* The current time as the number of nano seconds since January 1, 1970 00:00:00 UTC
+	 */
+	int64_t posix_time_in_nano_seconds;
+
+	/* The ISO 8601 string of the current second
+	 * Example: 1970-01-01T00:00:00Z
+	 */
+	uint8_t iso8601_string[ 21 ];
+
+	/* The ctime string of the current second
+	 * Example: Jan 01, 1970 00:00:00 UTC
+	 */
+	uint8_t ctime_string[ 26 ];
+
+	/* Value to indicate the values are set
+	 */
+	uint8_t is_set;
+};
+
+typedef struct libcdatetime_internal_ticker libcdatetime_internal_ticker_t;
+
+struct libcdatetime_internal_ticker
+{
+	/* The sequence number of the values
+	 * The sequence number is odd while the values are being updated
+	 */
+	uint32_t sequence_number;
+
+	/* The values
+	 */
+	libcdatetime_ticker_values_t values;
+
+	/* The clock settings
+	 */
+	libcdatetime_clock_settings_t clock_settings;
+
+	/* The refresh interval in milli seconds
+	 */
+	uint32_t interval_in_milli_seconds;
+
+	/* Value to indicate the ticker thread is running
+	 */
+	uint8_t is_running;
+
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI )
+	/* The thread handle
+	 */
+	HANDLE thread_handle;
+
+	/* The event that signals the thread to stop
+	 */
+	HANDLE stop_event_handle;
+
+#elif defined( LIBCDATETIME_HAVE_TICKER_THREAD )
+	/* The thread
+	 */
+	pthread_t thread;
+
+	/* The mutex that protects the stop flag
+	 */
+	pthread_mutex_t mutex;
+
+	/* The condition that signals the thread to stop
+	 */
+	pthread_cond_t stop_condition;
+
+	/* Value to indicate the thread should stop
+	 */
+	uint8_t stop_requested;
+#endif
+};
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_initialize(
+     libcdatetime_ticker_t **ticker,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_free(
+     libcdatetime_ticker_t **ticker,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_set_clock_source(
+     libcdatetime_ticker_t *ticker,
+     int clock_source,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_set_clock_callback(
+     libcdatetime_ticker_t *ticker,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_ticker_get_values(
+     libcdatetime_internal_ticker_t *internal_ticker,
+     libcdatetime_ticker_values_t *values,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_ticker_set_values(
+     libcdatetime_internal_ticker_t *internal_ticker,
+     const libcdatetime_ticker_values_t *values,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_refresh(
+     libcdatetime_ticker_t *ticker,
+     libcerror_error_t **error );
+
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI )
+
+DWORD WINAPI libcdatetime_ticker_thread_start_function(
+              LPVOID arguments );
+
+#elif defined( LIBCDATETIME_HAVE_TICKER_THREAD )
+
+void libcdatetime_ticker_get_wait_deadline(
+      uint32_t interval_in_milli_seconds,
+      struct timespec *deadline );
+
+void *libcdatetime_ticker_thread_start_function(
+       void *arguments );
+
+#endif /* defined( LIBCDATETIME_HAVE_TICKER_THREAD ) && defined( WINAPI ) */
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_start(
+     libcdatetime_ticker_t *ticker,
+     uint32_t interval_in_milli_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_stop(
+     libcdatetime_ticker_t *ticker,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_get_posix_time_in_nano_seconds(
+     libcdatetime_ticker_t *ticker,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_copy_to_timestamp(
+     libcdatetime_ticker_t *ticker,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_ticker_copy_to_string(
+     libcdatetime_ticker_t *ticker,
+     uint8_t *string,
+     size_t string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_TICKER_H ) */
+
@@ -33,6 +33,7 @@
 
 #include <errno.h>
 
+#include "libcdatetime_clock.h"
 #include "libcdatetime_definitions.h"
 #include "libcdatetime_elements.h"
 #include "libcdatetime_libcerror.h"
@@ -194,21 +195,18 @@ int libcdatetime_timestamp_copy(
 	return( 1 );
 }
 
-#if defined( WINAPI ) && ( WINVER >= 0x0500 )
-
-/* Sets the timestamp to the current (system) date and time in UTC
- * This function uses the WINAPI function for Windows 2000 or later
+/* Sets the clock source of the timestamp
+ * Setting the clock source to LIBCDATETIME_CLOCK_SOURCE_DEFAULT makes the timestamp
+ * use the clock source set for the process
  * Returns 1 if successful or -1 on error
  */
-int libcdatetime_timestamp_set_current_time(
+int libcdatetime_timestamp_set_clock_source(
      libcdatetime_timestamp_t *timestamp,
+     int clock_source,
      libcerror_error_t **error )
 {
-	SYSTEMTIME systemtime;
-
 	libcdatetime_internal_timestamp_t *internal_timestamp = NULL;
-	static char *function                                 = "libcdatetime_timestamp_set_current_time";
-	DWORD error_code                                      = 0;
+	static char *function                                 = "libcdatetime_timestamp_set_clock_source";
 
 	if( timestamp == NULL )
 	{
@@ -223,35 +221,65 @@ int libcdatetime_timestamp_set_current_time(
 	}
 	internal_timestamp = (libcdatetime_internal_timestamp_t *) timestamp;
 
-	if( memory_set(
-	     &systemtime,
-	     0,
-	     sizeof( SYSTEMTIME ) ) == NULL )
+	if( libcdatetime_clock_settings_set_clock_source(
+	     &( internal_timestamp->clock_settings ),
+	     clock_source,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear systemtime.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock source.",
 		 function );
 
 		return( -1 );
 	}
-	GetSystemTime(
-	 &systemtime );
+	return( 1 );
+}
 
-	if( SystemTimeToFileTime(
-	     &systemtime,
-	     &( internal_timestamp->filetime ) ) == 0 )
+/* Sets a callback function as the clock source of the timestamp
+ * The callback function should retrieve the current time as the number
+ * of nano seconds since January 1, 1970 00:00:00 UTC and return 1 if
+ * successful or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_set_clock_callback(
+     libcdatetime_timestamp_t *timestamp,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_t *internal_timestamp = NULL;
+	static char *function                                 = "libcdatetime_timestamp_set_clock_callback";
+
+	if( timestamp == NULL )
 	{
-		error_code = GetLastError();
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timestamp = (libcdatetime_internal_timestamp_t *) timestamp;
 
-		libcerror_system_set_error(
+	if( libcdatetime_clock_settings_set_clock_callback(
+	     &( internal_timestamp->clock_settings ),
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 error_code,
-		 "%s: unable to retrieve filetime.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock callback.",
 		 function );
 
 		return( -1 );
@@ -259,15 +287,131 @@ int libcdatetime_timestamp_set_current_time(
 	return( 1 );
 }
 
-#elif defined( WINAPI )
+#if defined( WINAPI ) && ( WINVER < 0x0500 )
 
 /* TODO */
 #error WINAPI get current time function for Windows NT4 or earlier NOT implemented yet
 
-#elif defined( HAVE_TIME )
+#endif
+
+/* Sets the timestamp from a POSIX time in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+     libcdatetime_internal_timestamp_t *internal_timestamp,
+     int64_t posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds";
+
+#if defined( WINAPI )
+	uint64_t filetime     = 0;
+#endif
+
+	if( internal_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC and the FILETIME
+	 * is in intervals of 100 nano seconds. A 64-bit number of nano seconds
+	 * since January 1, 1970 always maps onto a positive FILETIME
+	 */
+	filetime = (uint64_t) ( ( posix_time_in_nano_seconds / 100 ) + 116444736000000000LL );
+
+	internal_timestamp->filetime.dwLowDateTime  = (DWORD) ( filetime & 0xffffffffUL );
+	internal_timestamp->filetime.dwHighDateTime = (DWORD) ( filetime >> 32 );
+#else
+	internal_timestamp->nano_seconds = posix_time_in_nano_seconds;
+#endif
+	return( 1 );
+}
+
+/* Retrieves the timestamp as a POSIX time in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+     libcdatetime_internal_timestamp_t *internal_timestamp,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds";
+
+#if defined( WINAPI )
+	uint64_t filetime       = 0;
+	int64_t number_of_100ns = 0;
+#endif
+
+	if( internal_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	filetime  = (uint64_t) internal_timestamp->filetime.dwHighDateTime << 32;
+	filetime |= internal_timestamp->filetime.dwLowDateTime;
+
+	/* The FILETIME epoch is January 1, 1601 00:00:00 UTC and the FILETIME
+	 * is in intervals of 100 nano seconds
+	 */
+	if( filetime > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filetime value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_100ns = (int64_t) filetime - 116444736000000000LL;
+
+	if( ( number_of_100ns > ( (int64_t) INT64_MAX / 100 ) )
+	 || ( number_of_100ns < ( (int64_t) INT64_MIN / 100 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filetime value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = number_of_100ns * 100;
+#else
+	*posix_time_in_nano_seconds = internal_timestamp->nano_seconds;
+#endif
+	return( 1 );
+}
 
 /* Sets the timestamp to the current (system) date and time in UTC
- * This function uses the POSIX time function or equivalent
+ * The current time is retrieved from the clock source of the timestamp
  * Returns 1 if successful or -1 on error
  */
 int libcdatetime_timestamp_set_current_time(
@@ -276,6 +420,7 @@ int libcdatetime_timestamp_set_current_time(
 {
 	libcdatetime_internal_timestamp_t *internal_timestamp = NULL;
 	static char *function                                 = "libcdatetime_timestamp_set_current_time";
+	int64_t posix_time_in_nano_seconds                    = 0;
 
 	if( timestamp == NULL )
 	{
@@ -290,247 +435,1107 @@ int libcdatetime_timestamp_set_current_time(
 	}
 	internal_timestamp = (libcdatetime_internal_timestamp_t *) timestamp;
 
-	if( time(
-	     &( internal_timestamp->time ) ) == (time_t) -1 )
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_timestamp->clock_settings ),
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 errno,
 		 "%s: unable to set current time.",
 		 function );
 
 		return( -1 );
 	}
+	if( libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+	     internal_timestamp,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set timestamp.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
-#else
-#error Missing get current time function
-#endif
+/* Determines the delta in seconds between the first and second timestamp
+ * The number_of_seconds value with be negative if the first timestamp
+ * pre-dates the second timestamp, the fraction of a second is truncated
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_get_delta_in_seconds(
+     libcdatetime_timestamp_t *first_timestamp,
+     libcdatetime_timestamp_t *second_timestamp,
+     int64_t *number_of_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_timestamp_get_delta_in_seconds";
+	int32_t nano_seconds  = 0;
+
+	if( libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	     first_timestamp,
+	     second_timestamp,
+	     number_of_seconds,
+	     &nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve delta.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
 
 #if defined( WINAPI ) && ( WINVER >= 0x0500 )
 
-/* Determines the delta in seconds between the first and second timestamp
+/* Determines the delta in seconds and the remaining fraction of a second
+ * in nano seconds between the first and second timestamp
  * This function uses the WINAPI function for Windows 2000 or later
- * The number_of_seconds value with be negative if the first timestamp
- * pre-dates the second timestamp
+ * The number_of_seconds and nano_seconds values with be negative if the first
+ * timestamp pre-dates the second timestamp
  * Returns 1 if successful or -1 on error
  */
-int libcdatetime_timestamp_get_delta_in_seconds(
+int libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+     libcdatetime_timestamp_t *first_timestamp,
+     libcdatetime_timestamp_t *second_timestamp,
+     int64_t *number_of_seconds,
+     int32_t *nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_t *internal_first_timestamp  = NULL;
+	libcdatetime_internal_timestamp_t *internal_second_timestamp = NULL;
+	static char *function                                        = "libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds";
+	uint64_t first_filetime                                      = 0;
+	uint64_t second_filetime                                     = 0;
+	uint64_t time_delta                                          = 0;
+
+	if( first_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_first_timestamp = (libcdatetime_internal_timestamp_t *) first_timestamp;
+
+	if( second_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_second_timestamp = (libcdatetime_internal_timestamp_t *) second_timestamp;
+
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	first_filetime   = (uint64_t) internal_first_timestamp->filetime.dwHighDateTime << 32;
+	first_filetime  |= internal_first_timestamp->filetime.dwLowDateTime;
+
+	second_filetime  = (uint64_t) internal_second_timestamp->filetime.dwHighDateTime << 32;
+	second_filetime |= internal_second_timestamp->filetime.dwLowDateTime;
+
+	/* The FILETIME is in intervals of 100 nano seconds
+	 */
+	if( first_filetime >= second_filetime )
+	{
+		time_delta = first_filetime - second_filetime;
+
+		*number_of_seconds = (int64_t) ( time_delta / 10000000UL );
+		*nano_seconds      = (int32_t) ( time_delta % 10000000UL ) * 100;
+	}
+	else
+	{
+		time_delta = second_filetime - first_filetime;
+
+		*number_of_seconds = -( (int64_t) ( time_delta / 10000000UL ) );
+		*nano_seconds      = -( (int32_t) ( time_delta % 10000000UL ) * 100 );
+	}
+	return( 1 );
+}
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI timestamp type for Windows NT4 or earlier NOT implemented yet
+
+#else
+
+/* Determines the delta in seconds and the remaining fraction of a second
+ * in nano seconds between the first and second timestamp
+ * The number_of_seconds and nano_seconds values with be negative if the first
+ * timestamp pre-dates the second timestamp
+ * Unlike libcdatetime_timestamp_get_delta_in_nano_seconds this function cannot
+ * overflow, since the delta is not combined into a single 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
      libcdatetime_timestamp_t *first_timestamp,
      libcdatetime_timestamp_t *second_timestamp,
      int64_t *number_of_seconds,
+     int32_t *nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_t *internal_first_timestamp  = NULL;
+	libcdatetime_internal_timestamp_t *internal_second_timestamp = NULL;
+	static char *function                                        = "libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds";
+	int64_t nano_seconds_delta                                   = 0;
+	int64_t seconds_delta                                        = 0;
+
+	if( first_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_first_timestamp = (libcdatetime_internal_timestamp_t *) first_timestamp;
+
+	if( second_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_second_timestamp = (libcdatetime_internal_timestamp_t *) second_timestamp;
+
+	if( number_of_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Split the timestamps into seconds and fraction to prevent
+	 * the nano seconds delta from overflowing
+	 */
+	seconds_delta = ( internal_first_timestamp->nano_seconds / 1000000000LL )
+	              - ( internal_second_timestamp->nano_seconds / 1000000000LL );
+
+	nano_seconds_delta = ( internal_first_timestamp->nano_seconds % 1000000000LL )
+	                   - ( internal_second_timestamp->nano_seconds % 1000000000LL );
+
+	if( nano_seconds_delta >= 1000000000LL )
+	{
+		seconds_delta      += 1;
+		nano_seconds_delta -= 1000000000LL;
+	}
+	else if( nano_seconds_delta <= -1000000000LL )
+	{
+		seconds_delta      -= 1;
+		nano_seconds_delta += 1000000000LL;
+	}
+	/* Make sure the fraction has the same sign as the seconds
+	 */
+	if( ( seconds_delta > 0 )
+	 && ( nano_seconds_delta < 0 ) )
+	{
+		seconds_delta      -= 1;
+		nano_seconds_delta += 1000000000LL;
+	}
+	else if( ( seconds_delta < 0 )
+	      && ( nano_seconds_delta > 0 ) )
+	{
+		seconds_delta      += 1;
+		nano_seconds_delta -= 1000000000LL;
+	}
+	*number_of_seconds = seconds_delta;
+	*nano_seconds      = (int32_t) nano_seconds_delta;
+
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+
+/* Determines the delta in nano seconds between the first and second timestamp
+ * This function uses the WINAPI function for Windows 2000 or later
+ * The number_of_nano_seconds value with be negative if the first timestamp
+ * pre-dates the second timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_get_delta_in_nano_seconds(
+     libcdatetime_timestamp_t *first_timestamp,
+     libcdatetime_timestamp_t *second_timestamp,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_t *internal_first_timestamp  = NULL;
+	libcdatetime_internal_timestamp_t *internal_second_timestamp = NULL;
+	static char *function                                        = "libcdatetime_timestamp_get_delta_in_nano_seconds";
+	uint64_t first_filetime                                      = 0;
+	uint64_t second_filetime                                     = 0;
+	uint64_t time_delta                                          = 0;
+
+	if( first_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_first_timestamp = (libcdatetime_internal_timestamp_t *) first_timestamp;
+
+	if( second_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_second_timestamp = (libcdatetime_internal_timestamp_t *) second_timestamp;
+
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	first_filetime   = (uint64_t) internal_first_timestamp->filetime.dwHighDateTime << 32;
+	first_filetime  |= internal_first_timestamp->filetime.dwLowDateTime;
+
+	second_filetime  = (uint64_t) internal_second_timestamp->filetime.dwHighDateTime << 32;
+	second_filetime |= internal_second_timestamp->filetime.dwLowDateTime;
+
+	/* The FILETIME is in intervals of 100 nano seconds
+	 */
+	if( first_filetime >= second_filetime )
+	{
+		time_delta = first_filetime - second_filetime;
+	}
+	else
+	{
+		time_delta = second_filetime - first_filetime;
+	}
+	if( time_delta > (uint64_t) ( INT64_MAX / 100 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time delta value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_filetime >= second_filetime )
+	{
+		*number_of_nano_seconds = (int64_t) time_delta * 100;
+	}
+	else
+	{
+		*number_of_nano_seconds = -( (int64_t) time_delta * 100 );
+	}
+	return( 1 );
+}
+
+#elif defined( WINAPI )
+
+/* TODO */
+#error WINAPI timestamp type for Windows NT4 or earlier NOT implemented yet
+
+#else
+
+/* Determines the delta in nano seconds between the first and second timestamp
+ * The number_of_nano_seconds value with be negative if the first timestamp
+ * pre-dates the second timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_get_delta_in_nano_seconds(
+     libcdatetime_timestamp_t *first_timestamp,
+     libcdatetime_timestamp_t *second_timestamp,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_t *internal_first_timestamp  = NULL;
+	libcdatetime_internal_timestamp_t *internal_second_timestamp = NULL;
+	static char *function                                        = "libcdatetime_timestamp_get_delta_in_nano_seconds";
+
+	if( first_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_first_timestamp = (libcdatetime_internal_timestamp_t *) first_timestamp;
+
+	if( second_timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	internal_second_timestamp = (libcdatetime_internal_timestamp_t *) second_timestamp;
+
+	if( number_of_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( internal_second_timestamp->nano_seconds > 0 )
+	  && ( internal_first_timestamp->nano_seconds < ( (int64_t) INT64_MIN + internal_second_timestamp->nano_seconds ) ) )
+	 || ( ( internal_second_timestamp->nano_seconds < 0 )
+	  && ( internal_first_timestamp->nano_seconds > ( (int64_t) INT64_MAX + internal_second_timestamp->nano_seconds ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time delta value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nano_seconds = internal_first_timestamp->nano_seconds - internal_second_timestamp->nano_seconds;
+
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+/* Copies the timestamp to date and time elements in UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_copy_to_elements_utc(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_timestamp_copy_to_elements_utc";
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	     (libcdatetime_internal_elements_t *) elements,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the timestamp to date and time elements in localtime
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_copy_to_elements_localtime(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_timestamp_copy_to_elements_localtime";
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_localtime(
+	     (libcdatetime_internal_elements_t *) elements,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the timestamp to date and time elements with a fixed UTC offset
+ * The UTC offset is in minutes and is added to UTC to obtain the date and time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_copy_to_elements_with_utc_offset(
+     libcdatetime_timestamp_t *timestamp,
+     int16_t utc_offset,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_timestamp_copy_to_elements_with_utc_offset";
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_with_fixed_utc_offset(
+	     (libcdatetime_internal_elements_t *) elements,
+	     posix_time_in_nano_seconds,
+	     utc_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the timestamp to date and time elements in a timezone
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_copy_to_elements_in_timezone(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_timezone_t *timezone,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_timestamp_copy_to_elements_in_timezone";
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_in_timezone(
+	     (libcdatetime_internal_elements_t *) elements,
+	     posix_time_in_nano_seconds,
+	     timezone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set elements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the timestamp to date and time elements in multiple timezones
+ * The timestamp is decomposed once, after which only the UTC offset and
+ * the date rollover are determined for every timezone
+ * A NULL timezone represents the system timezone
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_copy_to_elements_in_timezones(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_timezone_t **timezones,
+     size_t number_of_timezones,
+     libcdatetime_elements_t **elements,
      libcerror_error_t **error )
 {
-	libcdatetime_internal_timestamp_t *internal_first_timestamp  = NULL;
-	libcdatetime_internal_timestamp_t *internal_second_timestamp = NULL;
-	static char *function                                        = "libcdatetime_timestamp_get_delta_in_seconds";
-	int64_t time_delta                                           = 0;
+	libcdatetime_internal_elements_t utc_elements;
 
-	if( first_timestamp == NULL )
+	static char *function              = "libcdatetime_timestamp_copy_to_elements_in_timezones";
+	size_t timezone_index              = 0;
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( timestamp == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid first timestamp.",
+		 "%s: invalid timestamp.",
 		 function );
 
 		return( -1 );
 	}
-	internal_first_timestamp = (libcdatetime_internal_timestamp_t *) first_timestamp;
-
-	if( second_timestamp == NULL )
+	if( timezones == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid second timestamp.",
+		 "%s: invalid timezones.",
 		 function );
 
 		return( -1 );
 	}
-	internal_second_timestamp = (libcdatetime_internal_timestamp_t *) second_timestamp;
+	if( number_of_timezones > (size_t) ( SSIZE_MAX / sizeof( libcdatetime_timezone_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of timezones value exceeds maximum.",
+		 function );
 
-	if( number_of_seconds == NULL )
+		return( -1 );
+	}
+	if( elements == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of seconds.",
+		 "%s: invalid elements.",
 		 function );
 
 		return( -1 );
 	}
-	time_delta = (int64_t) internal_first_timestamp->filetime.dwHighDateTime - (int64_t) internal_second_timestamp->filetime.dwHighDateTime;
-
-	if( time_delta < 0 )
+	if( libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
 	{
-		if( (uint64_t) -time_delta > (uint64_t) INT32_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	else
+	/* The time elements in UTC are stored on the stack to prevent an allocation
+	 */
+	if( memory_set(
+	     &utc_elements,
+	     0,
+	     sizeof( libcdatetime_internal_elements_t ) ) == NULL )
 	{
-		if( (uint64_t) time_delta > (uint64_t) INT64_MAX )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear time elements.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	time_delta <<= 32;
-
-	time_delta += (int64_t) internal_first_timestamp->filetime.dwLowDateTime - (int64_t) internal_second_timestamp->filetime.dwLowDateTime;
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	     &utc_elements,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from timestamp.",
+		 function );
 
-	if( time_delta < 0 )
+		return( -1 );
+	}
+	for( timezone_index = 0;
+	     timezone_index < number_of_timezones;
+	     timezone_index++ )
 	{
-		if( (uint64_t) -time_delta > (uint64_t) INT64_MAX )
+		if( elements[ timezone_index ] == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid elements: %" PRIzd ".",
+			 function,
+			 timezone_index );
 
 			return( -1 );
 		}
-	}
-	else
-	{
-		if( (uint64_t) time_delta > (uint64_t) INT64_MAX )
+		if( libcdatetime_internal_elements_set_in_timezone_from_utc_elements(
+		     (libcdatetime_internal_elements_t *) elements[ timezone_index ],
+		     &utc_elements,
+		     timezones[ timezone_index ],
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set elements: %" PRIzd ".",
+			 function,
+			 timezone_index );
 
 			return( -1 );
 		}
 	}
-	*number_of_seconds = (int64_t) time_delta;
-
 	return( 1 );
 }
 
+/* Determines the size of the string for the timestamp in any timezone
+ * The string size includes the end of string character and the UTC offset
+ * of a timezone, such as "+05:30" or "UTC+05:30:00", hence it is the size
+ * of every string of libcdatetime_timestamp_copy_to_strings_in_timezones
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_get_string_size_in_timezones(
+     libcdatetime_timestamp_t *timestamp,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_timestamp_get_string_size_in_timezones";
 
-#elif defined( WINAPI )
-
-/* TODO */
-#error WINAPI timestamp type for Windows NT4 or earlier NOT implemented yet
+	if( libcdatetime_timestamp_get_string_size(
+	     timestamp,
+	     string_size,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string size.",
+		 function );
 
-#else
+		return( -1 );
+	}
+	if( ( string_format_flags & LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR ) != 0 )
+	{
+		/* Example: UTC+00:00:00
+		 */
+		if( ( string_format_flags & 0x000000ffUL ) == LIBCDATETIME_STRING_FORMAT_TYPE_CTIME )
+		{
+			*string_size += 9;
+		}
+		/* Example: +00:00:00 instead of Z
+		 */
+		else
+		{
+			*string_size += 8;
+		}
+	}
+	return( 1 );
+}
 
-/* Determines the delta in seconds between the first and second timestamp
- * The number_of_seconds value with be negative if the first timestamp
- * pre-dates the second timestamp
+/* Converts the timestamp into strings in multiple timezones
+ * The strings are stored consecutively in a buffer of number of timezones times
+ * string size bytes, where every string size should include the end of string character
+ * The string size determined by libcdatetime_timestamp_get_string_size_in_timezones
+ * suffices for every timezone
+ * The timestamp is decomposed once, after which only the UTC offset and
+ * the date rollover are determined for every timezone
+ * A NULL timezone represents the system timezone
  * Returns 1 if successful or -1 on error
  */
-int libcdatetime_timestamp_get_delta_in_seconds(
-     libcdatetime_timestamp_t *first_timestamp,
-     libcdatetime_timestamp_t *second_timestamp,
-     int64_t *number_of_seconds,
+int libcdatetime_timestamp_copy_to_strings_in_timezones(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_timezone_t **timezones,
+     size_t number_of_timezones,
+     uint8_t *strings,
+     size_t string_size,
+     uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	libcdatetime_internal_timestamp_t *internal_first_timestamp  = NULL;
-	libcdatetime_internal_timestamp_t *internal_second_timestamp = NULL;
-	static char *function                                        = "libcdatetime_timestamp_set_current_time";
-	time_t time_delta                                            = 0;
+	libcdatetime_internal_elements_t internal_elements;
+	libcdatetime_internal_elements_t utc_elements;
 
-	if( first_timestamp == NULL )
+	static char *function              = "libcdatetime_timestamp_copy_to_strings_in_timezones";
+	size_t string_index                = 0;
+	size_t timezone_index              = 0;
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( timestamp == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid first timestamp.",
+		 "%s: invalid timestamp.",
 		 function );
 
 		return( -1 );
 	}
-	internal_first_timestamp = (libcdatetime_internal_timestamp_t *) first_timestamp;
+	if( timezones == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezones.",
+		 function );
 
-	if( second_timestamp == NULL )
+		return( -1 );
+	}
+	if( strings == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid second timestamp.",
+		 "%s: invalid strings.",
 		 function );
 
 		return( -1 );
 	}
-	internal_second_timestamp = (libcdatetime_internal_timestamp_t *) second_timestamp;
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
 
-	if( number_of_seconds == NULL )
+		return( -1 );
+	}
+	if( number_of_timezones > (size_t) ( SSIZE_MAX / string_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of seconds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of timezones value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The time elements are stored on the stack to prevent an allocation
+	 * for every conversion
+	 */
+	if( memory_set(
+	     &utc_elements,
+	     0,
+	     sizeof( libcdatetime_internal_elements_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear time elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &internal_elements,
+	     0,
+	     sizeof( libcdatetime_internal_elements_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear time elements.",
 		 function );
 
 		return( -1 );
 	}
-	time_delta = internal_first_timestamp->time - internal_second_timestamp->time;
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	     &utc_elements,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from timestamp.",
+		 function );
 
-	if( time_delta < 0 )
+		return( -1 );
+	}
+	for( timezone_index = 0;
+	     timezone_index < number_of_timezones;
+	     timezone_index++ )
 	{
-		if( (uint64_t) -time_delta > (uint64_t) INT64_MAX )
+		if( libcdatetime_internal_elements_set_in_timezone_from_utc_elements(
+		     &internal_elements,
+		     &utc_elements,
+		     timezones[ timezone_index ],
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set time elements: %" PRIzd ".",
+			 function,
+			 timezone_index );
 
 			return( -1 );
 		}
-	}
-	else
-	{
-		if( (uint64_t) time_delta > (uint64_t) INT64_MAX )
+		string_index = 0;
+
+		if( libcdatetime_elements_copy_to_string_with_index(
+		     (libcdatetime_elements_t *) &internal_elements,
+		     &( strings[ timezone_index * string_size ] ),
+		     string_size,
+		     &string_index,
+		     string_format_flags,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid time delta value out of bounds.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy time elements: %" PRIzd " to string.",
+			 function,
+			 timezone_index );
 
 			return( -1 );
 		}
 	}
-	*number_of_seconds = (int64_t) time_delta;
-
 	return( 1 );
 }
 
-#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
-
 /* Deterimes the size of the string for the timestamp
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -722,10 +1727,15 @@ int libcdatetime_timestamp_copy_to_string_with_index(
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	libcdatetime_elements_t *time_elements                = NULL;
+	libcdatetime_internal_elements_t internal_elements;
+
 	libcdatetime_internal_timestamp_t *internal_timestamp = NULL;
 	static char *function                                 = "libcdatetime_timestamp_copy_to_string_with_index";
 
+#if !defined( WINAPI )
+	int64_t posix_time_in_nano_seconds                    = 0;
+#endif
+
 	if( timestamp == NULL )
 	{
 		libcerror_error_set(
@@ -739,38 +1749,33 @@ int libcdatetime_timestamp_copy_to_string_with_index(
 	}
 	internal_timestamp = (libcdatetime_internal_timestamp_t *) timestamp;
 
-	if( libcdatetime_elements_initialize(
-	     &time_elements,
-	     error ) != 1 )
+	/* The time elements are stored on the stack to prevent an allocation
+	 * for every conversion
+	 */
+	if( memory_set(
+	     &internal_elements,
+	     0,
+	     sizeof( libcdatetime_internal_elements_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create time elements.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear time elements.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO convert timestamp into elements */
-
-#if defined( WINAPI ) && ( WINVER < 0x0500 )
-/* TODO */
-#error WINAPI support for Windows NT4 or earlier NOT implemented yet
-#endif
-
-/* TODO move this function into time elements ? */
 #if defined( WINAPI )
+	/* The FILETIME is used directly since it can represent
+	 * a larger range of dates than a POSIX time in nano seconds
+	 */
+	internal_elements.filetime = internal_timestamp->filetime;
+
 	if( libcdatetime_internal_elements_set_from_filetime_utc(
-	     (libcdatetime_internal_elements_t *) time_elements,
-	     &( internal_timestamp->filetime ),
+	     &internal_elements,
+	     &( internal_elements.filetime ),
 	     error ) != 1 )
-#else
-	if( libcdatetime_internal_elements_set_from_time_utc(
-	     (libcdatetime_internal_elements_t *) time_elements,
-	     &( internal_timestamp->time ),
-	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
@@ -779,47 +1784,56 @@ int libcdatetime_timestamp_copy_to_string_with_index(
 		 "%s: unable to set time elements from timestamp.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdatetime_elements_copy_to_string_with_index(
-	     time_elements,
-	     string,
-	     string_size,
-	     string_index,
-	     string_format_flags,
+#else
+	if( libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	     internal_timestamp,
+	     &posix_time_in_nano_seconds,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy time elements to string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time in nano seconds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdatetime_elements_free(
-	     &time_elements,
+	if( libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	     &internal_elements,
+	     posix_time_in_nano_seconds,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free time elements.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time elements from timestamp.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+#endif
 
-on_error:
-	if( time_elements != NULL )
+	if( libcdatetime_elements_copy_to_string_with_index(
+	     (libcdatetime_elements_t *) &internal_elements,
+	     string,
+	     string_size,
+	     string_index,
+	     string_format_flags,
+	     error ) != 1 )
 	{
-		libcdatetime_elements_free(
-		 &time_elements,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy time elements to string.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
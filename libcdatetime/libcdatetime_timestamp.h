@@ -33,6 +33,7 @@
 #include <time.h>
 #endif /* !defined( WINAPI ) */
 
+#include "libcdatetime_clock.h"
 #include "libcdatetime_extern.h"
 #include "libcdatetime_libcerror.h"
 #include "libcdatetime_types.h"
@@ -56,10 +57,14 @@ struct libcdatetime_internal_timestamp
 #error WINAPI timestamp type for Windows NT4 or earlier NOT implemented yet
 
 #else
-	/* The time
+	/* The number of nano seconds since January 1, 1970 00:00:00 UTC
 	 */
-	time_t time;
+	int64_t nano_seconds;
 #endif
+
+	/* The clock settings
+	 */
+	libcdatetime_clock_settings_t clock_settings;
 };
 
 LIBCDATETIME_EXTERN \
@@ -78,6 +83,32 @@ int libcdatetime_timestamp_copy(
      const libcdatetime_timestamp_t *source_timestamp,
      libcerror_error_t **error );
 
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_set_clock_source(
+     libcdatetime_timestamp_t *timestamp,
+     int clock_source,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_set_clock_callback(
+     libcdatetime_timestamp_t *timestamp,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+     libcdatetime_internal_timestamp_t *internal_timestamp,
+     int64_t posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+     libcdatetime_internal_timestamp_t *internal_timestamp,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
 LIBCDATETIME_EXTERN \
 int libcdatetime_timestamp_set_current_time(
      libcdatetime_timestamp_t *timestamp,
@@ -90,6 +121,72 @@ int libcdatetime_timestamp_get_delta_in_seconds(
      int64_t *number_of_seconds,
      libcerror_error_t **error );
 
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+     libcdatetime_timestamp_t *first_timestamp,
+     libcdatetime_timestamp_t *second_timestamp,
+     int64_t *number_of_seconds,
+     int32_t *nano_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_get_delta_in_nano_seconds(
+     libcdatetime_timestamp_t *first_timestamp,
+     libcdatetime_timestamp_t *second_timestamp,
+     int64_t *number_of_nano_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_copy_to_elements_utc(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_copy_to_elements_localtime(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_copy_to_elements_with_utc_offset(
+     libcdatetime_timestamp_t *timestamp,
+     int16_t utc_offset,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_copy_to_elements_in_timezone(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_timezone_t *timezone,
+     libcdatetime_elements_t *elements,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_copy_to_elements_in_timezones(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_timezone_t **timezones,
+     size_t number_of_timezones,
+     libcdatetime_elements_t **elements,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_get_string_size_in_timezones(
+     libcdatetime_timestamp_t *timestamp,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_copy_to_strings_in_timezones(
+     libcdatetime_timestamp_t *timestamp,
+     libcdatetime_timezone_t **timezones,
+     size_t number_of_timezones,
+     uint8_t *strings,
+     size_t string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
 LIBCDATETIME_EXTERN \
 int libcdatetime_timestamp_get_string_size(
      libcdatetime_timestamp_t *timestamp,
@@ -0,0 +1,685 @@
+/*
+ * Timestamp generator functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdatetime_atomic.h"
+#include "libcdatetime_clock.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_timestamp.h"
+#include "libcdatetime_timestamp_generator.h"
+#include "libcdatetime_types.h"
+
+/* Creates a timestamp generator
+ * Make sure the value timestamp_generator is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_generator_initialize(
+     libcdatetime_timestamp_generator_t **timestamp_generator,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_generator_t *internal_timestamp_generator = NULL;
+	static char *function                                                     = "libcdatetime_timestamp_generator_initialize";
+
+	if( timestamp_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timestamp_generator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timestamp generator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timestamp_generator = memory_allocate_structure(
+	                                libcdatetime_internal_timestamp_generator_t );
+
+	if( internal_timestamp_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timestamp generator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_timestamp_generator,
+	     0,
+	     sizeof( libcdatetime_internal_timestamp_generator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timestamp generator.",
+		 function );
+
+		goto on_error;
+	}
+	/* Any value returned by the clock is larger than the initial last value
+	 */
+	internal_timestamp_generator->last_posix_time_in_nano_seconds = (int64_t) INT64_MIN;
+
+	*timestamp_generator = (libcdatetime_timestamp_generator_t *) internal_timestamp_generator;
+
+	return( 1 );
+
+on_error:
+	if( internal_timestamp_generator != NULL )
+	{
+		memory_free(
+		 internal_timestamp_generator );
+	}
+	return( -1 );
+}
+
+/* Frees a timestamp generator
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_generator_free(
+     libcdatetime_timestamp_generator_t **timestamp_generator,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_generator_t *internal_timestamp_generator = NULL;
+	static char *function                                                     = "libcdatetime_timestamp_generator_free";
+
+	if( timestamp_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timestamp_generator != NULL )
+	{
+		internal_timestamp_generator = (libcdatetime_internal_timestamp_generator_t *) *timestamp_generator;
+		*timestamp_generator         = NULL;
+
+		memory_free(
+		 internal_timestamp_generator );
+	}
+	return( 1 );
+}
+
+/* Sets the clock source of the timestamp generator
+ * Setting the clock source to LIBCDATETIME_CLOCK_SOURCE_DEFAULT makes the timestamp
+ * generator use the clock source set for the process
+ * The clock source should not be changed while other threads use the timestamp generator
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_generator_set_clock_source(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int clock_source,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_generator_t *internal_timestamp_generator = NULL;
+	static char *function                                                     = "libcdatetime_timestamp_generator_set_clock_source";
+
+	if( timestamp_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timestamp_generator = (libcdatetime_internal_timestamp_generator_t *) timestamp_generator;
+
+	if( libcdatetime_clock_settings_set_clock_source(
+	     &( internal_timestamp_generator->clock_settings ),
+	     clock_source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a callback function as the clock source of the timestamp generator
+ * The callback function should retrieve the current time as the number
+ * of nano seconds since January 1, 1970 00:00:00 UTC and return 1 if
+ * successful or -1 on error
+ * The clock source should not be changed while other threads use the timestamp generator
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_generator_set_clock_callback(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_generator_t *internal_timestamp_generator = NULL;
+	static char *function                                                     = "libcdatetime_timestamp_generator_set_clock_callback";
+
+	if( timestamp_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timestamp_generator = (libcdatetime_internal_timestamp_generator_t *) timestamp_generator;
+
+	if( libcdatetime_clock_settings_set_clock_callback(
+	     &( internal_timestamp_generator->clock_settings ),
+	     callback_function,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set clock callback.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next value of the timestamp generator
+ * The value is the current time of the clock source, or the last value plus
+ * LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION when the clock source did not
+ * advance, hence values never repeat or go backwards, also not across threads
+ * This function is lock-free and safe to call from multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_generator_t *internal_timestamp_generator = NULL;
+	static char *function                                                     = "libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds";
+	int64_t current_posix_time_in_nano_seconds                                = 0;
+	int64_t last_posix_time_in_nano_seconds                                   = 0;
+	int64_t next_posix_time_in_nano_seconds                                   = 0;
+	int64_t remainder                                                         = 0;
+
+	if( timestamp_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timestamp_generator = (libcdatetime_internal_timestamp_generator_t *) timestamp_generator;
+
+	if( posix_time_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_timestamp_generator->clock_settings ),
+	     &current_posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	/* Round the current time down to the resolution
+	 */
+	remainder = current_posix_time_in_nano_seconds % LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+
+	if( remainder < 0 )
+	{
+		remainder += LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+	}
+	current_posix_time_in_nano_seconds -= remainder;
+
+	last_posix_time_in_nano_seconds = libcdatetime_atomic_load_int64(
+	                                   &( internal_timestamp_generator->last_posix_time_in_nano_seconds ) );
+
+	do
+	{
+		if( current_posix_time_in_nano_seconds > last_posix_time_in_nano_seconds )
+		{
+			next_posix_time_in_nano_seconds = current_posix_time_in_nano_seconds;
+		}
+		else if( last_posix_time_in_nano_seconds > ( (int64_t) INT64_MAX - LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid last POSIX time value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			next_posix_time_in_nano_seconds = last_posix_time_in_nano_seconds + LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+		}
+		if( libcdatetime_atomic_compare_and_swap_int64(
+		     &( internal_timestamp_generator->last_posix_time_in_nano_seconds ),
+		     last_posix_time_in_nano_seconds,
+		     next_posix_time_in_nano_seconds ) != 0 )
+		{
+			break;
+		}
+		/* Another thread generated a value in the meantime
+		 */
+		last_posix_time_in_nano_seconds = libcdatetime_atomic_load_int64(
+		                                   &( internal_timestamp_generator->last_posix_time_in_nano_seconds ) );
+	}
+	while( 1 );
+
+	*posix_time_in_nano_seconds = next_posix_time_in_nano_seconds;
+
+	return( 1 );
+}
+
+/* Retrieves the next values of the timestamp generator for a batch of events
+ * The clock source is read once for the entire batch and the values are
+ * strictly increasing, also with respect to values generated by other threads
+ * Without flags the values start at the current time and are
+ * LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION apart
+ * With LIBCDATETIME_TIMESTAMP_GENERATOR_FLAG_INTERPOLATE the values are spread
+ * evenly between the last generated value and the current time, where the last
+ * value of the batch is the current time, e.g. to stamp the events of a queue
+ * that were received since the previous batch. The interpolation starts at most
+ * LIBCDATETIME_TIMESTAMP_GENERATOR_MAXIMUM_INTERPOLATION_SPAN before the current
+ * time, so that a batch after an idle period is not spread across the idle period
+ * This function is lock-free and safe to call from multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int64_t *posix_times_in_nano_seconds,
+     size_t number_of_posix_times,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_generator_t *internal_timestamp_generator = NULL;
+	static char *function                                                     = "libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds";
+	size_t value_index                                                        = 0;
+	uint64_t time_span                                                        = 0;
+	int64_t current_posix_time_in_nano_seconds                                = 0;
+	int64_t first_posix_time_in_nano_seconds                                  = 0;
+	int64_t interpolation_start_in_nano_seconds                               = 0;
+	int64_t last_posix_time_in_nano_seconds                                   = 0;
+	int64_t next_posix_time_in_nano_seconds                                   = 0;
+	int64_t remainder                                                         = 0;
+	int64_t step_in_nano_seconds                                              = 0;
+
+	if( timestamp_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timestamp_generator = (libcdatetime_internal_timestamp_generator_t *) timestamp_generator;
+
+	if( posix_times_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX times in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_posix_times == 0 )
+	 || ( number_of_posix_times > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of POSIX times value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCDATETIME_TIMESTAMP_GENERATOR_FLAG_INTERPOLATE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_timestamp_generator->clock_settings ),
+	     &current_posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	/* Round the current time down to the resolution
+	 */
+	remainder = current_posix_time_in_nano_seconds % LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+
+	if( remainder < 0 )
+	{
+		remainder += LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+	}
+	current_posix_time_in_nano_seconds -= remainder;
+
+	last_posix_time_in_nano_seconds = libcdatetime_atomic_load_int64(
+	                                   &( internal_timestamp_generator->last_posix_time_in_nano_seconds ) );
+
+	do
+	{
+		step_in_nano_seconds = LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+
+		/* The initial last value is INT64_MIN, in which case there is
+		 * no previous value to interpolate from
+		 */
+		if( ( ( flags & LIBCDATETIME_TIMESTAMP_GENERATOR_FLAG_INTERPOLATE ) != 0 )
+		 && ( last_posix_time_in_nano_seconds != INT64_MIN )
+		 && ( current_posix_time_in_nano_seconds > last_posix_time_in_nano_seconds ) )
+		{
+			interpolation_start_in_nano_seconds = last_posix_time_in_nano_seconds;
+
+			time_span = (uint64_t) current_posix_time_in_nano_seconds - (uint64_t) last_posix_time_in_nano_seconds;
+
+			if( time_span > (uint64_t) LIBCDATETIME_TIMESTAMP_GENERATOR_MAXIMUM_INTERPOLATION_SPAN )
+			{
+				interpolation_start_in_nano_seconds = current_posix_time_in_nano_seconds - LIBCDATETIME_TIMESTAMP_GENERATOR_MAXIMUM_INTERPOLATION_SPAN;
+
+				time_span = (uint64_t) LIBCDATETIME_TIMESTAMP_GENERATOR_MAXIMUM_INTERPOLATION_SPAN;
+			}
+			time_span = time_span / number_of_posix_times;
+
+			/* Round the step down to the resolution
+			 */
+			time_span -= time_span % LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+
+			if( time_span > (uint64_t) LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION )
+			{
+				step_in_nano_seconds = (int64_t) time_span;
+			}
+			/* Both values are multiples of the resolution hence the first value
+			 * does not exceed the current time
+			 */
+			first_posix_time_in_nano_seconds = interpolation_start_in_nano_seconds + step_in_nano_seconds;
+		}
+		else if( current_posix_time_in_nano_seconds > last_posix_time_in_nano_seconds )
+		{
+			first_posix_time_in_nano_seconds = current_posix_time_in_nano_seconds;
+		}
+		else if( last_posix_time_in_nano_seconds > ( (int64_t) INT64_MAX - LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid last POSIX time value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			first_posix_time_in_nano_seconds = last_posix_time_in_nano_seconds + LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+		}
+		if( (uint64_t) ( number_of_posix_times - 1 ) > ( (uint64_t) ( (int64_t) INT64_MAX - first_posix_time_in_nano_seconds ) / (uint64_t) step_in_nano_seconds ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of POSIX times value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		next_posix_time_in_nano_seconds = first_posix_time_in_nano_seconds + ( (int64_t) ( number_of_posix_times - 1 ) * step_in_nano_seconds );
+
+		/* The entire batch is reserved with a single compare and swap
+		 */
+		if( libcdatetime_atomic_compare_and_swap_int64(
+		     &( internal_timestamp_generator->last_posix_time_in_nano_seconds ),
+		     last_posix_time_in_nano_seconds,
+		     next_posix_time_in_nano_seconds ) != 0 )
+		{
+			break;
+		}
+		/* Another thread generated a value in the meantime
+		 */
+		last_posix_time_in_nano_seconds = libcdatetime_atomic_load_int64(
+		                                   &( internal_timestamp_generator->last_posix_time_in_nano_seconds ) );
+	}
+	while( 1 );
+
+	for( value_index = 0;
+	     value_index < number_of_posix_times;
+	     value_index++ )
+	{
+		posix_times_in_nano_seconds[ value_index ] = first_posix_time_in_nano_seconds + ( (int64_t) value_index * step_in_nano_seconds );
+	}
+	return( 1 );
+}
+
+/* Sets a timestamp to the next value of the timestamp generator
+ * This function is lock-free and safe to call from multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_generator_get_next_timestamp(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error )
+{
+	static char *function              = "libcdatetime_timestamp_generator_get_next_timestamp";
+	int64_t posix_time_in_nano_seconds = 0;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	     timestamp_generator,
+	     &posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timestamp_set_from_posix_time_in_nano_seconds(
+	     (libcdatetime_internal_timestamp_t *) timestamp,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the drift of the timestamp generator
+ * The drift is the number of nano seconds the last value is ahead of the current
+ * time of the clock source, which grows when values are requested faster than
+ * the resolution of the clock source or when the clock source was set backwards
+ * The drift is 0 if the last value is not ahead of the current time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timestamp_generator_get_drift_in_nano_seconds(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int64_t *drift_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timestamp_generator_t *internal_timestamp_generator = NULL;
+	static char *function                                                     = "libcdatetime_timestamp_generator_get_drift_in_nano_seconds";
+	int64_t current_posix_time_in_nano_seconds                                = 0;
+	int64_t last_posix_time_in_nano_seconds                                   = 0;
+
+	if( timestamp_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timestamp_generator = (libcdatetime_internal_timestamp_generator_t *) timestamp_generator;
+
+	if( drift_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid drift in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_clock_settings_get_current_time(
+	     &( internal_timestamp_generator->clock_settings ),
+	     &current_posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	last_posix_time_in_nano_seconds = libcdatetime_atomic_load_int64(
+	                                   &( internal_timestamp_generator->last_posix_time_in_nano_seconds ) );
+
+	/* Both values are compared before subtracting since the initial last value is INT64_MIN
+	 */
+	if( last_posix_time_in_nano_seconds <= current_posix_time_in_nano_seconds )
+	{
+		*drift_in_nano_seconds = 0;
+	}
+	else if( ( current_posix_time_in_nano_seconds < 0 )
+	      && ( last_posix_time_in_nano_seconds > ( (int64_t) INT64_MAX + current_posix_time_in_nano_seconds ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid drift value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	else
+	{
+		*drift_in_nano_seconds = last_posix_time_in_nano_seconds - current_posix_time_in_nano_seconds;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Timestamp generator functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_TIMESTAMP_GENERATOR_H )
+#define _LIBCDATETIME_TIMESTAMP_GENERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_clock.h"
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The resolution of the generated values in nano seconds, which matches
+ * the resolution of a timestamp so that successive timestamps differ
+ */
+#if defined( WINAPI )
+#define LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION	100
+#else
+#define LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION	1
+#endif
+
+/* The maximum number of nano seconds before the current time over which
+ * the values of a batch are interpolated, which is a multiple of the resolution
+ */
+#if !defined( LIBCDATETIME_TIMESTAMP_GENERATOR_MAXIMUM_INTERPOLATION_SPAN )
+#define LIBCDATETIME_TIMESTAMP_GENERATOR_MAXIMUM_INTERPOLATION_SPAN	1000000000LL
+#endif
+
+typedef struct libcdatetime_internal_timestamp_generator libcdatetime_internal_timestamp_generator_t;
+
+struct libcdatetime_internal_timestamp_generator
+{
+	/* The last generated value as the number of nano seconds since January 1, 1970 00:00:00 UTC
+	 */
+	int64_t last_posix_time_in_nano_seconds;
+
+	/* The clock settings
+	 */
+	libcdatetime_clock_settings_t clock_settings;
+};
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_generator_initialize(
+     libcdatetime_timestamp_generator_t **timestamp_generator,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_generator_free(
+     libcdatetime_timestamp_generator_t **timestamp_generator,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_generator_set_clock_source(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int clock_source,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_generator_set_clock_callback(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            int64_t *posix_time_in_nano_seconds,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int64_t *posix_times_in_nano_seconds,
+     size_t number_of_posix_times,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_generator_get_next_timestamp(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     libcdatetime_timestamp_t *timestamp,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timestamp_generator_get_drift_in_nano_seconds(
+     libcdatetime_timestamp_generator_t *timestamp_generator,
+     int64_t *drift_in_nano_seconds,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_TIMESTAMP_GENERATOR_H ) */
+
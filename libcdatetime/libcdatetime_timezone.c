@@ -0,0 +1,3197 @@
+/*
+ * Timezone functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_timezone.h"
+#include "libcdatetime_timezone_database.h"
+#include "libcdatetime_timezone_rule.h"
+#include "libcdatetime_types.h"
+
+/* Creates a timezone
+ * Make sure the value timezone is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_initialize(
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	static char *function                               = "libcdatetime_timezone_initialize";
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timezone != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone = memory_allocate_structure(
+	                     libcdatetime_internal_timezone_t );
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timezone.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_timezone,
+	     0,
+	     sizeof( libcdatetime_internal_timezone_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timezone.",
+		 function );
+
+		goto on_error;
+	}
+	*timezone = (libcdatetime_timezone_t *) internal_timezone;
+
+	return( 1 );
+
+on_error:
+	if( internal_timezone != NULL )
+	{
+		memory_free(
+		 internal_timezone );
+	}
+	return( -1 );
+}
+
+/* Frees a timezone
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_free(
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	static char *function                               = "libcdatetime_timezone_free";
+	int result                                          = 1;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timezone != NULL )
+	{
+		internal_timezone = (libcdatetime_internal_timezone_t *) *timezone;
+		*timezone         = NULL;
+
+		if( internal_timezone->transition_times != NULL )
+		{
+			memory_free(
+			 internal_timezone->transition_times );
+		}
+		if( internal_timezone->transition_local_time_type_indexes != NULL )
+		{
+			memory_free(
+			 internal_timezone->transition_local_time_type_indexes );
+		}
+		if( internal_timezone->local_time_types != NULL )
+		{
+			memory_free(
+			 internal_timezone->local_time_types );
+		}
+		if( internal_timezone->abbreviations != NULL )
+		{
+			memory_free(
+			 internal_timezone->abbreviations );
+		}
+		if( internal_timezone->rule_string != NULL )
+		{
+			memory_free(
+			 internal_timezone->rule_string );
+		}
+		if( internal_timezone->rule != NULL )
+		{
+			if( libcdatetime_timezone_rule_free(
+			     &( internal_timezone->rule ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free rule.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_timezone );
+	}
+	return( result );
+}
+
+/* Reads a TZif file header
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_file_header_read_data(
+     libcdatetime_timezone_file_header_t *file_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_timezone_file_header_read_data";
+
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < LIBCDATETIME_TIMEZONE_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data[ 0 ] != (uint8_t) 'T' )
+	 || ( data[ 1 ] != (uint8_t) 'Z' )
+	 || ( data[ 2 ] != (uint8_t) 'i' )
+	 || ( data[ 3 ] != (uint8_t) 'f' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	/* The format version is either 0 or an ASCII digit
+	 */
+	if( data[ 4 ] == 0 )
+	{
+		file_header->format_version = 1;
+	}
+	else if( ( data[ 4 ] >= (uint8_t) '2' )
+	      && ( data[ 4 ] <= (uint8_t) '4' ) )
+	{
+		file_header->format_version = data[ 4 ] - (uint8_t) '0';
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: 0x%02" PRIx8 ".",
+		 function,
+		 data[ 4 ] );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 20 ] ),
+	 file_header->number_of_utc_indicators );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 24 ] ),
+	 file_header->number_of_standard_indicators );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 28 ] ),
+	 file_header->number_of_leap_seconds );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 32 ] ),
+	 file_header->number_of_transitions );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 36 ] ),
+	 file_header->number_of_local_time_types );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 40 ] ),
+	 file_header->abbreviations_size );
+
+	/* The local time type indexes are stored in 8-bit values
+	 */
+	if( ( file_header->number_of_local_time_types == 0 )
+	 || ( file_header->number_of_local_time_types > 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of local time types value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header->abbreviations_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid abbreviations size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_header->number_of_utc_indicators != 0 )
+	 && ( file_header->number_of_utc_indicators != file_header->number_of_local_time_types ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of UT/local indicators value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_header->number_of_standard_indicators != 0 )
+	 && ( file_header->number_of_standard_indicators != file_header->number_of_local_time_types ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of standard/wall indicators value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the size of the data block that follows a TZif file header
+ * The time value size is 4 for the version 1 data block and 8 otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_file_header_get_data_block_size(
+     libcdatetime_timezone_file_header_t *file_header,
+     size_t time_value_size,
+     size_t *data_block_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libcdatetime_timezone_file_header_get_data_block_size";
+	uint64_t safe_data_block_size = 0;
+
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( time_value_size != 4 )
+	 && ( time_value_size != 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported time value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every count is a 32-bit value hence the size cannot overflow a 64-bit value
+	 */
+	safe_data_block_size = ( (uint64_t) file_header->number_of_transitions * ( time_value_size + 1 ) )
+	                     + ( (uint64_t) file_header->number_of_local_time_types * 6 )
+	                     + (uint64_t) file_header->abbreviations_size
+	                     + ( (uint64_t) file_header->number_of_leap_seconds * ( time_value_size + 4 ) )
+	                     + (uint64_t) file_header->number_of_standard_indicators
+	                     + (uint64_t) file_header->number_of_utc_indicators;
+
+	if( safe_data_block_size > (uint64_t) LIBCDATETIME_TIMEZONE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*data_block_size = (size_t) safe_data_block_size;
+
+	return( 1 );
+}
+
+/* Reads the transitions, local time types and abbreviations of a TZif data block
+ * Leap second records and the standard/wall and UT/local indicators are not used
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_timezone_read_data_block(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     libcdatetime_timezone_file_header_t *file_header,
+     const uint8_t *data,
+     size_t data_size,
+     size_t time_value_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	static char *function                                    = "libcdatetime_internal_timezone_read_data_block";
+	size_t data_block_size                                   = 0;
+	size_t data_offset                                       = 0;
+	uint64_t value_64bit                                     = 0;
+	uint32_t transition_index                                = 0;
+	uint32_t value_32bit                                     = 0;
+	uint16_t local_time_type_index                           = 0;
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_timezone->transition_times != NULL )
+	 || ( internal_timezone->transition_local_time_type_indexes != NULL )
+	 || ( internal_timezone->local_time_types != NULL )
+	 || ( internal_timezone->abbreviations != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone - transitions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_timezone_file_header_get_data_block_size(
+	     file_header,
+	     time_value_size,
+	     &data_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < data_block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header->number_of_transitions > 0 )
+	{
+		internal_timezone->transition_times = (int64_t *) memory_allocate(
+		                                                   sizeof( int64_t ) * file_header->number_of_transitions );
+
+		if( internal_timezone->transition_times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create transition times.",
+			 function );
+
+			goto on_error;
+		}
+		internal_timezone->transition_local_time_type_indexes = (uint8_t *) memory_allocate(
+		                                                                     sizeof( uint8_t ) * file_header->number_of_transitions );
+
+		if( internal_timezone->transition_local_time_type_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create transition local time type indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_timezone->local_time_types = (libcdatetime_timezone_local_time_type_t *) memory_allocate(
+	                                                                                   sizeof( libcdatetime_timezone_local_time_type_t ) * file_header->number_of_local_time_types );
+
+	if( internal_timezone->local_time_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create local time types.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timezone->abbreviations = (char *) memory_allocate(
+	                                             sizeof( char ) * file_header->abbreviations_size );
+
+	if( internal_timezone->abbreviations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create abbreviations.",
+		 function );
+
+		goto on_error;
+	}
+	for( transition_index = 0;
+	     transition_index < file_header->number_of_transitions;
+	     transition_index++ )
+	{
+		if( time_value_size == 4 )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( data[ data_offset ] ),
+			 value_32bit );
+
+			internal_timezone->transition_times[ transition_index ] = (int64_t) (int32_t) value_32bit;
+		}
+		else
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( data[ data_offset ] ),
+			 value_64bit );
+
+			internal_timezone->transition_times[ transition_index ] = (int64_t) value_64bit;
+		}
+		data_offset += time_value_size;
+
+		if( ( transition_index > 0 )
+		 && ( internal_timezone->transition_times[ transition_index ] <= internal_timezone->transition_times[ transition_index - 1 ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid transition: %" PRIu32 " time value out of bounds.",
+			 function,
+			 transition_index );
+
+			goto on_error;
+		}
+	}
+	for( transition_index = 0;
+	     transition_index < file_header->number_of_transitions;
+	     transition_index++ )
+	{
+		if( (uint32_t) data[ data_offset ] >= file_header->number_of_local_time_types )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid transition: %" PRIu32 " local time type index value out of bounds.",
+			 function,
+			 transition_index );
+
+			goto on_error;
+		}
+		internal_timezone->transition_local_time_type_indexes[ transition_index ] = data[ data_offset ];
+
+		data_offset += 1;
+	}
+	for( local_time_type_index = 0;
+	     local_time_type_index < (uint16_t) file_header->number_of_local_time_types;
+	     local_time_type_index++ )
+	{
+		local_time_type = &( internal_timezone->local_time_types[ local_time_type_index ] );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		local_time_type->utc_offset              = (int32_t) value_32bit;
+		local_time_type->is_daylight_saving_time = data[ data_offset + 4 ];
+		local_time_type->abbreviation_index      = data[ data_offset + 5 ];
+
+		data_offset += 6;
+
+		if( ( local_time_type->utc_offset < LIBCDATETIME_TIMEZONE_MINIMUM_UTC_OFFSET )
+		 || ( local_time_type->utc_offset > LIBCDATETIME_TIMEZONE_MAXIMUM_UTC_OFFSET ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid local time type: %" PRIu16 " UTC offset value out of bounds.",
+			 function,
+			 local_time_type_index );
+
+			goto on_error;
+		}
+		if( local_time_type->is_daylight_saving_time > 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported local time type: %" PRIu16 " daylight saving time value.",
+			 function,
+			 local_time_type_index );
+
+			goto on_error;
+		}
+		if( (uint32_t) local_time_type->abbreviation_index >= file_header->abbreviations_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid local time type: %" PRIu16 " abbreviation index value out of bounds.",
+			 function,
+			 local_time_type_index );
+
+			goto on_error;
+		}
+	}
+	/* The abbreviations must be terminated by an end of string character
+	 */
+	if( data[ data_offset + file_header->abbreviations_size - 1 ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported abbreviations - missing end of string character.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_timezone->abbreviations,
+	     &( data[ data_offset ] ),
+	     (size_t) file_header->abbreviations_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy abbreviations.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timezone->number_of_transitions      = file_header->number_of_transitions;
+	internal_timezone->number_of_local_time_types = (uint16_t) file_header->number_of_local_time_types;
+	internal_timezone->abbreviations_size         = (size_t) file_header->abbreviations_size;
+
+	return( 1 );
+
+on_error:
+	if( internal_timezone->abbreviations != NULL )
+	{
+		memory_free(
+		 internal_timezone->abbreviations );
+
+		internal_timezone->abbreviations = NULL;
+	}
+	if( internal_timezone->local_time_types != NULL )
+	{
+		memory_free(
+		 internal_timezone->local_time_types );
+
+		internal_timezone->local_time_types = NULL;
+	}
+	if( internal_timezone->transition_local_time_type_indexes != NULL )
+	{
+		memory_free(
+		 internal_timezone->transition_local_time_type_indexes );
+
+		internal_timezone->transition_local_time_type_indexes = NULL;
+	}
+	if( internal_timezone->transition_times != NULL )
+	{
+		memory_free(
+		 internal_timezone->transition_times );
+
+		internal_timezone->transition_times = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the footer of TZif version 2 or later data
+ * The footer contains a POSIX TZ rule string enclosed by new line characters
+ * Returns 1 if successful, 0 if no footer is present or -1 on error
+ */
+int libcdatetime_internal_timezone_read_footer(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcdatetime_internal_timezone_read_footer";
+	size_t rule_string_size = 0;
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timezone->rule_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone - rule string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 2 )
+	 || ( data[ 0 ] != (uint8_t) '\n' ) )
+	{
+		return( 0 );
+	}
+	for( rule_string_size = 0;
+	     ( rule_string_size + 1 ) < data_size;
+	     rule_string_size++ )
+	{
+		if( data[ rule_string_size + 1 ] == (uint8_t) '\n' )
+		{
+			break;
+		}
+		if( data[ rule_string_size + 1 ] == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( rule_string_size + 1 ) >= data_size )
+	{
+		return( 0 );
+	}
+	/* An empty rule string indicates there is no rule
+	 */
+	if( rule_string_size == 0 )
+	{
+		return( 0 );
+	}
+	internal_timezone->rule_string = (char *) memory_allocate(
+	                                           sizeof( char ) * ( rule_string_size + 1 ) );
+
+	if( internal_timezone->rule_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create rule string.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_timezone->rule_string,
+	     &( data[ 1 ] ),
+	     rule_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy rule string.",
+		 function );
+
+		memory_free(
+		 internal_timezone->rule_string );
+
+		internal_timezone->rule_string = NULL;
+
+		return( -1 );
+	}
+	internal_timezone->rule_string[ rule_string_size ] = 0;
+
+	internal_timezone->rule_string_size = rule_string_size + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the local time type with a specific UTC offset, daylight saving time indicator and abbreviation
+ * A local time type that is not present is appended to the local time types
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_timezone_find_local_time_type_index(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     int32_t utc_offset,
+     uint8_t is_daylight_saving_time,
+     const char *abbreviation,
+     uint8_t *local_time_type_index,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_local_time_type_t *local_time_type  = NULL;
+	libcdatetime_timezone_local_time_type_t *local_time_types = NULL;
+	char *abbreviations                                       = NULL;
+	static char *function                                     = "libcdatetime_internal_timezone_find_local_time_type_index";
+	size_t abbreviation_index                                 = 0;
+	size_t abbreviation_size                                  = 0;
+	uint16_t safe_local_time_type_index                       = 0;
+	uint8_t is_abbreviation_found                             = 0;
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( abbreviation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abbreviation.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_time_type_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local time type index.",
+		 function );
+
+		return( -1 );
+	}
+	abbreviation_size = narrow_string_length(
+	                     abbreviation ) + 1;
+
+	for( safe_local_time_type_index = 0;
+	     safe_local_time_type_index < internal_timezone->number_of_local_time_types;
+	     safe_local_time_type_index++ )
+	{
+		local_time_type = &( internal_timezone->local_time_types[ safe_local_time_type_index ] );
+
+		if( ( (size_t) local_time_type->abbreviation_index + abbreviation_size ) > internal_timezone->abbreviations_size )
+		{
+			continue;
+		}
+		if( memory_compare(
+		     &( internal_timezone->abbreviations[ local_time_type->abbreviation_index ] ),
+		     abbreviation,
+		     abbreviation_size ) != 0 )
+		{
+			continue;
+		}
+		if( ( local_time_type->utc_offset == utc_offset )
+		 && ( local_time_type->is_daylight_saving_time == is_daylight_saving_time ) )
+		{
+			*local_time_type_index = (uint8_t) safe_local_time_type_index;
+
+			return( 1 );
+		}
+		abbreviation_index    = (size_t) local_time_type->abbreviation_index;
+		is_abbreviation_found = 1;
+	}
+	if( internal_timezone->number_of_local_time_types >= 256 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid timezone - number of local time types value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_abbreviation_found == 0 )
+	{
+		abbreviation_index = internal_timezone->abbreviations_size;
+
+		/* The abbreviation index is stored as an 8-bit value
+		 */
+		if( abbreviation_index > 255 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid timezone - abbreviations size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		abbreviations = (char *) memory_reallocate(
+		                          internal_timezone->abbreviations,
+		                          sizeof( char ) * ( abbreviation_index + abbreviation_size ) );
+
+		if( abbreviations == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize abbreviations.",
+			 function );
+
+			return( -1 );
+		}
+		internal_timezone->abbreviations = abbreviations;
+
+		if( memory_copy(
+		     &( abbreviations[ abbreviation_index ] ),
+		     abbreviation,
+		     abbreviation_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy abbreviation.",
+			 function );
+
+			return( -1 );
+		}
+		internal_timezone->abbreviations_size += abbreviation_size;
+	}
+	local_time_types = (libcdatetime_timezone_local_time_type_t *) memory_reallocate(
+	                                                                internal_timezone->local_time_types,
+	                                                                sizeof( libcdatetime_timezone_local_time_type_t ) * ( internal_timezone->number_of_local_time_types + 1 ) );
+
+	if( local_time_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize local time types.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone->local_time_types = local_time_types;
+
+	safe_local_time_type_index = internal_timezone->number_of_local_time_types;
+
+	local_time_types[ safe_local_time_type_index ].utc_offset              = utc_offset;
+	local_time_types[ safe_local_time_type_index ].is_daylight_saving_time = is_daylight_saving_time;
+	local_time_types[ safe_local_time_type_index ].abbreviation_index      = (uint8_t) abbreviation_index;
+
+	internal_timezone->number_of_local_time_types += 1;
+
+	*local_time_type_index = (uint8_t) safe_local_time_type_index;
+
+	return( 1 );
+}
+
+/* Reads the rule that applies after the last transition from a POSIX TZ rule string
+ * The local time types of the rule are matched with the local time types of the timezone,
+ * where local time types that are not present are appended
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_timezone_read_rule_string(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     const char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_rule_t *rule = NULL;
+	static char *function              = "libcdatetime_internal_timezone_read_rule_string";
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timezone->rule != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone - rule value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_timezone_rule_initialize(
+	     &rule,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create rule.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdatetime_timezone_rule_read_string(
+	     rule,
+	     string,
+	     string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read rule string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdatetime_internal_timezone_find_local_time_type_index(
+	     internal_timezone,
+	     rule->standard_utc_offset,
+	     0,
+	     rule->standard_abbreviation,
+	     &( rule->standard_local_time_type_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve standard time local time type index.",
+		 function );
+
+		goto on_error;
+	}
+	if( rule->has_daylight_saving_time != 0 )
+	{
+		if( libcdatetime_internal_timezone_find_local_time_type_index(
+		     internal_timezone,
+		     rule->daylight_saving_time_utc_offset,
+		     1,
+		     rule->daylight_saving_time_abbreviation,
+		     &( rule->daylight_saving_time_local_time_type_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve daylight saving time local time type index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_timezone->rule = rule;
+
+	return( 1 );
+
+on_error:
+	if( rule != NULL )
+	{
+		libcdatetime_timezone_rule_free(
+		 &rule,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads TZif data
+ * For TZif version 2 or later data the 64-bit data block and footer are used
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_read_data(
+     libcdatetime_timezone_t *timezone,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	libcdatetime_timezone_file_header_t file_header;
+
+	static char *function                               = "libcdatetime_timezone_read_data";
+	size_t data_block_size                              = 0;
+	size_t data_offset                                  = 0;
+	size_t time_value_size                              = 4;
+	int result                                          = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone = (libcdatetime_internal_timezone_t *) timezone;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) LIBCDATETIME_TIMEZONE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_timezone_file_header_read_data(
+	     &file_header,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = LIBCDATETIME_TIMEZONE_FILE_HEADER_SIZE;
+
+	if( file_header.format_version >= 2 )
+	{
+		/* Skip the version 1 data block, which is followed by a second
+		 * file header and a data block with 64-bit time values
+		 */
+		if( libcdatetime_timezone_file_header_get_data_block_size(
+		     &file_header,
+		     4,
+		     &data_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine version 1 data block size.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_block_size > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += data_block_size;
+
+		if( libcdatetime_timezone_file_header_read_data(
+		     &file_header,
+		     &( data[ data_offset ] ),
+		     data_size - data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read second file header.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset    += LIBCDATETIME_TIMEZONE_FILE_HEADER_SIZE;
+		time_value_size = 8;
+	}
+	if( libcdatetime_internal_timezone_read_data_block(
+	     internal_timezone,
+	     &file_header,
+	     &( data[ data_offset ] ),
+	     data_size - data_offset,
+	     time_value_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( time_value_size == 8 )
+	{
+		if( libcdatetime_timezone_file_header_get_data_block_size(
+		     &file_header,
+		     time_value_size,
+		     &data_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine data block size.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += data_block_size;
+
+		result = libcdatetime_internal_timezone_read_footer(
+		          internal_timezone,
+		          &( data[ data_offset ] ),
+		          data_size - data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read footer.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libcdatetime_internal_timezone_read_rule_string(
+			     internal_timezone,
+			     internal_timezone->rule_string,
+			     internal_timezone->rule_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read footer rule string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+
+/* Reads a TZif file
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_read_file(
+     libcdatetime_timezone_t *timezone,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	uint8_t *data         = NULL;
+	uint8_t *reallocation = NULL;
+	static char *function = "libcdatetime_timezone_read_file";
+	size_t data_size      = 0;
+	size_t read_count     = 0;
+	size_t read_size      = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+
+	if( file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	/* TZif files are small hence the data is read in blocks of 4096 bytes
+	 * until the end of the file is reached
+	 */
+	do
+	{
+		if( ( data_size + 4096 ) > (size_t) LIBCDATETIME_TIMEZONE_MAXIMUM_DATA_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            data,
+		                            sizeof( uint8_t ) * ( data_size + 4096 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			goto on_error;
+		}
+		data      = reallocation;
+		read_size = 4096;
+
+		read_count = file_stream_read(
+		              file_stream,
+		              &( data[ data_size ] ),
+		              read_size );
+
+		if( ( read_count < read_size )
+		 && ( file_stream_at_end(
+		       file_stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		data_size += read_count;
+	}
+	while( read_count == read_size );
+
+	file_stream_close(
+	 file_stream );
+
+	file_stream = NULL;
+
+	if( libcdatetime_timezone_read_data(
+	     timezone,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read TZif data from: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Reads the TZif file of a named timezone from the zoneinfo directory
+ * The name is relative to the zoneinfo directory, for example "Europe/Amsterdam"
+ * If a timezone database of the process is set and contains the name the timezone
+ * is read from the database instead
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_read_zoneinfo(
+     libcdatetime_timezone_t *timezone,
+     const char *name,
+     libcerror_error_t **error )
+{
+	char *filename        = NULL;
+	static char *function = "libcdatetime_timezone_read_zoneinfo";
+	size_t filename_size  = 0;
+	size_t name_index     = 0;
+	size_t name_length    = 0;
+	size_t path_length    = 0;
+	int result            = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	if( ( name_length == 0 )
+	 || ( name_length > 255 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name must not refer to a file outside the zoneinfo directory
+	 */
+	if( name[ 0 ] == '/' )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		if( ( name[ name_index ] == '\\' )
+		 || ( ( name[ name_index ] == '.' )
+		  && ( ( name_index == 0 )
+		   || ( name[ name_index - 1 ] == '/' ) )
+		  && ( name[ name_index + 1 ] == '.' ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libcdatetime_process_timezone_database_read_timezone(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          name,
+	          name_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read timezone from timezone database.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	path_length = narrow_string_length(
+	               LIBCDATETIME_TIMEZONE_ZONEINFO_PATH );
+
+	filename_size = path_length + 1 + name_length + 1;
+
+	filename = narrow_string_allocate(
+	            filename_size );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     filename,
+	     LIBCDATETIME_TIMEZONE_ZONEINFO_PATH,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy zoneinfo path to filename.",
+		 function );
+
+		goto on_error;
+	}
+	filename[ path_length ] = '/';
+
+	if( narrow_string_copy(
+	     &( filename[ path_length + 1 ] ),
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to filename.",
+		 function );
+
+		goto on_error;
+	}
+	filename[ filename_size - 1 ] = 0;
+
+	if( libcdatetime_timezone_read_file(
+	     timezone,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read timezone: %s.",
+		 function,
+		 name );
+
+		goto on_error;
+	}
+	memory_free(
+	 filename );
+
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+
+/* Reads a Windows REG_TZI_FORMAT, TIME_ZONE_INFORMATION or DYNAMIC_TIME_ZONE_INFORMATION structure
+ * The structure type is determined by the data size. The timezone consists of a standard time
+ * and a daylight saving time local time type and a rule that determines when they apply.
+ * The names of the local time types are stored as abbreviations, where characters outside
+ * the printable ASCII range are replaced by '?'
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_read_time_zone_information(
+     libcdatetime_timezone_t *timezone,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	static char *function                               = "libcdatetime_timezone_read_time_zone_information";
+	size_t abbreviation_index                           = 0;
+	size_t daylight_saving_time_date_offset             = 0;
+	size_t name_offset                                  = 0;
+	size_t standard_date_offset                         = 0;
+	int64_t daylight_saving_time_utc_offset             = 0;
+	int64_t standard_utc_offset                         = 0;
+	uint32_t bias                                       = 0;
+	uint32_t daylight_saving_time_bias                  = 0;
+	uint32_t standard_bias                              = 0;
+	uint16_t character_value                            = 0;
+	uint8_t local_time_type_index                       = 0;
+	int daylight_saving_time_date_result                = 0;
+	int standard_date_result                            = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone = (libcdatetime_internal_timezone_t *) timezone;
+
+	if( ( internal_timezone->local_time_types != NULL )
+	 || ( internal_timezone->rule != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone - local time types value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == LIBCDATETIME_TIMEZONE_REG_TZI_FORMAT_SIZE )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 0 ] ),
+		 bias );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 standard_bias );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 8 ] ),
+		 daylight_saving_time_bias );
+
+		standard_date_offset             = 12;
+		daylight_saving_time_date_offset = 28;
+	}
+	else if( ( data_size == LIBCDATETIME_TIMEZONE_TIME_ZONE_INFORMATION_SIZE )
+	      || ( data_size == LIBCDATETIME_TIMEZONE_DYNAMIC_TIME_ZONE_INFORMATION_SIZE ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 0 ] ),
+		 bias );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 84 ] ),
+		 standard_bias );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 168 ] ),
+		 daylight_saving_time_bias );
+
+		standard_date_offset             = 68;
+		daylight_saving_time_date_offset = 152;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bias is subtracted from the local time to obtain UTC and is in minutes
+	 */
+	standard_utc_offset             = -60 * ( (int64_t) (int32_t) bias + (int64_t) (int32_t) standard_bias );
+	daylight_saving_time_utc_offset = -60 * ( (int64_t) (int32_t) bias + (int64_t) (int32_t) daylight_saving_time_bias );
+
+	if( ( standard_utc_offset < LIBCDATETIME_TIMEZONE_MINIMUM_UTC_OFFSET )
+	 || ( standard_utc_offset > LIBCDATETIME_TIMEZONE_MAXIMUM_UTC_OFFSET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid standard bias value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( daylight_saving_time_utc_offset < LIBCDATETIME_TIMEZONE_MINIMUM_UTC_OFFSET )
+	 || ( daylight_saving_time_utc_offset > LIBCDATETIME_TIMEZONE_MAXIMUM_UTC_OFFSET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid daylight bias value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_timezone_rule_initialize(
+	     &( internal_timezone->rule ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create rule.",
+		 function );
+
+		goto on_error;
+	}
+	standard_date_result = libcdatetime_timezone_rule_date_read_systemtime(
+	                        &( internal_timezone->rule->end_date ),
+	                        &( data[ standard_date_offset ] ),
+	                        LIBCDATETIME_TIMEZONE_RULE_SYSTEMTIME_SIZE,
+	                        error );
+
+	if( standard_date_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read standard date.",
+		 function );
+
+		goto on_error;
+	}
+	daylight_saving_time_date_result = libcdatetime_timezone_rule_date_read_systemtime(
+	                                    &( internal_timezone->rule->start_date ),
+	                                    &( data[ daylight_saving_time_date_offset ] ),
+	                                    LIBCDATETIME_TIMEZONE_RULE_SYSTEMTIME_SIZE,
+	                                    error );
+
+	if( daylight_saving_time_date_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read daylight date.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timezone->rule->standard_utc_offset                        = (int32_t) standard_utc_offset;
+	internal_timezone->rule->daylight_saving_time_utc_offset            = (int32_t) daylight_saving_time_utc_offset;
+	internal_timezone->rule->standard_local_time_type_index             = 0;
+	internal_timezone->rule->daylight_saving_time_local_time_type_index = 1;
+
+	/* Daylight saving time requires both dates and can be disabled
+	 * by DynamicDaylightTimeDisabled
+	 */
+	if( ( standard_date_result == 1 )
+	 && ( daylight_saving_time_date_result == 1 ) )
+	{
+		internal_timezone->rule->has_daylight_saving_time = 1;
+	}
+	if( ( data_size == LIBCDATETIME_TIMEZONE_DYNAMIC_TIME_ZONE_INFORMATION_SIZE )
+	 && ( data[ 428 ] != 0 ) )
+	{
+		internal_timezone->rule->has_daylight_saving_time = 0;
+	}
+	internal_timezone->local_time_types = (libcdatetime_timezone_local_time_type_t *) memory_allocate(
+	                                                                                   sizeof( libcdatetime_timezone_local_time_type_t ) * 2 );
+
+	if( internal_timezone->local_time_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create local time types.",
+		 function );
+
+		goto on_error;
+	}
+	/* The names consist of at most 32 UTF-16 characters
+	 */
+	internal_timezone->abbreviations = (char *) memory_allocate(
+	                                             sizeof( char ) * 66 );
+
+	if( internal_timezone->abbreviations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create abbreviations.",
+		 function );
+
+		goto on_error;
+	}
+	for( local_time_type_index = 0;
+	     local_time_type_index < 2;
+	     local_time_type_index++ )
+	{
+		if( local_time_type_index == 0 )
+		{
+			internal_timezone->local_time_types[ 0 ].utc_offset = (int32_t) standard_utc_offset;
+			name_offset                                         = 4;
+		}
+		else
+		{
+			internal_timezone->local_time_types[ 1 ].utc_offset = (int32_t) daylight_saving_time_utc_offset;
+			name_offset                                         = 88;
+		}
+		internal_timezone->local_time_types[ local_time_type_index ].is_daylight_saving_time = local_time_type_index;
+		internal_timezone->local_time_types[ local_time_type_index ].abbreviation_index      = (uint8_t) ( local_time_type_index * 33 );
+
+		abbreviation_index = (size_t) local_time_type_index * 33;
+
+		/* The REG_TZI_FORMAT structure does not contain names
+		 */
+		if( data_size != LIBCDATETIME_TIMEZONE_REG_TZI_FORMAT_SIZE )
+		{
+			while( abbreviation_index < ( ( (size_t) local_time_type_index * 33 ) + 32 ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( data[ name_offset ] ),
+				 character_value );
+
+				if( character_value == 0 )
+				{
+					break;
+				}
+				if( ( character_value < 0x20 )
+				 || ( character_value > 0x7e ) )
+				{
+					character_value = (uint16_t) '?';
+				}
+				internal_timezone->abbreviations[ abbreviation_index++ ] = (char) character_value;
+
+				name_offset += 2;
+			}
+		}
+		internal_timezone->abbreviations[ abbreviation_index ] = 0;
+	}
+	internal_timezone->number_of_local_time_types = 2;
+	internal_timezone->abbreviations_size         = 66;
+
+	return( 1 );
+
+on_error:
+	if( internal_timezone->abbreviations != NULL )
+	{
+		memory_free(
+		 internal_timezone->abbreviations );
+
+		internal_timezone->abbreviations = NULL;
+	}
+	if( internal_timezone->local_time_types != NULL )
+	{
+		memory_free(
+		 internal_timezone->local_time_types );
+
+		internal_timezone->local_time_types = NULL;
+	}
+	if( internal_timezone->rule != NULL )
+	{
+		libcdatetime_timezone_rule_free(
+		 &( internal_timezone->rule ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a POSIX TZ rule string, such as EST5EDT,M3.2.0,M11.1.0
+ * The timezone consists of the standard time and daylight saving time local time types
+ * of the rule, where standard time is the first local time type
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_read_rule_string(
+     libcdatetime_timezone_t *timezone,
+     const char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	static char *function                               = "libcdatetime_timezone_read_rule_string";
+	size_t string_length                                = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone = (libcdatetime_internal_timezone_t *) timezone;
+
+	if( ( internal_timezone->local_time_types != NULL )
+	 || ( internal_timezone->rule_string != NULL )
+	 || ( internal_timezone->rule != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone - local time types value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timezone_read_rule_string(
+	     internal_timezone,
+	     string,
+	     string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read rule string.",
+		 function );
+
+		goto on_error;
+	}
+	/* The rule string is retained so that the timezone can be stored in a timezone database
+	 */
+	while( ( string_length < string_size )
+	    && ( string[ string_length ] != 0 ) )
+	{
+		string_length++;
+	}
+	internal_timezone->rule_string = (char *) memory_allocate(
+	                                           sizeof( char ) * ( string_length + 1 ) );
+
+	if( internal_timezone->rule_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create rule string.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_timezone->rule_string,
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy rule string.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timezone->rule_string[ string_length ] = 0;
+
+	internal_timezone->rule_string_size = string_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_timezone->rule_string != NULL )
+	{
+		memory_free(
+		 internal_timezone->rule_string );
+
+		internal_timezone->rule_string = NULL;
+	}
+	if( internal_timezone->rule != NULL )
+	{
+		libcdatetime_timezone_rule_free(
+		 &( internal_timezone->rule ),
+		 NULL );
+	}
+	if( internal_timezone->abbreviations != NULL )
+	{
+		memory_free(
+		 internal_timezone->abbreviations );
+
+		internal_timezone->abbreviations = NULL;
+	}
+	if( internal_timezone->local_time_types != NULL )
+	{
+		memory_free(
+		 internal_timezone->local_time_types );
+
+		internal_timezone->local_time_types = NULL;
+	}
+	internal_timezone->number_of_local_time_types = 0;
+	internal_timezone->abbreviations_size         = 0;
+
+	return( -1 );
+}
+
+/* Determines the number of transitions at or before a specific time
+ * The transition times must be stored in ascending order. The search is
+ * branchless so that its duration does not depend on the order in which
+ * times are searched for
+ * Returns the number of transitions
+ */
+uint32_t libcdatetime_timezone_search_transition_times(
+          const int64_t *transition_times,
+          uint32_t number_of_transitions,
+          int64_t posix_time )
+{
+	const int64_t *transition_time = transition_times;
+	uint32_t half_of_transitions   = 0;
+
+	if( ( transition_times == NULL )
+	 || ( number_of_transitions == 0 ) )
+	{
+		return( 0 );
+	}
+	while( number_of_transitions > 1 )
+	{
+		half_of_transitions = number_of_transitions / 2;
+
+		/* The compiler can use a conditional move instead of a branch
+		 */
+		transition_time += ( transition_time[ half_of_transitions ] <= posix_time ) ? half_of_transitions : 0;
+
+		number_of_transitions -= half_of_transitions;
+	}
+	return( (uint32_t) ( transition_time - transition_times ) + (uint32_t) ( *transition_time <= posix_time ) );
+}
+
+/* Retrieves the local time type index that applies at a specific time
+ * The time is the number of seconds since January 1, 1970 00:00:00 UTC and
+ * the number of transitions is the number of transitions at or before the time
+ * The rule applies to times at or after the last transition
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_timezone_get_local_time_type_index(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     int64_t posix_time,
+     uint32_t number_of_transitions,
+     uint8_t *local_time_type_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_internal_timezone_get_local_time_type_index";
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_transitions > internal_timezone->number_of_transitions )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of transitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_time_type_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local time type index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_timezone->rule != NULL )
+	 && ( number_of_transitions == internal_timezone->number_of_transitions ) )
+	{
+		if( libcdatetime_timezone_rule_get_local_time_type_index(
+		     internal_timezone->rule,
+		     posix_time,
+		     local_time_type_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve local time type index from rule.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The first local time type applies before the first transition
+	 */
+	else if( number_of_transitions > 0 )
+	{
+		*local_time_type_index = internal_timezone->transition_local_time_type_indexes[ number_of_transitions - 1 ];
+	}
+	else
+	{
+		*local_time_type_index = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the local time type that applies at a specific time
+ * The time is the number of seconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_internal_timezone_get_local_time_type(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     int64_t posix_time,
+     const libcdatetime_timezone_local_time_type_t **local_time_type,
+     libcerror_error_t **error )
+{
+	static char *function          = "libcdatetime_internal_timezone_get_local_time_type";
+	uint32_t number_of_transitions = 0;
+	uint8_t local_time_type_index  = 0;
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timezone->local_time_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid timezone - missing local time types.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_time_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local time type.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         internal_timezone->transition_times,
+	                         internal_timezone->number_of_transitions,
+	                         posix_time );
+
+	if( libcdatetime_internal_timezone_get_local_time_type_index(
+	     internal_timezone,
+	     posix_time,
+	     number_of_transitions,
+	     &local_time_type_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local time type index.",
+		 function );
+
+		return( -1 );
+	}
+	*local_time_type = &( internal_timezone->local_time_types[ local_time_type_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the UTC offset that applies at a specific time
+ * The time is the number of seconds since January 1, 1970 00:00:00 UTC
+ * The UTC offset is in seconds and is added to UTC to obtain the local time
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_get_utc_offset(
+     libcdatetime_timezone_t *timezone,
+     int64_t posix_time,
+     int32_t *utc_offset,
+     uint8_t *is_daylight_saving_time,
+     libcerror_error_t **error )
+{
+	const libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	static char *function                                          = "libcdatetime_timezone_get_utc_offset";
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( utc_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTC offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_daylight_saving_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is daylight saving time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timezone_get_local_time_type(
+	     (libcdatetime_internal_timezone_t *) timezone,
+	     posix_time,
+	     &local_time_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local time type.",
+		 function );
+
+		return( -1 );
+	}
+	*utc_offset              = local_time_type->utc_offset;
+	*is_daylight_saving_time = local_time_type->is_daylight_saving_time;
+
+	return( 1 );
+}
+
+/* Retrieves the local times of a batch of times
+ * The times are the number of seconds since January 1, 1970 00:00:00 UTC and
+ * the local times are the same times with the UTC offset of the timezone added
+ * Ascending times are converted by advancing through the transitions,
+ * other times by searching the transitions
+ * The local times can be stored in the same array as the times
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_get_local_times(
+     libcdatetime_timezone_t *timezone,
+     const int64_t *posix_times,
+     size_t number_of_posix_times,
+     int64_t *local_times,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	static char *function                               = "libcdatetime_timezone_get_local_times";
+	size_t value_index                                  = 0;
+	int64_t posix_time                                  = 0;
+	int64_t previous_posix_time                         = 0;
+	int32_t utc_offset                                  = 0;
+	uint32_t number_of_transitions                      = 0;
+	uint8_t local_time_type_index                       = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone = (libcdatetime_internal_timezone_t *) timezone;
+
+	if( internal_timezone->local_time_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid timezone - missing local time types.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX times.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_posix_times > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of POSIX times value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local times.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_posix_times;
+	     value_index++ )
+	{
+		posix_time = posix_times[ value_index ];
+
+		if( ( value_index == 0 )
+		 || ( posix_time < previous_posix_time ) )
+		{
+			number_of_transitions = libcdatetime_timezone_search_transition_times(
+			                         internal_timezone->transition_times,
+			                         internal_timezone->number_of_transitions,
+			                         posix_time );
+		}
+		else
+		{
+			/* The transitions that apply to ascending times are reached
+			 * by advancing from the transition of the previous time
+			 */
+			while( ( number_of_transitions < internal_timezone->number_of_transitions )
+			    && ( internal_timezone->transition_times[ number_of_transitions ] <= posix_time ) )
+			{
+				number_of_transitions++;
+			}
+		}
+		if( libcdatetime_internal_timezone_get_local_time_type_index(
+		     internal_timezone,
+		     posix_time,
+		     number_of_transitions,
+		     &local_time_type_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve local time type index of POSIX time: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		utc_offset = internal_timezone->local_time_types[ local_time_type_index ].utc_offset;
+
+		if( ( ( utc_offset > 0 )
+		  && ( posix_time > ( (int64_t) INT64_MAX - utc_offset ) ) )
+		 || ( ( utc_offset < 0 )
+		  && ( posix_time < ( (int64_t) INT64_MIN - utc_offset ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid POSIX time: %" PRIzd " value out of bounds.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		local_times[ value_index ] = posix_time + utc_offset;
+
+		previous_posix_time = posix_time;
+	}
+	return( 1 );
+}
+
+/* Retrieves the local FILETIMEs of a batch of FILETIMEs
+ * The FILETIMEs are the number of 100th nano seconds since January 1, 1601 00:00:00 UTC and
+ * the local FILETIMEs are the same FILETIMEs with the UTC offset of the timezone added
+ * Ascending FILETIMEs are converted by advancing through the transitions,
+ * other FILETIMEs by searching the transitions
+ * The local FILETIMEs can be stored in the same array as the FILETIMEs
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_get_local_filetimes(
+     libcdatetime_timezone_t *timezone,
+     const uint64_t *filetimes,
+     size_t number_of_filetimes,
+     uint64_t *local_filetimes,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	static char *function                               = "libcdatetime_timezone_get_local_filetimes";
+	size_t value_index                                  = 0;
+	uint64_t filetime                                   = 0;
+	uint64_t previous_filetime                          = 0;
+	uint64_t utc_offset_in_filetime_intervals           = 0;
+	int64_t posix_time                                  = 0;
+	int32_t utc_offset                                  = 0;
+	uint32_t number_of_transitions                      = 0;
+	uint8_t local_time_type_index                       = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone = (libcdatetime_internal_timezone_t *) timezone;
+
+	if( internal_timezone->local_time_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid timezone - missing local time types.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIMEs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filetimes > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of FILETIMEs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local FILETIMEs.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_filetimes;
+	     value_index++ )
+	{
+		filetime = filetimes[ value_index ];
+
+		/* 11644473600 is the number of seconds between January 1, 1601 and January 1, 1970
+		 */
+		posix_time = (int64_t) ( filetime / 10000000 ) - 11644473600LL;
+
+		if( ( value_index == 0 )
+		 || ( filetime < previous_filetime ) )
+		{
+			number_of_transitions = libcdatetime_timezone_search_transition_times(
+			                         internal_timezone->transition_times,
+			                         internal_timezone->number_of_transitions,
+			                         posix_time );
+		}
+		else
+		{
+			/* The transitions that apply to ascending FILETIMEs are reached
+			 * by advancing from the transition of the previous FILETIME
+			 */
+			while( ( number_of_transitions < internal_timezone->number_of_transitions )
+			    && ( internal_timezone->transition_times[ number_of_transitions ] <= posix_time ) )
+			{
+				number_of_transitions++;
+			}
+		}
+		if( libcdatetime_internal_timezone_get_local_time_type_index(
+		     internal_timezone,
+		     posix_time,
+		     number_of_transitions,
+		     &local_time_type_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve local time type index of FILETIME: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		utc_offset = internal_timezone->local_time_types[ local_time_type_index ].utc_offset;
+
+		if( utc_offset >= 0 )
+		{
+			utc_offset_in_filetime_intervals = (uint64_t) utc_offset * 10000000;
+		}
+		else
+		{
+			utc_offset_in_filetime_intervals = (uint64_t) -utc_offset * 10000000;
+		}
+		if( ( ( utc_offset > 0 )
+		  && ( filetime > ( (uint64_t) UINT64_MAX - utc_offset_in_filetime_intervals ) ) )
+		 || ( ( utc_offset < 0 )
+		  && ( filetime < utc_offset_in_filetime_intervals ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid FILETIME: %" PRIzd " value out of bounds.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( utc_offset >= 0 )
+		{
+			local_filetimes[ value_index ] = filetime + utc_offset_in_filetime_intervals;
+		}
+		else
+		{
+			local_filetimes[ value_index ] = filetime - utc_offset_in_filetime_intervals;
+		}
+		previous_filetime = filetime;
+	}
+	return( 1 );
+}
+
+/* Retrieves the time that corresponds to a local time
+ * The local time is the number of seconds since January 1, 1970 00:00:00 in the timezone
+ * and the time is the number of seconds since January 1, 1970 00:00:00 UTC
+ * A local time that occurs more than once, when the UTC offset decreases, is ambiguous and
+ * a local time that is skipped, when the UTC offset increases, is non-existent. The earliest
+ * and latest times of a non-existent local time are determined with the UTC offsets after
+ * and before the change. The local time policy determines which of the times is used
+ * The UTC offset is assumed to change at most once within the UTC offset range around
+ * the local time, except for the changes of the transitions
+ * Returns 1 if successful, 0 if the local time was rejected or -1 on error
+ */
+int libcdatetime_internal_timezone_get_posix_time_from_local_time(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     int64_t local_time,
+     int local_time_policy,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	const libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	static char *function                                          = "libcdatetime_internal_timezone_get_posix_time_from_local_time";
+	int64_t candidate_posix_time                                   = 0;
+	int64_t earliest_posix_time                                    = 0;
+	int64_t latest_posix_time                                      = 0;
+	int64_t window_end_time                                        = 0;
+	int64_t window_start_time                                      = 0;
+	int32_t utc_offset                                             = 0;
+	int32_t utc_offset_after                                       = 0;
+	int32_t utc_offset_before                                      = 0;
+	uint32_t end_number_of_transitions                             = 0;
+	uint32_t number_of_transitions                                 = 0;
+	uint32_t start_number_of_transitions                           = 0;
+	uint8_t local_time_type_index                                  = 0;
+	int number_of_matches                                          = 0;
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timezone->local_time_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid timezone - missing local time types.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( local_time < ( (int64_t) INT64_MIN + LIBCDATETIME_TIMEZONE_MAXIMUM_UTC_OFFSET + 1 ) )
+	 || ( local_time > ( (int64_t) INT64_MAX + LIBCDATETIME_TIMEZONE_MINIMUM_UTC_OFFSET - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid local time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( local_time_policy != LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST )
+	 && ( local_time_policy != LIBCDATETIME_LOCAL_TIME_POLICY_LATEST )
+	 && ( local_time_policy != LIBCDATETIME_LOCAL_TIME_POLICY_REJECT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported local time policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every time that corresponds to the local time lies within the window
+	 * determined by the range of UTC offsets
+	 */
+	window_start_time = local_time - ( LIBCDATETIME_TIMEZONE_MAXIMUM_UTC_OFFSET + 1 );
+	window_end_time   = local_time - ( LIBCDATETIME_TIMEZONE_MINIMUM_UTC_OFFSET - 1 );
+
+	start_number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                               internal_timezone->transition_times,
+	                               internal_timezone->number_of_transitions,
+	                               window_start_time );
+
+	end_number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                             internal_timezone->transition_times,
+	                             internal_timezone->number_of_transitions,
+	                             window_end_time );
+
+	if( libcdatetime_internal_timezone_get_local_time_type_index(
+	     internal_timezone,
+	     window_start_time,
+	     start_number_of_transitions,
+	     &local_time_type_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local time type index of start of window.",
+		 function );
+
+		return( -1 );
+	}
+	utc_offset_before = internal_timezone->local_time_types[ local_time_type_index ].utc_offset;
+
+	/* Without a transition or daylight saving time rule in the window the UTC offset is the same for every time
+	 * in the window, hence the local time corresponds to exactly one time
+	 */
+	if( ( start_number_of_transitions == end_number_of_transitions )
+	 && ( ( internal_timezone->rule == NULL )
+	  || ( internal_timezone->rule->has_daylight_saving_time == 0 )
+	  || ( end_number_of_transitions < internal_timezone->number_of_transitions ) ) )
+	{
+		*posix_time = local_time - utc_offset_before;
+
+		return( 1 );
+	}
+	if( libcdatetime_internal_timezone_get_local_time_type_index(
+	     internal_timezone,
+	     window_end_time,
+	     end_number_of_transitions,
+	     &local_time_type_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local time type index of end of window.",
+		 function );
+
+		return( -1 );
+	}
+	utc_offset_after = internal_timezone->local_time_types[ local_time_type_index ].utc_offset;
+
+	/* The UTC offsets at the start and end of the window and those of the transitions
+	 * within the window are candidates. A candidate UTC offset corresponds to the local
+	 * time if the same UTC offset applies at the corresponding time
+	 */
+	for( number_of_transitions = start_number_of_transitions;
+	     number_of_transitions <= end_number_of_transitions + 1;
+	     number_of_transitions++ )
+	{
+		if( number_of_transitions == start_number_of_transitions )
+		{
+			utc_offset = utc_offset_before;
+		}
+		else if( number_of_transitions > end_number_of_transitions )
+		{
+			utc_offset = utc_offset_after;
+		}
+		else
+		{
+			local_time_type_index = internal_timezone->transition_local_time_type_indexes[ number_of_transitions - 1 ];
+
+			utc_offset = internal_timezone->local_time_types[ local_time_type_index ].utc_offset;
+		}
+		candidate_posix_time = local_time - utc_offset;
+
+		if( libcdatetime_internal_timezone_get_local_time_type(
+		     internal_timezone,
+		     candidate_posix_time,
+		     &local_time_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve local time type.",
+			 function );
+
+			return( -1 );
+		}
+		if( local_time_type->utc_offset != utc_offset )
+		{
+			continue;
+		}
+		if( ( number_of_matches == 0 )
+		 || ( candidate_posix_time < earliest_posix_time ) )
+		{
+			earliest_posix_time = candidate_posix_time;
+		}
+		if( ( number_of_matches == 0 )
+		 || ( candidate_posix_time > latest_posix_time ) )
+		{
+			latest_posix_time = candidate_posix_time;
+		}
+		number_of_matches++;
+	}
+	if( number_of_matches == 0 )
+	{
+		/* The local time is non-existent
+		 */
+		if( local_time_policy == LIBCDATETIME_LOCAL_TIME_POLICY_REJECT )
+		{
+			return( 0 );
+		}
+		if( utc_offset_before < utc_offset_after )
+		{
+			earliest_posix_time = local_time - utc_offset_after;
+			latest_posix_time   = local_time - utc_offset_before;
+		}
+		else
+		{
+			earliest_posix_time = local_time - utc_offset_before;
+			latest_posix_time   = local_time - utc_offset_after;
+		}
+	}
+	else if( ( earliest_posix_time != latest_posix_time )
+	      && ( local_time_policy == LIBCDATETIME_LOCAL_TIME_POLICY_REJECT ) )
+	{
+		/* The local time is ambiguous
+		 */
+		return( 0 );
+	}
+	if( local_time_policy == LIBCDATETIME_LOCAL_TIME_POLICY_LATEST )
+	{
+		*posix_time = latest_posix_time;
+	}
+	else
+	{
+		*posix_time = earliest_posix_time;
+	}
+	return( 1 );
+}
+
+/* Retrieves the time that corresponds to a local time
+ * The local time is the number of seconds since January 1, 1970 00:00:00 in the timezone
+ * and the time is the number of seconds since January 1, 1970 00:00:00 UTC
+ * The local time policy determines the time of an ambiguous or non-existent local time,
+ * where LIBCDATETIME_LOCAL_TIME_POLICY_REJECT rejects such a local time
+ * Returns 1 if successful, 0 if the local time was rejected or -1 on error
+ */
+int libcdatetime_timezone_get_posix_time_from_local_time(
+     libcdatetime_timezone_t *timezone,
+     int64_t local_time,
+     int local_time_policy,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_timezone_get_posix_time_from_local_time";
+	int result            = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          local_time,
+	          local_time_policy,
+	          posix_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve POSIX time from local time.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the times that correspond to a batch of local times
+ * The local times are the number of seconds since January 1, 1970 00:00:00 in the timezone
+ * and the times are the number of seconds since January 1, 1970 00:00:00 UTC
+ * The local time policy determines the time of an ambiguous or non-existent local time,
+ * where LIBCDATETIME_LOCAL_TIME_POLICY_REJECT makes such a local time an error
+ * The times can be stored in the same array as the local times
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_get_posix_times_from_local_times(
+     libcdatetime_timezone_t *timezone,
+     const int64_t *local_times,
+     size_t number_of_local_times,
+     int local_time_policy,
+     int64_t *posix_times,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_t *internal_timezone = NULL;
+	static char *function                               = "libcdatetime_timezone_get_posix_times_from_local_times";
+	size_t value_index                                  = 0;
+	int result                                          = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone = (libcdatetime_internal_timezone_t *) timezone;
+
+	if( local_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local times.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_local_times > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of local times value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX times.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_local_times;
+	     value_index++ )
+	{
+		result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+		          internal_timezone,
+		          local_times[ value_index ],
+		          local_time_policy,
+		          &( posix_times[ value_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve POSIX time of local time: %" PRIzd ".",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid local time: %" PRIzd " value is ambiguous or non-existent.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the abbreviation of the local time type that applies at a specific time
+ * The time is the number of seconds since January 1, 1970 00:00:00 UTC
+ * The abbreviation size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_get_abbreviation(
+     libcdatetime_timezone_t *timezone,
+     int64_t posix_time,
+     char *abbreviation,
+     size_t abbreviation_size,
+     libcerror_error_t **error )
+{
+	const libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	libcdatetime_internal_timezone_t *internal_timezone            = NULL;
+	static char *function                                          = "libcdatetime_timezone_get_abbreviation";
+	size_t abbreviation_length                                     = 0;
+	size_t abbreviation_offset                                     = 0;
+
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timezone = (libcdatetime_internal_timezone_t *) timezone;
+
+	if( abbreviation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abbreviation.",
+		 function );
+
+		return( -1 );
+	}
+	if( abbreviation_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid abbreviation size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timezone_get_local_time_type(
+	     internal_timezone,
+	     posix_time,
+	     &local_time_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local time type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The abbreviations are terminated by an end of string character
+	 */
+	abbreviation_offset = (size_t) local_time_type->abbreviation_index;
+
+	while( internal_timezone->abbreviations[ abbreviation_offset + abbreviation_length ] != 0 )
+	{
+		abbreviation_length++;
+	}
+	if( abbreviation_size < ( abbreviation_length + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid abbreviation size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     abbreviation,
+	     &( internal_timezone->abbreviations[ abbreviation_offset ] ),
+	     abbreviation_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy abbreviation.",
+		 function );
+
+		return( -1 );
+	}
+	abbreviation[ abbreviation_length ] = 0;
+
+	return( 1 );
+}
+
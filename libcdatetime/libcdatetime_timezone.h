@@ -0,0 +1,325 @@
+/*
+ * Timezone functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_TIMEZONE_H )
+#define _LIBCDATETIME_TIMEZONE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_timezone_rule.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The directory that contains the TZif files of the named timezones
+ */
+#if !defined( LIBCDATETIME_TIMEZONE_ZONEINFO_PATH )
+#define LIBCDATETIME_TIMEZONE_ZONEINFO_PATH		"/usr/share/zoneinfo"
+#endif
+
+/* The maximum supported size of TZif data
+ */
+#define LIBCDATETIME_TIMEZONE_MAXIMUM_DATA_SIZE		( 16 * 1024 * 1024 )
+
+/* The size of a TZif file header
+ */
+#define LIBCDATETIME_TIMEZONE_FILE_HEADER_SIZE		44
+
+/* The range of UTC offsets as recommended by RFC 8536
+ */
+#define LIBCDATETIME_TIMEZONE_MINIMUM_UTC_OFFSET	-89999
+#define LIBCDATETIME_TIMEZONE_MAXIMUM_UTC_OFFSET	93599
+
+/* The sizes of the Windows REG_TZI_FORMAT, TIME_ZONE_INFORMATION and
+ * DYNAMIC_TIME_ZONE_INFORMATION structures
+ */
+#define LIBCDATETIME_TIMEZONE_REG_TZI_FORMAT_SIZE			44
+#define LIBCDATETIME_TIMEZONE_TIME_ZONE_INFORMATION_SIZE		172
+#define LIBCDATETIME_TIMEZONE_DYNAMIC_TIME_ZONE_INFORMATION_SIZE	432
+
+typedef struct libcdatetime_timezone_file_header libcdatetime_timezone_file_header_t;
+
+struct libcdatetime_timezone_file_header
+{
+	/* The format version
+	 */
+	uint8_t format_version;
+
+	/* The number of UT/local indicators
+	 */
+	uint32_t number_of_utc_indicators;
+
+	/* The number of standard/wall indicators
+	 */
+	uint32_t number_of_standard_indicators;
+
+	/* The number of leap second records
+	 */
+	uint32_t number_of_leap_seconds;
+
+	/* The number of transitions
+	 */
+	uint32_t number_of_transitions;
+
+	/* The number of local time types
+	 */
+	uint32_t number_of_local_time_types;
+
+	/* The size of the abbreviations
+	 */
+	uint32_t abbreviations_size;
+};
+
+typedef struct libcdatetime_timezone_local_time_type libcdatetime_timezone_local_time_type_t;
+
+struct libcdatetime_timezone_local_time_type
+{
+	/* The offset relative to UTC in seconds
+	 */
+	int32_t utc_offset;
+
+	/* Value to indicate the local time type is daylight saving time
+	 */
+	uint8_t is_daylight_saving_time;
+
+	/* The index of the abbreviation in the abbreviations
+	 */
+	uint8_t abbreviation_index;
+};
+
+typedef struct libcdatetime_internal_timezone libcdatetime_internal_timezone_t;
+
+struct libcdatetime_internal_timezone
+{
+	/* The transition times as the number of seconds since January 1, 1970 00:00:00 UTC
+	 * The transition times are stored in ascending order
+	 */
+	int64_t *transition_times;
+
+	/* The local time type index of each transition
+	 */
+	uint8_t *transition_local_time_type_indexes;
+
+	/* The number of transitions
+	 */
+	uint32_t number_of_transitions;
+
+	/* The local time types
+	 */
+	libcdatetime_timezone_local_time_type_t *local_time_types;
+
+	/* The number of local time types
+	 */
+	uint16_t number_of_local_time_types;
+
+	/* The abbreviations, stored as consecutive strings with end of string character
+	 */
+	char *abbreviations;
+
+	/* The size of the abbreviations
+	 */
+	size_t abbreviations_size;
+
+	/* The POSIX TZ rule string of the footer, which applies after the last transition
+	 */
+	char *rule_string;
+
+	/* The size of the rule string, including the end of string character
+	 */
+	size_t rule_string_size;
+
+	/* The rule, which applies after the last transition
+	 */
+	libcdatetime_timezone_rule_t *rule;
+};
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_initialize(
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_free(
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_file_header_read_data(
+     libcdatetime_timezone_file_header_t *file_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_file_header_get_data_block_size(
+     libcdatetime_timezone_file_header_t *file_header,
+     size_t time_value_size,
+     size_t *data_block_size,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timezone_read_data_block(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     libcdatetime_timezone_file_header_t *file_header,
+     const uint8_t *data,
+     size_t data_size,
+     size_t time_value_size,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timezone_read_footer(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timezone_find_local_time_type_index(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     int32_t utc_offset,
+     uint8_t is_daylight_saving_time,
+     const char *abbreviation,
+     uint8_t *local_time_type_index,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timezone_read_rule_string(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     const char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_read_data(
+     libcdatetime_timezone_t *timezone,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_read_file(
+     libcdatetime_timezone_t *timezone,
+     const char *filename,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_read_zoneinfo(
+     libcdatetime_timezone_t *timezone,
+     const char *name,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_read_time_zone_information(
+     libcdatetime_timezone_t *timezone,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_read_rule_string(
+     libcdatetime_timezone_t *timezone,
+     const char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+uint32_t libcdatetime_timezone_search_transition_times(
+          const int64_t *transition_times,
+          uint32_t number_of_transitions,
+          int64_t posix_time );
+
+int libcdatetime_internal_timezone_get_local_time_type_index(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     int64_t posix_time,
+     uint32_t number_of_transitions,
+     uint8_t *local_time_type_index,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timezone_get_local_time_type(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     int64_t posix_time,
+     const libcdatetime_timezone_local_time_type_t **local_time_type,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_get_utc_offset(
+     libcdatetime_timezone_t *timezone,
+     int64_t posix_time,
+     int32_t *utc_offset,
+     uint8_t *is_daylight_saving_time,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_get_local_times(
+     libcdatetime_timezone_t *timezone,
+     const int64_t *posix_times,
+     size_t number_of_posix_times,
+     int64_t *local_times,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_get_local_filetimes(
+     libcdatetime_timezone_t *timezone,
+     const uint64_t *filetimes,
+     size_t number_of_filetimes,
+     uint64_t *local_filetimes,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timezone_get_posix_time_from_local_time(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     int64_t local_time,
+     int local_time_policy,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_get_posix_time_from_local_time(
+     libcdatetime_timezone_t *timezone,
+     int64_t local_time,
+     int local_time_policy,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_get_posix_times_from_local_times(
+     libcdatetime_timezone_t *timezone,
+     const int64_t *local_times,
+     size_t number_of_local_times,
+     int local_time_policy,
+     int64_t *posix_times,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_get_abbreviation(
+     libcdatetime_timezone_t *timezone,
+     int64_t posix_time,
+     char *abbreviation,
+     size_t abbreviation_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_TIMEZONE_H ) */
+
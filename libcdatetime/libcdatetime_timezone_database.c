@@ -0,0 +1,2944 @@
+/*
+ * Timezone database functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H ) && !defined( WINAPI )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H ) && !defined( WINAPI )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#include <unistd.h>
+#endif
+
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_timezone.h"
+#include "libcdatetime_timezone_database.h"
+#include "libcdatetime_timezone_rule.h"
+#include "libcdatetime_types.h"
+
+/* The timezone database of the process, which is used to read named timezones
+ */
+static libcdatetime_timezone_database_t *libcdatetime_process_timezone_database = NULL;
+
+/* Reads an unsigned variable-length integer
+ * The integer is stored in groups of 7 bits, least significant group first,
+ * where the most significant bit of a byte indicates that another byte follows
+ * Returns 1 if successful or -1 on error
+ */
+static int libcdatetime_timezone_database_read_varint(
+            const uint8_t *data,
+            size_t data_size,
+            size_t *data_offset,
+            uint64_t *value )
+{
+	size_t safe_data_offset = 0;
+	uint64_t safe_value     = 0;
+	uint8_t bit_shift       = 0;
+	uint8_t byte_value      = 0;
+
+	safe_data_offset = *data_offset;
+
+	do
+	{
+		if( ( safe_data_offset >= data_size )
+		 || ( bit_shift > 63 ) )
+		{
+			return( -1 );
+		}
+		byte_value = data[ safe_data_offset++ ];
+
+		/* The last group of a 64-bit value consists of 1 bit
+		 */
+		if( ( bit_shift == 63 )
+		 && ( ( byte_value & 0xfe ) != 0 ) )
+		{
+			return( -1 );
+		}
+		safe_value |= (uint64_t) ( byte_value & 0x7f ) << bit_shift;
+
+		bit_shift += 7;
+	}
+	while( ( byte_value & 0x80 ) != 0 );
+
+	*data_offset = safe_data_offset;
+	*value       = safe_value;
+
+	return( 1 );
+}
+
+/* Reads a signed variable-length integer
+ * The sign is stored in the least significant bit, so that values close to 0 are small
+ * Returns 1 if successful or -1 on error
+ */
+static int libcdatetime_timezone_database_read_signed_varint(
+            const uint8_t *data,
+            size_t data_size,
+            size_t *data_offset,
+            int64_t *value )
+{
+	uint64_t unsigned_value = 0;
+
+	if( libcdatetime_timezone_database_read_varint(
+	     data,
+	     data_size,
+	     data_offset,
+	     &unsigned_value ) != 1 )
+	{
+		return( -1 );
+	}
+	if( ( unsigned_value & 1 ) != 0 )
+	{
+		*value = (int64_t) ~( unsigned_value >> 1 );
+	}
+	else
+	{
+		*value = (int64_t) ( unsigned_value >> 1 );
+	}
+	return( 1 );
+}
+
+/* Writes an unsigned variable-length integer
+ * Returns 1 if successful or -1 on error
+ */
+static int libcdatetime_timezone_database_write_varint(
+            uint8_t *data,
+            size_t data_size,
+            size_t *data_offset,
+            uint64_t value )
+{
+	size_t safe_data_offset = 0;
+
+	safe_data_offset = *data_offset;
+
+	do
+	{
+		if( safe_data_offset >= data_size )
+		{
+			return( -1 );
+		}
+		data[ safe_data_offset ] = (uint8_t) ( value & 0x7f );
+
+		value >>= 7;
+
+		if( value != 0 )
+		{
+			data[ safe_data_offset ] |= 0x80;
+		}
+		safe_data_offset++;
+	}
+	while( value != 0 );
+
+	*data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Writes a signed variable-length integer
+ * Returns 1 if successful or -1 on error
+ */
+static int libcdatetime_timezone_database_write_signed_varint(
+            uint8_t *data,
+            size_t data_size,
+            size_t *data_offset,
+            int64_t value )
+{
+	uint64_t unsigned_value = 0;
+
+	if( value < 0 )
+	{
+		unsigned_value = ~( (uint64_t) value << 1 );
+	}
+	else
+	{
+		unsigned_value = (uint64_t) value << 1;
+	}
+	return( libcdatetime_timezone_database_write_varint(
+	         data,
+	         data_size,
+	         data_offset,
+	         unsigned_value ) );
+}
+
+/* Compares a name with a name stored in the timezone database
+ * The stored name must be terminated by an end of string character
+ * Returns -1 if the name is less than, 0 if equal or 1 if greater than the stored name
+ */
+static int libcdatetime_timezone_database_compare_name(
+            const char *name,
+            size_t name_length,
+            const uint8_t *stored_name )
+{
+	size_t name_index = 0;
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		if( stored_name[ name_index ] == 0 )
+		{
+			return( 1 );
+		}
+		if( (uint8_t) name[ name_index ] < stored_name[ name_index ] )
+		{
+			return( -1 );
+		}
+		else if( (uint8_t) name[ name_index ] > stored_name[ name_index ] )
+		{
+			return( 1 );
+		}
+	}
+	if( stored_name[ name_length ] != 0 )
+	{
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Creates a timezone database
+ * Make sure the value database is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_initialize(
+     libcdatetime_timezone_database_t **database,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_initialize";
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	if( *database != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid database value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = memory_allocate_structure(
+	                     libcdatetime_internal_timezone_database_t );
+
+	if( internal_database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create database.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_database,
+	     0,
+	     sizeof( libcdatetime_internal_timezone_database_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear database.",
+		 function );
+
+		goto on_error;
+	}
+	*database = (libcdatetime_timezone_database_t *) internal_database;
+
+	return( 1 );
+
+on_error:
+	if( internal_database != NULL )
+	{
+		memory_free(
+		 internal_database );
+	}
+	return( -1 );
+}
+
+/* Frees a timezone database
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_free(
+     libcdatetime_timezone_database_t **database,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_free";
+	uint32_t entry_index                                         = 0;
+	int result                                                   = 1;
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	if( *database != NULL )
+	{
+		internal_database = (libcdatetime_internal_timezone_database_t *) *database;
+		*database         = NULL;
+
+#if defined( LIBCDATETIME_HAVE_TIMEZONE_DATABASE_MMAP )
+		if( internal_database->mapped_data != NULL )
+		{
+			if( munmap(
+			     internal_database->mapped_data,
+			     internal_database->mapped_data_size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 errno,
+				 "%s: unable to unmap data.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( internal_database->allocated_data != NULL )
+		{
+			memory_free(
+			 internal_database->allocated_data );
+		}
+		if( internal_database->appended_names != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < internal_database->number_of_appended_names;
+			     entry_index++ )
+			{
+				memory_free(
+				 internal_database->appended_names[ entry_index ].name );
+			}
+			memory_free(
+			 internal_database->appended_names );
+		}
+		if( internal_database->appended_records != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < internal_database->number_of_appended_records;
+			     entry_index++ )
+			{
+				memory_free(
+				 internal_database->appended_records[ entry_index ].data );
+			}
+			memory_free(
+			 internal_database->appended_records );
+		}
+		memory_free(
+		 internal_database );
+	}
+	return( result );
+}
+
+/* Reads the transitions, local time types, abbreviations and rule of a timezone from an encoded record
+ * The record starts with the number of transitions, the number of local time types, the size of the
+ * abbreviations and the size of the rule string as variable-length integers, followed by the local
+ * time types, the transition times as the first time and the differences with the preceding times,
+ * the local time type index of each transition, the abbreviations and the rule string
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_read_record(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	static char *function                                    = "libcdatetime_timezone_database_read_record";
+	size_t data_offset                                       = 0;
+	uint64_t abbreviations_size                              = 0;
+	uint64_t maximum_time_difference                         = 0;
+	uint64_t number_of_local_time_types                      = 0;
+	uint64_t number_of_transitions                           = 0;
+	uint64_t rule_string_size                                = 0;
+	uint64_t time_difference                                 = 0;
+	int64_t value_64bit                                      = 0;
+	uint32_t transition_index                                = 0;
+	uint16_t local_time_type_index                           = 0;
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_timezone->transition_times != NULL )
+	 || ( internal_timezone->transition_local_time_type_indexes != NULL )
+	 || ( internal_timezone->local_time_types != NULL )
+	 || ( internal_timezone->abbreviations != NULL )
+	 || ( internal_timezone->rule_string != NULL )
+	 || ( internal_timezone->rule != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone - transitions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libcdatetime_timezone_database_read_varint(
+	       data,
+	       data_size,
+	       &data_offset,
+	       &number_of_transitions ) != 1 )
+	 || ( libcdatetime_timezone_database_read_varint(
+	       data,
+	       data_size,
+	       &data_offset,
+	       &number_of_local_time_types ) != 1 )
+	 || ( libcdatetime_timezone_database_read_varint(
+	       data,
+	       data_size,
+	       &data_offset,
+	       &abbreviations_size ) != 1 )
+	 || ( libcdatetime_timezone_database_read_varint(
+	       data,
+	       data_size,
+	       &data_offset,
+	       &rule_string_size ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record header.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every transition is stored in at least 2 bytes
+	 */
+	if( number_of_transitions > (uint64_t) ( data_size / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of transitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_local_time_types == 0 )
+	 || ( number_of_local_time_types > 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of local time types value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( abbreviations_size == 0 )
+	 || ( abbreviations_size > (uint64_t) data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid abbreviations size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( rule_string_size > (uint64_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid rule string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_transitions > 0 )
+	{
+		internal_timezone->transition_times = (int64_t *) memory_allocate(
+		                                                   sizeof( int64_t ) * (size_t) number_of_transitions );
+
+		if( internal_timezone->transition_times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create transition times.",
+			 function );
+
+			goto on_error;
+		}
+		internal_timezone->transition_local_time_type_indexes = (uint8_t *) memory_allocate(
+		                                                                     sizeof( uint8_t ) * (size_t) number_of_transitions );
+
+		if( internal_timezone->transition_local_time_type_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create transition local time type indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_timezone->local_time_types = (libcdatetime_timezone_local_time_type_t *) memory_allocate(
+	                                                                                   sizeof( libcdatetime_timezone_local_time_type_t ) * (size_t) number_of_local_time_types );
+
+	if( internal_timezone->local_time_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create local time types.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timezone->abbreviations = (char *) memory_allocate(
+	                                             sizeof( char ) * (size_t) abbreviations_size );
+
+	if( internal_timezone->abbreviations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create abbreviations.",
+		 function );
+
+		goto on_error;
+	}
+	for( local_time_type_index = 0;
+	     local_time_type_index < (uint16_t) number_of_local_time_types;
+	     local_time_type_index++ )
+	{
+		local_time_type = &( internal_timezone->local_time_types[ local_time_type_index ] );
+
+		if( ( libcdatetime_timezone_database_read_signed_varint(
+		       data,
+		       data_size,
+		       &data_offset,
+		       &value_64bit ) != 1 )
+		 || ( ( data_size - data_offset ) < 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read local time type: %" PRIu16 ".",
+			 function,
+			 local_time_type_index );
+
+			goto on_error;
+		}
+		if( ( value_64bit < (int64_t) LIBCDATETIME_TIMEZONE_MINIMUM_UTC_OFFSET )
+		 || ( value_64bit > (int64_t) LIBCDATETIME_TIMEZONE_MAXIMUM_UTC_OFFSET ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid local time type: %" PRIu16 " UTC offset value out of bounds.",
+			 function,
+			 local_time_type_index );
+
+			goto on_error;
+		}
+		local_time_type->utc_offset              = (int32_t) value_64bit;
+		local_time_type->is_daylight_saving_time = data[ data_offset ];
+		local_time_type->abbreviation_index      = data[ data_offset + 1 ];
+
+		data_offset += 2;
+
+		if( local_time_type->is_daylight_saving_time > 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported local time type: %" PRIu16 " daylight saving time value.",
+			 function,
+			 local_time_type_index );
+
+			goto on_error;
+		}
+		if( (uint64_t) local_time_type->abbreviation_index >= abbreviations_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid local time type: %" PRIu16 " abbreviation index value out of bounds.",
+			 function,
+			 local_time_type_index );
+
+			goto on_error;
+		}
+	}
+	for( transition_index = 0;
+	     transition_index < (uint32_t) number_of_transitions;
+	     transition_index++ )
+	{
+		if( transition_index == 0 )
+		{
+			if( libcdatetime_timezone_database_read_signed_varint(
+			     data,
+			     data_size,
+			     &data_offset,
+			     &value_64bit ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read transition: %" PRIu32 " time.",
+				 function,
+				 transition_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libcdatetime_timezone_database_read_varint(
+			     data,
+			     data_size,
+			     &data_offset,
+			     &time_difference ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read transition: %" PRIu32 " time difference.",
+				 function,
+				 transition_index );
+
+				goto on_error;
+			}
+			/* The transition times must be in ascending order and the
+			 * subtraction wraps around for negative preceding times
+			 */
+			maximum_time_difference = (uint64_t) INT64_MAX - (uint64_t) value_64bit;
+
+			if( ( time_difference == 0 )
+			 || ( time_difference > maximum_time_difference ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid transition: %" PRIu32 " time value out of bounds.",
+				 function,
+				 transition_index );
+
+				goto on_error;
+			}
+			value_64bit = (int64_t) ( (uint64_t) value_64bit + time_difference );
+		}
+		internal_timezone->transition_times[ transition_index ] = value_64bit;
+	}
+	if( ( (uint64_t) ( data_size - data_offset ) < number_of_transitions )
+	 || ( (uint64_t) ( data_size - data_offset - (size_t) number_of_transitions ) < ( abbreviations_size + rule_string_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	for( transition_index = 0;
+	     transition_index < (uint32_t) number_of_transitions;
+	     transition_index++ )
+	{
+		if( (uint64_t) data[ data_offset ] >= number_of_local_time_types )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid transition: %" PRIu32 " local time type index value out of bounds.",
+			 function,
+			 transition_index );
+
+			goto on_error;
+		}
+		internal_timezone->transition_local_time_type_indexes[ transition_index ] = data[ data_offset ];
+
+		data_offset += 1;
+	}
+	/* The abbreviations and rule string must be terminated by an end of string character
+	 */
+	if( data[ data_offset + (size_t) abbreviations_size - 1 ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported abbreviations - missing end of string character.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_timezone->abbreviations,
+	     &( data[ data_offset ] ),
+	     (size_t) abbreviations_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy abbreviations.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += (size_t) abbreviations_size;
+
+	internal_timezone->number_of_transitions      = (uint32_t) number_of_transitions;
+	internal_timezone->number_of_local_time_types = (uint16_t) number_of_local_time_types;
+	internal_timezone->abbreviations_size         = (size_t) abbreviations_size;
+
+	if( rule_string_size > 0 )
+	{
+		if( data[ data_offset + (size_t) rule_string_size - 1 ] != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported rule string - missing end of string character.",
+			 function );
+
+			goto on_error;
+		}
+		internal_timezone->rule_string = (char *) memory_allocate(
+		                                           sizeof( char ) * (size_t) rule_string_size );
+
+		if( internal_timezone->rule_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create rule string.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_timezone->rule_string,
+		     &( data[ data_offset ] ),
+		     (size_t) rule_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy rule string.",
+			 function );
+
+			goto on_error;
+		}
+		internal_timezone->rule_string_size = (size_t) rule_string_size;
+
+		data_offset += (size_t) rule_string_size;
+	}
+	if( data_offset != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported trailing data.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_timezone->rule_string != NULL )
+	{
+		if( libcdatetime_internal_timezone_read_rule_string(
+		     internal_timezone,
+		     internal_timezone->rule_string,
+		     internal_timezone->rule_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read rule string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( internal_timezone->rule_string != NULL )
+	{
+		memory_free(
+		 internal_timezone->rule_string );
+
+		internal_timezone->rule_string = NULL;
+	}
+	if( internal_timezone->abbreviations != NULL )
+	{
+		memory_free(
+		 internal_timezone->abbreviations );
+
+		internal_timezone->abbreviations = NULL;
+	}
+	if( internal_timezone->local_time_types != NULL )
+	{
+		memory_free(
+		 internal_timezone->local_time_types );
+
+		internal_timezone->local_time_types = NULL;
+	}
+	if( internal_timezone->transition_local_time_type_indexes != NULL )
+	{
+		memory_free(
+		 internal_timezone->transition_local_time_type_indexes );
+
+		internal_timezone->transition_local_time_type_indexes = NULL;
+	}
+	if( internal_timezone->transition_times != NULL )
+	{
+		memory_free(
+		 internal_timezone->transition_times );
+
+		internal_timezone->transition_times = NULL;
+	}
+	internal_timezone->number_of_transitions      = 0;
+	internal_timezone->number_of_local_time_types = 0;
+	internal_timezone->abbreviations_size         = 0;
+	internal_timezone->rule_string_size           = 0;
+
+	return( -1 );
+}
+
+/* Writes the transitions, local time types, abbreviations and rule of a timezone to an encoded record
+ * A timezone with a rule must have a rule string, hence timezones read from Windows time zone
+ * information are not supported
+ * Make sure the value data is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_write_record(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	uint8_t *record_data                                     = NULL;
+	uint8_t *reallocation                                    = NULL;
+	static char *function                                    = "libcdatetime_timezone_database_write_record";
+	size_t record_data_offset                                = 0;
+	size_t record_data_size                                  = 0;
+	uint64_t maximum_record_data_size                        = 0;
+	uint32_t transition_index                                = 0;
+	uint16_t local_time_type_index                           = 0;
+
+	if( internal_timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_timezone->local_time_types == NULL )
+	 || ( internal_timezone->number_of_local_time_types == 0 )
+	 || ( internal_timezone->abbreviations == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid timezone - missing local time types.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_timezone->rule != NULL )
+	 && ( internal_timezone->rule_string == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported timezone - rule without rule string.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record data is allocated with the maximum size of its variable-length integers
+	 * and is reallocated to the size that is used
+	 */
+	maximum_record_data_size = ( 4 * LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_VARINT_SIZE )
+	                         + ( (uint64_t) internal_timezone->number_of_local_time_types * ( LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_VARINT_SIZE + 2 ) )
+	                         + ( (uint64_t) internal_timezone->number_of_transitions * ( LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_VARINT_SIZE + 1 ) )
+	                         + (uint64_t) internal_timezone->abbreviations_size
+	                         + (uint64_t) internal_timezone->rule_string_size;
+
+	if( maximum_record_data_size > (uint64_t) LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	record_data_size = (size_t) maximum_record_data_size;
+
+	record_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * record_data_size );
+
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( libcdatetime_timezone_database_write_varint(
+	       record_data,
+	       record_data_size,
+	       &record_data_offset,
+	       (uint64_t) internal_timezone->number_of_transitions ) != 1 )
+	 || ( libcdatetime_timezone_database_write_varint(
+	       record_data,
+	       record_data_size,
+	       &record_data_offset,
+	       (uint64_t) internal_timezone->number_of_local_time_types ) != 1 )
+	 || ( libcdatetime_timezone_database_write_varint(
+	       record_data,
+	       record_data_size,
+	       &record_data_offset,
+	       (uint64_t) internal_timezone->abbreviations_size ) != 1 )
+	 || ( libcdatetime_timezone_database_write_varint(
+	       record_data,
+	       record_data_size,
+	       &record_data_offset,
+	       (uint64_t) internal_timezone->rule_string_size ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record header.",
+		 function );
+
+		goto on_error;
+	}
+	for( local_time_type_index = 0;
+	     local_time_type_index < internal_timezone->number_of_local_time_types;
+	     local_time_type_index++ )
+	{
+		local_time_type = &( internal_timezone->local_time_types[ local_time_type_index ] );
+
+		if( libcdatetime_timezone_database_write_signed_varint(
+		     record_data,
+		     record_data_size,
+		     &record_data_offset,
+		     (int64_t) local_time_type->utc_offset ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write local time type: %" PRIu16 ".",
+			 function,
+			 local_time_type_index );
+
+			goto on_error;
+		}
+		record_data[ record_data_offset ]     = local_time_type->is_daylight_saving_time;
+		record_data[ record_data_offset + 1 ] = local_time_type->abbreviation_index;
+
+		record_data_offset += 2;
+	}
+	for( transition_index = 0;
+	     transition_index < internal_timezone->number_of_transitions;
+	     transition_index++ )
+	{
+		if( transition_index == 0 )
+		{
+			if( libcdatetime_timezone_database_write_signed_varint(
+			     record_data,
+			     record_data_size,
+			     &record_data_offset,
+			     internal_timezone->transition_times[ 0 ] ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write transition: %" PRIu32 " time.",
+				 function,
+				 transition_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* The transition times are stored in ascending order hence the difference is positive
+			 */
+			if( libcdatetime_timezone_database_write_varint(
+			     record_data,
+			     record_data_size,
+			     &record_data_offset,
+			     (uint64_t) internal_timezone->transition_times[ transition_index ] - (uint64_t) internal_timezone->transition_times[ transition_index - 1 ] ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write transition: %" PRIu32 " time difference.",
+				 function,
+				 transition_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( internal_timezone->number_of_transitions > 0 )
+	{
+		if( memory_copy(
+		     &( record_data[ record_data_offset ] ),
+		     internal_timezone->transition_local_time_type_indexes,
+		     (size_t) internal_timezone->number_of_transitions ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy transition local time type indexes.",
+			 function );
+
+			goto on_error;
+		}
+		record_data_offset += (size_t) internal_timezone->number_of_transitions;
+	}
+	if( memory_copy(
+	     &( record_data[ record_data_offset ] ),
+	     internal_timezone->abbreviations,
+	     internal_timezone->abbreviations_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy abbreviations.",
+		 function );
+
+		goto on_error;
+	}
+	record_data_offset += internal_timezone->abbreviations_size;
+
+	if( internal_timezone->rule_string != NULL )
+	{
+		if( memory_copy(
+		     &( record_data[ record_data_offset ] ),
+		     internal_timezone->rule_string,
+		     internal_timezone->rule_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy rule string.",
+			 function );
+
+			goto on_error;
+		}
+		record_data_offset += internal_timezone->rule_string_size;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            record_data,
+	                            sizeof( uint8_t ) * record_data_offset );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize record data.",
+		 function );
+
+		goto on_error;
+	}
+	*data      = reallocation;
+	*data_size = record_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( record_data != NULL )
+	{
+		memory_free(
+		 record_data );
+	}
+	return( -1 );
+}
+
+/* Reads timezone database data
+ * The data is not copied and must remain available until the database is freed,
+ * which allows to use data that is linked into a program or mapped into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_read_data(
+     libcdatetime_timezone_database_t *database,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	const uint8_t *entry_data                                    = NULL;
+	const uint8_t *previous_name                                 = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_read_data";
+	size_t name_length                                           = 0;
+	size_t previous_name_length                                  = 0;
+	uint32_t entry_index                                         = 0;
+	uint32_t format_version                                      = 0;
+	uint32_t name_offset                                         = 0;
+	uint32_t number_of_records                                   = 0;
+	uint32_t number_of_timezones                                 = 0;
+	uint32_t record_data_offset                                  = 0;
+	uint32_t record_data_size                                    = 0;
+	uint32_t record_index                                        = 0;
+	uint32_t records_offset                                      = 0;
+	uint32_t stored_data_size                                    = 0;
+	uint32_t timezones_offset                                    = 0;
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = (libcdatetime_internal_timezone_database_t *) database;
+
+	if( ( internal_database->data != NULL )
+	 || ( internal_database->appended_names != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid database - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE )
+	 || ( data_size > (size_t) LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     LIBCDATETIME_TIMEZONE_DATABASE_SIGNATURE,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 stored_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 number_of_timezones );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 20 ] ),
+	 timezones_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 24 ] ),
+	 number_of_records );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 28 ] ),
+	 records_offset );
+
+	if( format_version != LIBCDATETIME_TIMEZONE_DATABASE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( ( stored_data_size < LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE )
+	 || ( (size_t) stored_data_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stored data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_timezones > (uint32_t) INT_MAX )
+	 || ( timezones_offset < LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE )
+	 || ( timezones_offset > stored_data_size )
+	 || ( ( (uint64_t) number_of_timezones * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) > (uint64_t) ( stored_data_size - timezones_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid timezone entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( records_offset < LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE )
+	 || ( records_offset > stored_data_size )
+	 || ( ( (uint64_t) number_of_records * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) > (uint64_t) ( stored_data_size - records_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entries are validated once so that timezones can be looked up without bounds checks
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_records;
+	     entry_index++ )
+	{
+		entry_data = &( data[ records_offset + ( entry_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 0 ] ),
+		 record_data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 4 ] ),
+		 record_data_size );
+
+		if( ( record_data_offset < LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE )
+		 || ( record_data_offset > stored_data_size )
+		 || ( record_data_size > ( stored_data_size - record_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu32 " data value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_timezones;
+	     entry_index++ )
+	{
+		entry_data = &( data[ timezones_offset + ( entry_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 0 ] ),
+		 name_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 4 ] ),
+		 record_index );
+
+		if( record_index >= number_of_records )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid timezone: %" PRIu32 " record index value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( name_offset < LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE )
+		 || ( name_offset >= stored_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid timezone: %" PRIu32 " name offset value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		for( name_length = 0;
+		     ( name_offset + name_length ) < stored_data_size;
+		     name_length++ )
+		{
+			if( data[ name_offset + name_length ] == 0 )
+			{
+				break;
+			}
+		}
+		if( ( name_length == 0 )
+		 || ( ( name_offset + name_length ) >= stored_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timezone: %" PRIu32 " name.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		/* The names must be stored in ascending order to be searched
+		 */
+		if( ( previous_name != NULL )
+		 && ( libcdatetime_timezone_database_compare_name(
+		       (char *) previous_name,
+		       previous_name_length,
+		       &( data[ name_offset ] ) ) >= 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timezone: %" PRIu32 " name not in ascending order.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		previous_name        = &( data[ name_offset ] );
+		previous_name_length = name_length;
+	}
+	internal_database->data                = data;
+	internal_database->data_size           = (size_t) stored_data_size;
+	internal_database->number_of_timezones = number_of_timezones;
+	internal_database->timezones_offset    = timezones_offset;
+	internal_database->number_of_records   = number_of_records;
+	internal_database->records_offset      = records_offset;
+
+	return( 1 );
+}
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+
+/* Reads a timezone database file
+ * The file is mapped into memory where supported, otherwise it is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_read_file(
+     libcdatetime_timezone_database_t *database,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_read_file";
+
+#if defined( LIBCDATETIME_HAVE_TIMEZONE_DATABASE_MMAP )
+	struct stat file_stat;
+
+	void *mapped_data                                            = NULL;
+	size_t data_size                                             = 0;
+	int file_descriptor                                          = -1;
+#else
+	FILE *file_stream                                            = NULL;
+	uint8_t *data                                                = NULL;
+	uint8_t *reallocation                                        = NULL;
+	size_t allocated_data_size                                   = 0;
+	size_t data_size                                             = 0;
+	size_t read_count                                            = 0;
+	size_t read_size                                             = 0;
+#endif
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = (libcdatetime_internal_timezone_database_t *) database;
+
+	if( ( internal_database->data != NULL )
+	 || ( internal_database->appended_names != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid database - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDATETIME_HAVE_TIMEZONE_DATABASE_MMAP )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_stat ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to determine size of: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( ( file_stat.st_size < (off_t) LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE )
+	 || ( file_stat.st_size > (off_t) LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size of: %s value out of bounds.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	data_size = (size_t) file_stat.st_size;
+
+	mapped_data = mmap(
+	               NULL,
+	               data_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 errno,
+		 "%s: unable to map: %s.",
+		 function,
+		 filename );
+
+		mapped_data = NULL;
+
+		goto on_error;
+	}
+	close(
+	 file_descriptor );
+
+	file_descriptor = -1;
+
+	if( libcdatetime_timezone_database_read_data(
+	     database,
+	     (uint8_t *) mapped_data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read timezone database data from: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The whole mapping is unmapped when the database is freed
+	 */
+	internal_database->mapped_data      = mapped_data;
+	internal_database->mapped_data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( mapped_data != NULL )
+	{
+		munmap(
+		 mapped_data,
+		 data_size );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+
+	if( file_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	/* The data is read in blocks, where the size of the data is doubled when it is full
+	 */
+	do
+	{
+		if( data_size == allocated_data_size )
+		{
+			if( allocated_data_size == 0 )
+			{
+				allocated_data_size = 65536;
+			}
+			else
+			{
+				allocated_data_size *= 2;
+			}
+			if( allocated_data_size > (size_t) LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_DATA_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid data size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            data,
+			                            sizeof( uint8_t ) * allocated_data_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize data.",
+				 function );
+
+				goto on_error;
+			}
+			data = reallocation;
+		}
+		read_size = allocated_data_size - data_size;
+
+		read_count = file_stream_read(
+		              file_stream,
+		              &( data[ data_size ] ),
+		              read_size );
+
+		if( ( read_count < read_size )
+		 && ( file_stream_at_end(
+		       file_stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		data_size += read_count;
+	}
+	while( read_count == read_size );
+
+	file_stream_close(
+	 file_stream );
+
+	file_stream = NULL;
+
+	if( libcdatetime_timezone_database_read_data(
+	     database,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read timezone database data from: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	internal_database->allocated_data = data;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+
+#endif /* defined( LIBCDATETIME_HAVE_TIMEZONE_DATABASE_MMAP ) */
+}
+
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+
+/* Retrieves the name of a specific timezone
+ * Returns 1 if successful or -1 on error
+ */
+static int libcdatetime_internal_timezone_database_get_name_by_index(
+            libcdatetime_internal_timezone_database_t *internal_database,
+            int timezone_index,
+            const char **name,
+            size_t *name_size )
+{
+	uint32_t name_offset = 0;
+
+	if( internal_database->data != NULL )
+	{
+		if( ( timezone_index < 0 )
+		 || ( (uint32_t) timezone_index >= internal_database->number_of_timezones ) )
+		{
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_database->data[ internal_database->timezones_offset + ( (uint32_t) timezone_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) ] ),
+		 name_offset );
+
+		*name      = (char *) &( internal_database->data[ name_offset ] );
+		*name_size = narrow_string_length( *name ) + 1;
+	}
+	else
+	{
+		if( ( timezone_index < 0 )
+		 || ( (uint32_t) timezone_index >= internal_database->number_of_appended_names ) )
+		{
+			return( -1 );
+		}
+		*name      = internal_database->appended_names[ timezone_index ].name;
+		*name_size = internal_database->appended_names[ timezone_index ].name_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of timezones
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_get_number_of_timezones(
+     libcdatetime_timezone_database_t *database,
+     int *number_of_timezones,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_get_number_of_timezones";
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = (libcdatetime_internal_timezone_database_t *) database;
+
+	if( number_of_timezones == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of timezones.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_database->data != NULL )
+	{
+		*number_of_timezones = (int) internal_database->number_of_timezones;
+	}
+	else
+	{
+		*number_of_timezones = (int) internal_database->number_of_appended_names;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the name of a specific timezone
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_get_timezone_name_size(
+     libcdatetime_timezone_database_t *database,
+     int timezone_index,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	const char *safe_name                                        = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_get_timezone_name_size";
+	size_t safe_name_size                                        = 0;
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = (libcdatetime_internal_timezone_database_t *) database;
+
+	if( name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timezone_database_get_name_by_index(
+	     internal_database,
+	     timezone_index,
+	     &safe_name,
+	     &safe_name_size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid timezone index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*name_size = safe_name_size;
+
+	return( 1 );
+}
+
+/* Retrieves the name of a specific timezone
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_get_timezone_name(
+     libcdatetime_timezone_database_t *database,
+     int timezone_index,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	const char *safe_name                                        = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_get_timezone_name";
+	size_t safe_name_size                                        = 0;
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = (libcdatetime_internal_timezone_database_t *) database;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_internal_timezone_database_get_name_by_index(
+	     internal_database,
+	     timezone_index,
+	     &safe_name,
+	     &safe_name_size ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid timezone index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size < safe_name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid name size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     name,
+	     safe_name,
+	     safe_name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a named timezone from the timezone database
+ * The timezones are searched by name with a binary search
+ * Returns 1 if successful, 0 if no such timezone or -1 on error
+ */
+int libcdatetime_internal_timezone_database_read_timezone(
+     libcdatetime_internal_timezone_database_t *internal_database,
+     const char *name,
+     size_t name_length,
+     libcdatetime_internal_timezone_t *internal_timezone,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data   = NULL;
+	const uint8_t *record_data  = NULL;
+	static char *function       = "libcdatetime_internal_timezone_database_read_timezone";
+	size_t record_data_size     = 0;
+	uint32_t lower_bound        = 0;
+	uint32_t middle_index       = 0;
+	uint32_t name_offset        = 0;
+	uint32_t record_data_offset = 0;
+	uint32_t record_index       = 0;
+	uint32_t upper_bound        = 0;
+	int compare_result          = 0;
+
+	if( internal_database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_database->data != NULL )
+	{
+		upper_bound = internal_database->number_of_timezones;
+	}
+	else
+	{
+		upper_bound = internal_database->number_of_appended_names;
+	}
+	while( lower_bound < upper_bound )
+	{
+		middle_index = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+
+		if( internal_database->data != NULL )
+		{
+			entry_data = &( internal_database->data[ internal_database->timezones_offset + ( middle_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( entry_data[ 0 ] ),
+			 name_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( entry_data[ 4 ] ),
+			 record_index );
+
+			compare_result = libcdatetime_timezone_database_compare_name(
+			                  name,
+			                  name_length,
+			                  &( internal_database->data[ name_offset ] ) );
+		}
+		else
+		{
+			record_index = internal_database->appended_names[ middle_index ].record_index;
+
+			compare_result = libcdatetime_timezone_database_compare_name(
+			                  name,
+			                  name_length,
+			                  (uint8_t *) internal_database->appended_names[ middle_index ].name );
+		}
+		if( compare_result == 0 )
+		{
+			break;
+		}
+		else if( compare_result < 0 )
+		{
+			upper_bound = middle_index;
+		}
+		else
+		{
+			lower_bound = middle_index + 1;
+		}
+	}
+	if( lower_bound >= upper_bound )
+	{
+		return( 0 );
+	}
+	if( internal_database->data != NULL )
+	{
+		entry_data = &( internal_database->data[ internal_database->records_offset + ( record_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 0 ] ),
+		 record_data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 4 ] ),
+		 record_data_size );
+
+		record_data = &( internal_database->data[ record_data_offset ] );
+	}
+	else
+	{
+		record_data      = internal_database->appended_records[ record_index ].data;
+		record_data_size = internal_database->appended_records[ record_index ].data_size;
+	}
+	if( libcdatetime_timezone_database_read_record(
+	     internal_timezone,
+	     record_data,
+	     record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record: %" PRIu32 ".",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a named timezone from the timezone database
+ * The name is the name of the timezone in the zoneinfo directory, for example "Europe/Amsterdam"
+ * Make sure the value timezone is referencing, is set to NULL
+ * Returns 1 if successful, 0 if no such timezone or -1 on error
+ */
+int libcdatetime_timezone_database_get_timezone_by_name(
+     libcdatetime_timezone_database_t *database,
+     const char *name,
+     size_t name_length,
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_t *safe_timezone = NULL;
+	static char *function                  = "libcdatetime_timezone_database_get_timezone_by_name";
+	int result                             = 0;
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timezone != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timezone value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_timezone_initialize(
+	     &safe_timezone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timezone.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcdatetime_internal_timezone_database_read_timezone(
+	          (libcdatetime_internal_timezone_database_t *) database,
+	          name,
+	          name_length,
+	          (libcdatetime_internal_timezone_t *) safe_timezone,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read timezone.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libcdatetime_timezone_free(
+		     &safe_timezone,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free timezone.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	*timezone = safe_timezone;
+
+	return( 1 );
+
+on_error:
+	if( safe_timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &safe_timezone,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a named timezone to the timezone database
+ * Timezones with the same transitions, local time types, abbreviations and rule share their data
+ * Timezones cannot be appended to a database of which the data has been read
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_append_timezone(
+     libcdatetime_timezone_database_t *database,
+     const char *name,
+     size_t name_length,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	libcdatetime_timezone_database_name_t *database_name         = NULL;
+	libcdatetime_timezone_database_record_t *record              = NULL;
+	void *reallocation                                           = NULL;
+	char *name_copy                                              = NULL;
+	uint8_t *record_data                                         = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_append_timezone";
+	size_t record_data_size                                      = 0;
+	uint32_t lower_bound                                         = 0;
+	uint32_t middle_index                                        = 0;
+	uint32_t name_index                                          = 0;
+	uint32_t record_index                                        = 0;
+	uint32_t upper_bound                                         = 0;
+	int compare_result                                           = 0;
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = (libcdatetime_internal_timezone_database_t *) database;
+
+	if( internal_database->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid database - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > 255 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_length(
+	     name ) < name_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported name - contains end of string character.",
+		 function );
+
+		return( -1 );
+	}
+	if( timezone == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timezone.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_database->number_of_appended_names >= (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid database - number of timezones value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the index where the name is inserted to keep the names in ascending order
+	 */
+	upper_bound = internal_database->number_of_appended_names;
+
+	while( lower_bound < upper_bound )
+	{
+		middle_index = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+
+		compare_result = libcdatetime_timezone_database_compare_name(
+		                  name,
+		                  name_length,
+		                  (uint8_t *) internal_database->appended_names[ middle_index ].name );
+
+		if( compare_result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid database - name value already set.",
+			 function );
+
+			return( -1 );
+		}
+		else if( compare_result < 0 )
+		{
+			upper_bound = middle_index;
+		}
+		else
+		{
+			lower_bound = middle_index + 1;
+		}
+	}
+	if( libcdatetime_timezone_database_write_record(
+	     (libcdatetime_internal_timezone_t *) timezone,
+	     &record_data,
+	     &record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < internal_database->number_of_appended_records;
+	     record_index++ )
+	{
+		record = &( internal_database->appended_records[ record_index ] );
+
+		if( ( record->data_size == record_data_size )
+		 && ( memory_compare(
+		       record->data,
+		       record_data,
+		       record_data_size ) == 0 ) )
+		{
+			break;
+		}
+	}
+	name_copy = narrow_string_allocate(
+	             name_length + 1 );
+
+	if( name_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     name_copy,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	name_copy[ name_length ] = 0;
+
+	reallocation = memory_reallocate(
+	                internal_database->appended_names,
+	                sizeof( libcdatetime_timezone_database_name_t ) * ( internal_database->number_of_appended_names + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize names.",
+		 function );
+
+		goto on_error;
+	}
+	internal_database->appended_names = (libcdatetime_timezone_database_name_t *) reallocation;
+
+	if( record_index >= internal_database->number_of_appended_records )
+	{
+		reallocation = memory_reallocate(
+		                internal_database->appended_records,
+		                sizeof( libcdatetime_timezone_database_record_t ) * ( internal_database->number_of_appended_records + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize records.",
+			 function );
+
+			goto on_error;
+		}
+		internal_database->appended_records = (libcdatetime_timezone_database_record_t *) reallocation;
+
+		record = &( internal_database->appended_records[ record_index ] );
+
+		record->data      = record_data;
+		record->data_size = record_data_size;
+
+		internal_database->number_of_appended_records += 1;
+	}
+	else
+	{
+		memory_free(
+		 record_data );
+	}
+	record_data = NULL;
+
+	/* Move the names after the insertion index, starting with the last name
+	 */
+	for( name_index = internal_database->number_of_appended_names;
+	     name_index > lower_bound;
+	     name_index-- )
+	{
+		internal_database->appended_names[ name_index ] = internal_database->appended_names[ name_index - 1 ];
+	}
+	database_name = &( internal_database->appended_names[ lower_bound ] );
+
+	database_name->name         = name_copy;
+	database_name->name_size    = name_length + 1;
+	database_name->record_index = record_index;
+
+	internal_database->number_of_appended_names += 1;
+
+	return( 1 );
+
+on_error:
+	if( name_copy != NULL )
+	{
+		memory_free(
+		 name_copy );
+	}
+	if( record_data != NULL )
+	{
+		memory_free(
+		 record_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the timezone database data
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_get_data_size(
+     libcdatetime_timezone_database_t *database,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_get_data_size";
+	uint64_t safe_data_size                                      = 0;
+	uint32_t entry_index                                         = 0;
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = (libcdatetime_internal_timezone_database_t *) database;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_database->data != NULL )
+	{
+		*data_size = internal_database->data_size;
+
+		return( 1 );
+	}
+	safe_data_size = LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE
+	               + ( (uint64_t) internal_database->number_of_appended_names * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE )
+	               + ( (uint64_t) internal_database->number_of_appended_records * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE );
+
+	for( entry_index = 0;
+	     entry_index < internal_database->number_of_appended_names;
+	     entry_index++ )
+	{
+		safe_data_size += internal_database->appended_names[ entry_index ].name_size;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_database->number_of_appended_records;
+	     entry_index++ )
+	{
+		safe_data_size += internal_database->appended_records[ entry_index ].data_size;
+	}
+	if( safe_data_size > (uint64_t) LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the timezone database data
+ * The data consists of a file header, the timezone entries in ascending order of name,
+ * the record entries, the names and the records. All values are stored in little-endian
+ * Use libcdatetime_timezone_database_get_data_size to determine the size of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_database_write_data(
+     libcdatetime_timezone_database_t *database,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdatetime_internal_timezone_database_t *internal_database = NULL;
+	libcdatetime_timezone_database_name_t *database_name         = NULL;
+	libcdatetime_timezone_database_record_t *record              = NULL;
+	static char *function                                        = "libcdatetime_timezone_database_write_data";
+	size_t data_offset                                           = 0;
+	size_t required_data_size                                    = 0;
+	uint32_t entry_index                                         = 0;
+	uint32_t records_offset                                      = 0;
+
+	if( database == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database.",
+		 function );
+
+		return( -1 );
+	}
+	internal_database = (libcdatetime_internal_timezone_database_t *) database;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_timezone_database_get_data_size(
+	     database,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < required_data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_database->data != NULL )
+	{
+		if( memory_copy(
+		     data,
+		     internal_database->data,
+		     internal_database->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	records_offset = LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE
+	               + ( internal_database->number_of_appended_names * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE );
+
+	if( memory_copy(
+	     data,
+	     LIBCDATETIME_TIMEZONE_DATABASE_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 LIBCDATETIME_TIMEZONE_DATABASE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 (uint32_t) required_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 internal_database->number_of_appended_names );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 20 ] ),
+	 LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 24 ] ),
+	 internal_database->number_of_appended_records );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 28 ] ),
+	 records_offset );
+
+	/* The names and records are stored after the entries
+	 */
+	data_offset = (size_t) records_offset
+	            + ( internal_database->number_of_appended_records * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE );
+
+	for( entry_index = 0;
+	     entry_index < internal_database->number_of_appended_names;
+	     entry_index++ )
+	{
+		database_name = &( internal_database->appended_names[ entry_index ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE + ( entry_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) ] ),
+		 (uint32_t) data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE + ( entry_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) + 4 ] ),
+		 database_name->record_index );
+
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     database_name->name,
+		     database_name->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		data_offset += database_name->name_size;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_database->number_of_appended_records;
+	     entry_index++ )
+	{
+		record = &( internal_database->appended_records[ entry_index ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ records_offset + ( entry_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) ] ),
+		 (uint32_t) data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ records_offset + ( entry_index * LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE ) + 4 ] ),
+		 (uint32_t) record->data_size );
+
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     record->data,
+		     record->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		data_offset += record->data_size;
+	}
+	return( 1 );
+}
+
+/* Sets the timezone database of the process
+ * Named timezones are read from the database before the zoneinfo directory is used.
+ * The database must remain available until it is unset by passing NULL.
+ * This function is not thread-safe and should be called before timezones
+ * are read by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_set_timezone_database(
+     libcdatetime_timezone_database_t *database,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_set_timezone_database";
+
+	if( ( database != NULL )
+	 && ( ( (libcdatetime_internal_timezone_database_t *) database )->data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid database - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	libcdatetime_process_timezone_database = database;
+
+	return( 1 );
+}
+
+/* Reads a named timezone from the timezone database of the process
+ * Returns 1 if successful, 0 if no database is set or no such timezone or -1 on error
+ */
+int libcdatetime_process_timezone_database_read_timezone(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_process_timezone_database_read_timezone";
+	int result            = 0;
+
+	if( libcdatetime_process_timezone_database == NULL )
+	{
+		return( 0 );
+	}
+	result = libcdatetime_internal_timezone_database_read_timezone(
+	          (libcdatetime_internal_timezone_database_t *) libcdatetime_process_timezone_database,
+	          name,
+	          name_length,
+	          internal_timezone,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read timezone.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
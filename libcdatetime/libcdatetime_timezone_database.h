@@ -0,0 +1,266 @@
+/*
+ * Timezone database functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_TIMEZONE_DATABASE_H )
+#define _LIBCDATETIME_TIMEZONE_DATABASE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_extern.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_timezone.h"
+#include "libcdatetime_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_SYS_STAT_H ) && !defined( WINAPI )
+#define LIBCDATETIME_HAVE_TIMEZONE_DATABASE_MMAP	1
+#endif
+
+/* The signature of timezone database data
+ */
+#define LIBCDATETIME_TIMEZONE_DATABASE_SIGNATURE	"cdtzdb\x00\x00"
+
+/* The format version of timezone database data
+ */
+#define LIBCDATETIME_TIMEZONE_DATABASE_FORMAT_VERSION	1
+
+/* The size of the timezone database file header
+ */
+#define LIBCDATETIME_TIMEZONE_DATABASE_FILE_HEADER_SIZE	32
+
+/* The size of a timezone or record entry in the timezone database
+ */
+#define LIBCDATETIME_TIMEZONE_DATABASE_ENTRY_SIZE	8
+
+/* The maximum supported size of timezone database data
+ */
+#define LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_DATA_SIZE	( 64 * 1024 * 1024 )
+
+/* The maximum size of an encoded variable-length integer
+ */
+#define LIBCDATETIME_TIMEZONE_DATABASE_MAXIMUM_VARINT_SIZE	10
+
+typedef struct libcdatetime_timezone_database_name libcdatetime_timezone_database_name_t;
+
+struct libcdatetime_timezone_database_name
+{
+	/* The name, with end of string character
+	 */
+	char *name;
+
+	/* The size of the name, including the end of string character
+	 */
+	size_t name_size;
+
+	/* The index of the record
+	 */
+	uint32_t record_index;
+};
+
+typedef struct libcdatetime_timezone_database_record libcdatetime_timezone_database_record_t;
+
+struct libcdatetime_timezone_database_record
+{
+	/* The encoded data
+	 */
+	uint8_t *data;
+
+	/* The size of the encoded data
+	 */
+	size_t data_size;
+};
+
+typedef struct libcdatetime_internal_timezone_database libcdatetime_internal_timezone_database_t;
+
+struct libcdatetime_internal_timezone_database
+{
+	/* The data, which is either referenced, allocated or mapped
+	 */
+	const uint8_t *data;
+
+	/* The size of the data
+	 */
+	size_t data_size;
+
+	/* The allocated data
+	 */
+	uint8_t *allocated_data;
+
+#if defined( LIBCDATETIME_HAVE_TIMEZONE_DATABASE_MMAP )
+	/* The mapped data
+	 */
+	void *mapped_data;
+
+	/* The size of the mapped data
+	 */
+	size_t mapped_data_size;
+#endif
+
+	/* The number of timezones in the data
+	 */
+	uint32_t number_of_timezones;
+
+	/* The offset of the timezone entries in the data
+	 */
+	uint32_t timezones_offset;
+
+	/* The number of records in the data
+	 */
+	uint32_t number_of_records;
+
+	/* The offset of the record entries in the data
+	 */
+	uint32_t records_offset;
+
+	/* The appended names, which are stored in ascending order
+	 */
+	libcdatetime_timezone_database_name_t *appended_names;
+
+	/* The number of appended names
+	 */
+	uint32_t number_of_appended_names;
+
+	/* The appended records, where timezones with the same encoded data share a record
+	 */
+	libcdatetime_timezone_database_record_t *appended_records;
+
+	/* The number of appended records
+	 */
+	uint32_t number_of_appended_records;
+};
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_initialize(
+     libcdatetime_timezone_database_t **database,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_free(
+     libcdatetime_timezone_database_t **database,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_database_read_record(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_database_write_record(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_read_data(
+     libcdatetime_timezone_database_t *database,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_read_file(
+     libcdatetime_timezone_database_t *database,
+     const char *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_get_number_of_timezones(
+     libcdatetime_timezone_database_t *database,
+     int *number_of_timezones,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_get_timezone_name_size(
+     libcdatetime_timezone_database_t *database,
+     int timezone_index,
+     size_t *name_size,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_get_timezone_name(
+     libcdatetime_timezone_database_t *database,
+     int timezone_index,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int libcdatetime_internal_timezone_database_read_timezone(
+     libcdatetime_internal_timezone_database_t *internal_database,
+     const char *name,
+     size_t name_length,
+     libcdatetime_internal_timezone_t *internal_timezone,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_get_timezone_by_name(
+     libcdatetime_timezone_database_t *database,
+     const char *name,
+     size_t name_length,
+     libcdatetime_timezone_t **timezone,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_append_timezone(
+     libcdatetime_timezone_database_t *database,
+     const char *name,
+     size_t name_length,
+     libcdatetime_timezone_t *timezone,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_get_data_size(
+     libcdatetime_timezone_database_t *database,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_timezone_database_write_data(
+     libcdatetime_timezone_database_t *database,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBCDATETIME_EXTERN \
+int libcdatetime_set_timezone_database(
+     libcdatetime_timezone_database_t *database,
+     libcerror_error_t **error );
+
+int libcdatetime_process_timezone_database_read_timezone(
+     libcdatetime_internal_timezone_t *internal_timezone,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_TIMEZONE_DATABASE_H ) */
+
@@ -0,0 +1,1451 @@
+/*
+ * Timezone rule functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcdatetime_atomic.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_support.h"
+#include "libcdatetime_timezone_rule.h"
+
+/* Creates a timezone rule
+ * Make sure the value rule is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_rule_initialize(
+     libcdatetime_timezone_rule_t **rule,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_timezone_rule_initialize";
+
+	if( rule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rule.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rule != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid rule value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*rule = memory_allocate_structure(
+	         libcdatetime_timezone_rule_t );
+
+	if( *rule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create rule.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *rule,
+	     0,
+	     sizeof( libcdatetime_timezone_rule_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear rule.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *rule != NULL )
+	{
+		memory_free(
+		 *rule );
+
+		*rule = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a timezone rule
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_rule_free(
+     libcdatetime_timezone_rule_t **rule,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_timezone_rule_free";
+
+	if( rule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rule.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rule != NULL )
+	{
+		memory_free(
+		 *rule );
+
+		*rule = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a timezone rule date from a Windows SYSTEMTIME structure
+ * A SYSTEMTIME with a year of 0 contains a day of the week in a week of the month,
+ * otherwise it contains a day of the month that only applies to that year.
+ * The milliseconds are rounded to seconds
+ * Returns 1 if successful, 0 if the SYSTEMTIME does not contain a date or -1 on error
+ */
+int libcdatetime_timezone_rule_date_read_systemtime(
+     libcdatetime_timezone_rule_date_t *date,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcdatetime_timezone_rule_date_read_systemtime";
+	uint16_t day           = 0;
+	uint16_t day_of_week   = 0;
+	uint16_t hours         = 0;
+	uint16_t milli_seconds = 0;
+	uint16_t minutes       = 0;
+	uint16_t month         = 0;
+	uint16_t seconds       = 0;
+	uint16_t year          = 0;
+	uint8_t days_in_month  = 0;
+
+	if( date == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < LIBCDATETIME_TIMEZONE_RULE_SYSTEMTIME_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 0 ] ),
+	 year );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 2 ] ),
+	 month );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 4 ] ),
+	 day_of_week );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 6 ] ),
+	 day );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 8 ] ),
+	 hours );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 10 ] ),
+	 minutes );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 12 ] ),
+	 seconds );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 14 ] ),
+	 milli_seconds );
+
+	/* A month of 0 indicates there is no transition
+	 */
+	if( month == 0 )
+	{
+		return( 0 );
+	}
+	if( month > 12 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid month value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hours > 23 )
+	 || ( minutes > 59 )
+	 || ( seconds > 59 )
+	 || ( milli_seconds > 999 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( year == 0 )
+	{
+		if( day_of_week > 6 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid day of week value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The day contains the week of the month
+		 */
+		if( ( day == 0 )
+		 || ( day > 5 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid week of month value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		date->type          = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+		date->year          = 0;
+		date->week_of_month = (uint8_t) day;
+		date->day_of_week   = (uint8_t) day_of_week;
+		date->day           = 0;
+	}
+	else
+	{
+		if( libcdatetime_get_days_in_month(
+		     &days_in_month,
+		     year,
+		     (uint8_t) month,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve days in month.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( day == 0 )
+		 || ( day > (uint16_t) days_in_month ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid day of month value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		date->type          = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_DAY;
+		date->year          = year;
+		date->week_of_month = 0;
+		date->day_of_week   = 0;
+		date->day           = day;
+	}
+	date->month       = (uint8_t) month;
+	date->time_of_day = ( (int32_t) hours * 3600 ) + ( (int32_t) minutes * 60 ) + (int32_t) seconds;
+
+	if( milli_seconds >= 500 )
+	{
+		date->time_of_day += 1;
+	}
+	return( 1 );
+}
+
+/* Copies an abbreviation from a POSIX TZ rule string
+ * An abbreviation consists of at least 3 alphabetic characters or is enclosed
+ * by '<' and '>' and consists of at least 3 alphanumeric, '+' or '-' characters
+ * Returns 1 if successful or -1 if the string does not contain a valid abbreviation
+ */
+static int libcdatetime_timezone_rule_copy_abbreviation_from_string(
+            const char *string,
+            size_t string_length,
+            size_t *string_index,
+            char *abbreviation,
+            size_t abbreviation_size )
+{
+	size_t abbreviation_length = 0;
+	size_t safe_string_index   = 0;
+	char character             = 0;
+	uint8_t is_quoted          = 0;
+
+	safe_string_index = *string_index;
+
+	if( ( safe_string_index < string_length )
+	 && ( string[ safe_string_index ] == '<' ) )
+	{
+		is_quoted          = 1;
+		safe_string_index += 1;
+	}
+	while( safe_string_index < string_length )
+	{
+		character = string[ safe_string_index ];
+
+		if( ( ( character < 'A' )
+		  || ( character > 'Z' ) )
+		 && ( ( character < 'a' )
+		  || ( character > 'z' ) ) )
+		{
+			if( is_quoted == 0 )
+			{
+				break;
+			}
+			if( ( ( character < '0' )
+			  || ( character > '9' ) )
+			 && ( character != '+' )
+			 && ( character != '-' ) )
+			{
+				break;
+			}
+		}
+		if( ( abbreviation_length + 1 ) >= abbreviation_size )
+		{
+			return( -1 );
+		}
+		abbreviation[ abbreviation_length++ ] = character;
+
+		safe_string_index++;
+	}
+	if( abbreviation_length < 3 )
+	{
+		return( -1 );
+	}
+	if( is_quoted != 0 )
+	{
+		if( ( safe_string_index >= string_length )
+		 || ( string[ safe_string_index ] != '>' ) )
+		{
+			return( -1 );
+		}
+		safe_string_index += 1;
+	}
+	abbreviation[ abbreviation_length ] = 0;
+
+	*string_index = safe_string_index;
+
+	return( 1 );
+}
+
+/* Copies a decimal number of at least 1 digit from a POSIX TZ rule string
+ * Returns 1 if successful or -1 if the string does not contain a valid number
+ */
+static int libcdatetime_timezone_rule_copy_number_from_string(
+            const char *string,
+            size_t string_length,
+            size_t *string_index,
+            uint32_t maximum_value,
+            uint32_t *value )
+{
+	size_t safe_string_index = 0;
+	uint32_t safe_value      = 0;
+
+	safe_string_index = *string_index;
+
+	while( ( safe_string_index < string_length )
+	    && ( string[ safe_string_index ] >= '0' )
+	    && ( string[ safe_string_index ] <= '9' ) )
+	{
+		safe_value *= 10;
+		safe_value += (uint32_t) ( string[ safe_string_index ] - '0' );
+
+		if( safe_value > maximum_value )
+		{
+			return( -1 );
+		}
+		safe_string_index++;
+	}
+	if( safe_string_index == *string_index )
+	{
+		return( -1 );
+	}
+	*string_index = safe_string_index;
+	*value        = safe_value;
+
+	return( 1 );
+}
+
+/* Copies a signed time in the form [+|-]hh[:mm[:ss]] from a POSIX TZ rule string
+ * The time is in seconds
+ * Returns 1 if successful or -1 if the string does not contain a valid time
+ */
+static int libcdatetime_timezone_rule_copy_time_from_string(
+            const char *string,
+            size_t string_length,
+            size_t *string_index,
+            uint32_t maximum_hours,
+            int32_t *time )
+{
+	size_t safe_string_index = 0;
+	uint32_t hours           = 0;
+	uint32_t minutes         = 0;
+	uint32_t seconds         = 0;
+	int32_t sign             = 1;
+
+	safe_string_index = *string_index;
+
+	if( safe_string_index < string_length )
+	{
+		if( string[ safe_string_index ] == '-' )
+		{
+			sign               = -1;
+			safe_string_index += 1;
+		}
+		else if( string[ safe_string_index ] == '+' )
+		{
+			safe_string_index += 1;
+		}
+	}
+	if( libcdatetime_timezone_rule_copy_number_from_string(
+	     string,
+	     string_length,
+	     &safe_string_index,
+	     maximum_hours,
+	     &hours ) != 1 )
+	{
+		return( -1 );
+	}
+	if( ( safe_string_index < string_length )
+	 && ( string[ safe_string_index ] == ':' ) )
+	{
+		safe_string_index += 1;
+
+		if( libcdatetime_timezone_rule_copy_number_from_string(
+		     string,
+		     string_length,
+		     &safe_string_index,
+		     59,
+		     &minutes ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( safe_string_index < string_length )
+		 && ( string[ safe_string_index ] == ':' ) )
+		{
+			safe_string_index += 1;
+
+			if( libcdatetime_timezone_rule_copy_number_from_string(
+			     string,
+			     string_length,
+			     &safe_string_index,
+			     59,
+			     &seconds ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	*string_index = safe_string_index;
+	*time         = sign * (int32_t) ( ( hours * 3600 ) + ( minutes * 60 ) + seconds );
+
+	return( 1 );
+}
+
+/* Copies a date in the form Jn, n or Mm.w.d, optionally followed by /time, from a POSIX TZ rule string
+ * Returns 1 if successful or -1 if the string does not contain a valid date
+ */
+static int libcdatetime_timezone_rule_copy_date_from_string(
+            const char *string,
+            size_t string_length,
+            size_t *string_index,
+            libcdatetime_timezone_rule_date_t *date )
+{
+	size_t safe_string_index = 0;
+	uint32_t day             = 0;
+	uint32_t day_of_week     = 0;
+	uint32_t month           = 0;
+	uint32_t week_of_month   = 0;
+
+	safe_string_index = *string_index;
+
+	if( safe_string_index >= string_length )
+	{
+		return( -1 );
+	}
+	if( string[ safe_string_index ] == 'J' )
+	{
+		safe_string_index += 1;
+
+		if( ( libcdatetime_timezone_rule_copy_number_from_string(
+		       string,
+		       string_length,
+		       &safe_string_index,
+		       365,
+		       &day ) != 1 )
+		 || ( day == 0 ) )
+		{
+			return( -1 );
+		}
+		date->type = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_JULIAN_DAY;
+	}
+	else if( string[ safe_string_index ] == 'M' )
+	{
+		safe_string_index += 1;
+
+		if( ( libcdatetime_timezone_rule_copy_number_from_string(
+		       string,
+		       string_length,
+		       &safe_string_index,
+		       12,
+		       &month ) != 1 )
+		 || ( month == 0 ) )
+		{
+			return( -1 );
+		}
+		if( ( safe_string_index >= string_length )
+		 || ( string[ safe_string_index ] != '.' ) )
+		{
+			return( -1 );
+		}
+		safe_string_index += 1;
+
+		if( ( libcdatetime_timezone_rule_copy_number_from_string(
+		       string,
+		       string_length,
+		       &safe_string_index,
+		       5,
+		       &week_of_month ) != 1 )
+		 || ( week_of_month == 0 ) )
+		{
+			return( -1 );
+		}
+		if( ( safe_string_index >= string_length )
+		 || ( string[ safe_string_index ] != '.' ) )
+		{
+			return( -1 );
+		}
+		safe_string_index += 1;
+
+		if( libcdatetime_timezone_rule_copy_number_from_string(
+		     string,
+		     string_length,
+		     &safe_string_index,
+		     6,
+		     &day_of_week ) != 1 )
+		{
+			return( -1 );
+		}
+		date->type = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	}
+	else
+	{
+		if( libcdatetime_timezone_rule_copy_number_from_string(
+		     string,
+		     string_length,
+		     &safe_string_index,
+		     365,
+		     &day ) != 1 )
+		{
+			return( -1 );
+		}
+		date->type = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_DAY_OF_YEAR;
+	}
+	date->year          = 0;
+	date->month         = (uint8_t) month;
+	date->week_of_month = (uint8_t) week_of_month;
+	date->day_of_week   = (uint8_t) day_of_week;
+	date->day           = (uint16_t) day;
+	date->time_of_day   = LIBCDATETIME_TIMEZONE_RULE_DEFAULT_TIME_OF_DAY;
+
+	/* RFC 8536 extends the hours of the time to the range of -167 to 167
+	 */
+	if( ( safe_string_index < string_length )
+	 && ( string[ safe_string_index ] == '/' ) )
+	{
+		safe_string_index += 1;
+
+		if( libcdatetime_timezone_rule_copy_time_from_string(
+		     string,
+		     string_length,
+		     &safe_string_index,
+		     167,
+		     &( date->time_of_day ) ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	*string_index = safe_string_index;
+
+	return( 1 );
+}
+
+/* Reads a timezone rule from a POSIX TZ rule string
+ * The rule string has the form std offset[dst[offset][,start[/time],end[/time]]],
+ * where the offsets are the number of hours west of UTC. Without dates the United States
+ * rule M3.2.0,M11.1.0 is used. The rule string ends at the end of string character
+ * or at the string size
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_rule_read_string(
+     libcdatetime_timezone_rule_t *rule,
+     const char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libcdatetime_timezone_rule_read_string";
+	size_t string_index                     = 0;
+	size_t string_length                    = 0;
+	int32_t daylight_saving_time_utc_offset = 0;
+	int32_t standard_utc_offset             = 0;
+	int result                              = -1;
+
+	if( rule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rule.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_length < string_size )
+	    && ( string[ string_length ] != 0 ) )
+	{
+		string_length++;
+	}
+	if( libcdatetime_timezone_rule_copy_abbreviation_from_string(
+	     string,
+	     string_length,
+	     &string_index,
+	     rule->standard_abbreviation,
+	     LIBCDATETIME_TIMEZONE_RULE_MAXIMUM_ABBREVIATION_SIZE ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported standard time abbreviation at index: %" PRIzd ".",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	/* The offset is the number of hours west of UTC, which is the negative of the UTC offset
+	 */
+	if( libcdatetime_timezone_rule_copy_time_from_string(
+	     string,
+	     string_length,
+	     &string_index,
+	     24,
+	     &standard_utc_offset ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported standard time offset at index: %" PRIzd ".",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	rule->standard_utc_offset                    = -standard_utc_offset;
+	rule->daylight_saving_time_utc_offset        = -standard_utc_offset;
+	rule->has_daylight_saving_time               = 0;
+	rule->daylight_saving_time_abbreviation[ 0 ] = 0;
+
+	if( string_index >= string_length )
+	{
+		return( 1 );
+	}
+	if( libcdatetime_timezone_rule_copy_abbreviation_from_string(
+	     string,
+	     string_length,
+	     &string_index,
+	     rule->daylight_saving_time_abbreviation,
+	     LIBCDATETIME_TIMEZONE_RULE_MAXIMUM_ABBREVIATION_SIZE ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported daylight saving time abbreviation at index: %" PRIzd ".",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	/* Without an offset daylight saving time is 1 hour ahead of standard time
+	 */
+	if( ( string_index < string_length )
+	 && ( string[ string_index ] != ',' ) )
+	{
+		if( libcdatetime_timezone_rule_copy_time_from_string(
+		     string,
+		     string_length,
+		     &string_index,
+		     24,
+		     &daylight_saving_time_utc_offset ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported daylight saving time offset at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		rule->daylight_saving_time_utc_offset = -daylight_saving_time_utc_offset;
+	}
+	else
+	{
+		rule->daylight_saving_time_utc_offset = rule->standard_utc_offset + 3600;
+	}
+	if( string_index >= string_length )
+	{
+		rule->start_date.type          = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+		rule->start_date.year          = 0;
+		rule->start_date.month         = 3;
+		rule->start_date.week_of_month = 2;
+		rule->start_date.day_of_week   = 0;
+		rule->start_date.day           = 0;
+		rule->start_date.time_of_day   = LIBCDATETIME_TIMEZONE_RULE_DEFAULT_TIME_OF_DAY;
+
+		rule->end_date.type            = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+		rule->end_date.year            = 0;
+		rule->end_date.month           = 11;
+		rule->end_date.week_of_month   = 1;
+		rule->end_date.day_of_week     = 0;
+		rule->end_date.day             = 0;
+		rule->end_date.time_of_day     = LIBCDATETIME_TIMEZONE_RULE_DEFAULT_TIME_OF_DAY;
+	}
+	else
+	{
+		if( string[ string_index ] == ',' )
+		{
+			string_index += 1;
+
+			result = libcdatetime_timezone_rule_copy_date_from_string(
+			          string,
+			          string_length,
+			          &string_index,
+			          &( rule->start_date ) );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported start of daylight saving time at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		result = -1;
+
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] == ',' ) )
+		{
+			string_index += 1;
+
+			result = libcdatetime_timezone_rule_copy_date_from_string(
+			          string,
+			          string_length,
+			          &string_index,
+			          &( rule->end_date ) );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported end of daylight saving time at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( string_index < string_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported trailing data at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+	}
+	rule->has_daylight_saving_time = 1;
+
+	return( 1 );
+}
+
+/* Determines the day on which a timezone rule date falls in a specific year
+ * The day is the number of days since January 1, 1970
+ * Returns 1 if successful, 0 if the date does not occur in the year or -1 on error
+ */
+int libcdatetime_timezone_rule_date_get_days_since_epoch(
+     libcdatetime_timezone_rule_date_t *date,
+     uint16_t year,
+     int64_t *number_of_days,
+     libcerror_error_t **error )
+{
+	static char *function        = "libcdatetime_timezone_rule_date_get_days_since_epoch";
+	int64_t first_day_of_month   = 0;
+	int64_t first_day_of_year    = 0;
+	int64_t day_of_month         = 0;
+	uint8_t day_of_week_of_month = 0;
+	uint8_t days_in_month        = 0;
+
+	if( date == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid date.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_days == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of days.",
+		 function );
+
+		return( -1 );
+	}
+	switch( date->type )
+	{
+		case LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY:
+			if( ( date->week_of_month == 0 )
+			 || ( date->week_of_month > 5 )
+			 || ( date->day_of_week > 6 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid date - week or day of week value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdatetime_get_days_in_month(
+			     &days_in_month,
+			     year,
+			     date->month,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve days in month.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdatetime_get_days_since_epoch(
+			     &first_day_of_month,
+			     year,
+			     date->month,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve first day of month.",
+				 function );
+
+				return( -1 );
+			}
+			/* January 1, 1970 is a Thursday
+			 */
+			day_of_week_of_month = (uint8_t) ( ( ( first_day_of_month % 7 ) + 11 ) % 7 );
+
+			day_of_month = ( (int64_t) date->day_of_week + 7 - day_of_week_of_month ) % 7;
+
+			day_of_month += ( (int64_t) date->week_of_month - 1 ) * 7;
+
+			/* Week 5 represents the last occurrence of the day of the week in the month
+			 */
+			while( day_of_month >= (int64_t) days_in_month )
+			{
+				day_of_month -= 7;
+			}
+			*number_of_days = first_day_of_month + day_of_month;
+
+			break;
+
+		case LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_DAY:
+			if( ( date->year != 0 )
+			 && ( date->year != year ) )
+			{
+				return( 0 );
+			}
+			if( libcdatetime_get_days_since_epoch(
+			     number_of_days,
+			     year,
+			     date->month,
+			     (uint8_t) date->day,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of days.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_JULIAN_DAY:
+		case LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_DAY_OF_YEAR:
+			if( ( ( date->type == LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_JULIAN_DAY )
+			  && ( ( date->day == 0 )
+			   || ( date->day > 365 ) ) )
+			 || ( ( date->type == LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_DAY_OF_YEAR )
+			  && ( date->day > 365 ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid date - day value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdatetime_get_days_since_epoch(
+			     &first_day_of_year,
+			     year,
+			     1,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve first day of year.",
+				 function );
+
+				return( -1 );
+			}
+			*number_of_days = first_day_of_year + (int64_t) date->day;
+
+			/* The Julian day starts at 1 and never counts February 29
+			 */
+			if( date->type == LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_JULIAN_DAY )
+			{
+				*number_of_days -= 1;
+
+				if( ( date->day >= 60 )
+				 && ( libcdatetime_is_leap_year(
+				       year ) != 0 ) )
+				{
+					*number_of_days += 1;
+				}
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported date type.",
+			 function );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the start and end of a year and the daylight saving time transitions during the year
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_rule_calculate_year(
+     libcdatetime_timezone_rule_t *rule,
+     uint16_t year,
+     libcdatetime_timezone_rule_year_t *rule_year,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcdatetime_timezone_rule_calculate_year";
+	int64_t end_day        = 0;
+	int64_t first_day      = 0;
+	int64_t next_first_day = 0;
+	int64_t start_day      = 0;
+	int result             = 0;
+
+	if( rule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rule.",
+		 function );
+
+		return( -1 );
+	}
+	if( year == (uint16_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid year value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( rule_year == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rule year.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_get_days_since_epoch(
+	     &first_day,
+	     year,
+	     1,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first day of year.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_get_days_since_epoch(
+	     &next_first_day,
+	     year + 1,
+	     1,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first day of next year.",
+		 function );
+
+		return( -1 );
+	}
+	rule_year->year                            = year;
+	rule_year->has_daylight_saving_time        = 0;
+	rule_year->start_time                      = first_day * 86400;
+	rule_year->end_time                        = next_first_day * 86400;
+	rule_year->daylight_saving_time_start_time = 0;
+	rule_year->daylight_saving_time_end_time   = 0;
+
+	if( rule->has_daylight_saving_time == 0 )
+	{
+		return( 1 );
+	}
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &( rule->start_date ),
+	          year,
+	          &start_day,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve day of start of daylight saving time.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &( rule->end_date ),
+	          year,
+	          &end_day,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve day of end of daylight saving time.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	/* Daylight saving time starts in standard time and ends in daylight saving time
+	 */
+	rule_year->has_daylight_saving_time        = 1;
+	rule_year->daylight_saving_time_start_time = ( start_day * 86400 ) + rule->start_date.time_of_day - rule->standard_utc_offset;
+	rule_year->daylight_saving_time_end_time   = ( end_day * 86400 ) + rule->end_date.time_of_day - rule->daylight_saving_time_utc_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the start and end of a year and the daylight saving time transitions during the year
+ * The year is retrieved from the cached years, where a year that is not cached is calculated and cached.
+ * The cached years are protected by a sequence number so that they can be shared by multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_rule_get_year(
+     libcdatetime_timezone_rule_t *rule,
+     uint16_t year,
+     libcdatetime_timezone_rule_year_t *rule_year,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_rule_year_t *cached_year = NULL;
+	static char *function                          = "libcdatetime_timezone_rule_get_year";
+	uint32_t sequence_number                       = 0;
+
+	if( rule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rule.",
+		 function );
+
+		return( -1 );
+	}
+	if( rule_year == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rule year.",
+		 function );
+
+		return( -1 );
+	}
+	cached_year = &( rule->cached_years[ year % LIBCDATETIME_TIMEZONE_RULE_NUMBER_OF_CACHED_YEARS ] );
+
+	sequence_number = libcdatetime_atomic_load_uint32(
+	                   &( cached_year->sequence_number ) );
+
+	if( ( sequence_number != 0 )
+	 && ( ( sequence_number & 1 ) == 0 ) )
+	{
+		rule_year->year                            = cached_year->year;
+		rule_year->has_daylight_saving_time        = cached_year->has_daylight_saving_time;
+		rule_year->start_time                      = cached_year->start_time;
+		rule_year->end_time                        = cached_year->end_time;
+		rule_year->daylight_saving_time_start_time = cached_year->daylight_saving_time_start_time;
+		rule_year->daylight_saving_time_end_time   = cached_year->daylight_saving_time_end_time;
+
+		libcdatetime_atomic_thread_fence();
+
+		if( ( rule_year->year == year )
+		 && ( libcdatetime_atomic_load_uint32(
+		       &( cached_year->sequence_number ) ) == sequence_number ) )
+		{
+			return( 1 );
+		}
+	}
+	if( libcdatetime_timezone_rule_calculate_year(
+	     rule,
+	     year,
+	     rule_year,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate year: %" PRIu16 ".",
+		 function,
+		 year );
+
+		return( -1 );
+	}
+	/* Only a single thread updates a cached year, other threads use
+	 * the calculated year without caching it
+	 */
+	if( ( ( sequence_number & 1 ) == 0 )
+	 && ( libcdatetime_atomic_compare_and_swap_uint32(
+	       &( cached_year->sequence_number ),
+	       sequence_number,
+	       sequence_number + 1 ) != 0 ) )
+	{
+		cached_year->year                            = rule_year->year;
+		cached_year->has_daylight_saving_time        = rule_year->has_daylight_saving_time;
+		cached_year->start_time                      = rule_year->start_time;
+		cached_year->end_time                        = rule_year->end_time;
+		cached_year->daylight_saving_time_start_time = rule_year->daylight_saving_time_start_time;
+		cached_year->daylight_saving_time_end_time   = rule_year->daylight_saving_time_end_time;
+
+		libcdatetime_atomic_store_uint32(
+		 &( cached_year->sequence_number ),
+		 sequence_number + 2 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the local time type index that applies at a specific time
+ * The time is the number of seconds since January 1, 1970 00:00:00 UTC
+ * Standard time applies to times of which the year cannot be represented
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_timezone_rule_get_local_time_type_index(
+     libcdatetime_timezone_rule_t *rule,
+     int64_t posix_time,
+     uint8_t *local_time_type_index,
+     libcerror_error_t **error )
+{
+	libcdatetime_timezone_rule_year_t rule_year;
+
+	static char *function = "libcdatetime_timezone_rule_get_local_time_type_index";
+	int64_t standard_time = 0;
+	int64_t year          = 0;
+
+	if( rule == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rule.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_time_type_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local time type index.",
+		 function );
+
+		return( -1 );
+	}
+	*local_time_type_index = rule->standard_local_time_type_index;
+
+	if( rule->has_daylight_saving_time == 0 )
+	{
+		return( 1 );
+	}
+	if( ( ( rule->standard_utc_offset > 0 )
+	  && ( posix_time > ( (int64_t) INT64_MAX - rule->standard_utc_offset ) ) )
+	 || ( ( rule->standard_utc_offset < 0 )
+	  && ( posix_time < ( (int64_t) INT64_MIN - rule->standard_utc_offset ) ) ) )
+	{
+		return( 1 );
+	}
+	standard_time = posix_time + rule->standard_utc_offset;
+
+	/* Estimate the year using the average number of seconds in a Gregorian year,
+	 * the estimate is corrected using the start and end of the year
+	 */
+	year = standard_time / 31556952;
+
+	if( ( standard_time % 31556952 ) < 0 )
+	{
+		year -= 1;
+	}
+	year += 1970;
+
+	do
+	{
+		if( ( year < 0 )
+		 || ( year >= (int64_t) UINT16_MAX ) )
+		{
+			return( 1 );
+		}
+		if( libcdatetime_timezone_rule_get_year(
+		     rule,
+		     (uint16_t) year,
+		     &rule_year,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve year: %" PRIu16 ".",
+			 function,
+			 (uint16_t) year );
+
+			return( -1 );
+		}
+		if( standard_time < rule_year.start_time )
+		{
+			year -= 1;
+		}
+		else if( standard_time >= rule_year.end_time )
+		{
+			year += 1;
+		}
+		else
+		{
+			break;
+		}
+	}
+	while( 1 );
+
+	if( rule_year.has_daylight_saving_time == 0 )
+	{
+		return( 1 );
+	}
+	/* On the southern hemisphere daylight saving time ends before it starts
+	 */
+	if( rule_year.daylight_saving_time_start_time <= rule_year.daylight_saving_time_end_time )
+	{
+		if( ( posix_time >= rule_year.daylight_saving_time_start_time )
+		 && ( posix_time < rule_year.daylight_saving_time_end_time ) )
+		{
+			*local_time_type_index = rule->daylight_saving_time_local_time_type_index;
+		}
+	}
+	else if( ( posix_time < rule_year.daylight_saving_time_end_time )
+	      || ( posix_time >= rule_year.daylight_saving_time_start_time ) )
+	{
+		*local_time_type_index = rule->daylight_saving_time_local_time_type_index;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,211 @@
+/*
+ * Timezone rule functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_TIMEZONE_RULE_H )
+#define _LIBCDATETIME_TIMEZONE_RULE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of years of which the transition times are cached
+ */
+#define LIBCDATETIME_TIMEZONE_RULE_NUMBER_OF_CACHED_YEARS	8
+
+/* The size of a Windows SYSTEMTIME structure
+ */
+#define LIBCDATETIME_TIMEZONE_RULE_SYSTEMTIME_SIZE		16
+
+/* The maximum size of an abbreviation in a POSIX TZ rule string, including the end of string character
+ */
+#define LIBCDATETIME_TIMEZONE_RULE_MAXIMUM_ABBREVIATION_SIZE	16
+
+/* The time of the day of a transition in a POSIX TZ rule string if not specified, which is 02:00:00
+ */
+#define LIBCDATETIME_TIMEZONE_RULE_DEFAULT_TIME_OF_DAY		7200
+
+typedef struct libcdatetime_timezone_rule_date libcdatetime_timezone_rule_date_t;
+
+struct libcdatetime_timezone_rule_date
+{
+	/* The date type
+	 */
+	uint8_t type;
+
+	/* The year of a month and day date or 0 if the date applies to every year
+	 */
+	uint16_t year;
+
+	/* The month
+	 */
+	uint8_t month;
+
+	/* The week of the month, where 5 represents the last week of the month
+	 */
+	uint8_t week_of_month;
+
+	/* The day of the week, where 0 represents Sunday
+	 */
+	uint8_t day_of_week;
+
+	/* The day of the month, the Julian day or the day of the year
+	 */
+	uint16_t day;
+
+	/* The time of the day in seconds, in the local time that applies before the transition
+	 */
+	int32_t time_of_day;
+};
+
+typedef struct libcdatetime_timezone_rule_year libcdatetime_timezone_rule_year_t;
+
+struct libcdatetime_timezone_rule_year
+{
+	/* The sequence number
+	 * The sequence number is 0 while the cached year is not set and odd while it is being updated
+	 */
+	uint32_t sequence_number;
+
+	/* The year
+	 */
+	uint16_t year;
+
+	/* Value to indicate daylight saving time applies during the year
+	 */
+	uint8_t has_daylight_saving_time;
+
+	/* The start of the year as the number of seconds since January 1, 1970 00:00:00 in standard time
+	 */
+	int64_t start_time;
+
+	/* The end of the year as the number of seconds since January 1, 1970 00:00:00 in standard time
+	 */
+	int64_t end_time;
+
+	/* The start of daylight saving time as the number of seconds since January 1, 1970 00:00:00 UTC
+	 */
+	int64_t daylight_saving_time_start_time;
+
+	/* The end of daylight saving time as the number of seconds since January 1, 1970 00:00:00 UTC
+	 */
+	int64_t daylight_saving_time_end_time;
+};
+
+typedef struct libcdatetime_timezone_rule libcdatetime_timezone_rule_t;
+
+struct libcdatetime_timezone_rule
+{
+	/* The offset of standard time relative to UTC in seconds
+	 */
+	int32_t standard_utc_offset;
+
+	/* The offset of daylight saving time relative to UTC in seconds
+	 */
+	int32_t daylight_saving_time_utc_offset;
+
+	/* The local time type index of standard time
+	 */
+	uint8_t standard_local_time_type_index;
+
+	/* The local time type index of daylight saving time
+	 */
+	uint8_t daylight_saving_time_local_time_type_index;
+
+	/* Value to indicate the rule has daylight saving time
+	 */
+	uint8_t has_daylight_saving_time;
+
+	/* The date on which daylight saving time starts
+	 */
+	libcdatetime_timezone_rule_date_t start_date;
+
+	/* The date on which daylight saving time ends
+	 */
+	libcdatetime_timezone_rule_date_t end_date;
+
+	/* The abbreviation of standard time, which is only set by a POSIX TZ rule string
+	 */
+	char standard_abbreviation[ LIBCDATETIME_TIMEZONE_RULE_MAXIMUM_ABBREVIATION_SIZE ];
+
+	/* The abbreviation of daylight saving time, which is only set by a POSIX TZ rule string
+	 */
+	char daylight_saving_time_abbreviation[ LIBCDATETIME_TIMEZONE_RULE_MAXIMUM_ABBREVIATION_SIZE ];
+
+	/* The cached years
+	 */
+	libcdatetime_timezone_rule_year_t cached_years[ LIBCDATETIME_TIMEZONE_RULE_NUMBER_OF_CACHED_YEARS ];
+};
+
+int libcdatetime_timezone_rule_initialize(
+     libcdatetime_timezone_rule_t **rule,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_rule_free(
+     libcdatetime_timezone_rule_t **rule,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_rule_date_read_systemtime(
+     libcdatetime_timezone_rule_date_t *date,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_rule_read_string(
+     libcdatetime_timezone_rule_t *rule,
+     const char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_rule_date_get_days_since_epoch(
+     libcdatetime_timezone_rule_date_t *date,
+     uint16_t year,
+     int64_t *number_of_days,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_rule_calculate_year(
+     libcdatetime_timezone_rule_t *rule,
+     uint16_t year,
+     libcdatetime_timezone_rule_year_t *rule_year,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_rule_get_year(
+     libcdatetime_timezone_rule_t *rule,
+     uint16_t year,
+     libcdatetime_timezone_rule_year_t *rule_year,
+     libcerror_error_t **error );
+
+int libcdatetime_timezone_rule_get_local_time_type_index(
+     libcdatetime_timezone_rule_t *rule,
+     int64_t posix_time,
+     uint8_t *local_time_type_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_TIMEZONE_RULE_H ) */
+
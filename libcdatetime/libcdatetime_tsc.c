@@ -0,0 +1,676 @@
+/*
+ * Time stamp counter (TSC) functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_atomic.h"
+#include "libcdatetime_clock.h"
+#include "libcdatetime_definitions.h"
+#include "libcdatetime_libcerror.h"
+#include "libcdatetime_tsc.h"
+
+#if defined( LIBCDATETIME_HAVE_TSC ) && defined( _MSC_VER )
+#include <intrin.h>
+
+#elif defined( LIBCDATETIME_HAVE_TSC )
+#include <cpuid.h>
+#include <x86intrin.h>
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <errno.h>
+#include <time.h>
+
+#endif /* defined( LIBCDATETIME_HAVE_TSC ) && defined( _MSC_VER ) */
+
+/* The time stamp counter calibration used by the LIBCDATETIME_CLOCK_SOURCE_TSC clock source
+ */
+static libcdatetime_tsc_calibration_t libcdatetime_tsc_process_calibration = {
+	LIBCDATETIME_TSC_STATE_NOT_CALIBRATED,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0 };
+
+/* Calculates the fixed-point multiplier and shift to convert cycles into nano seconds
+ * The shift is chosen as large as possible while keeping the multiplier within
+ * 32-bit so that the conversion can be done with 64-bit multiplications
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_tsc_calculate_multiplier(
+     uint64_t number_of_cycles,
+     uint64_t number_of_nano_seconds,
+     uint64_t *multiplier,
+     uint8_t *shift,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcdatetime_tsc_calculate_multiplier";
+	uint64_t multiplier_value = 0;
+	int shift_value           = 0;
+
+	if( number_of_cycles == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of cycles value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_nano_seconds == 0 )
+	 || ( number_of_nano_seconds > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nano seconds value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( multiplier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multiplier.",
+		 function );
+
+		return( -1 );
+	}
+	if( shift == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shift.",
+		 function );
+
+		return( -1 );
+	}
+	for( shift_value = 32;
+	     shift_value >= 0;
+	     shift_value-- )
+	{
+		multiplier_value = ( number_of_nano_seconds << shift_value ) / number_of_cycles;
+
+		if( multiplier_value <= (uint64_t) UINT32_MAX )
+		{
+			break;
+		}
+	}
+	if( ( shift_value < 0 )
+	 || ( multiplier_value == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid multiplier value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*multiplier = multiplier_value;
+	*shift      = (uint8_t) shift_value;
+
+	return( 1 );
+}
+
+/* Converts a number of cycles into nano seconds using a fixed-point multiplier and shift
+ * The number of cycles is split in an upper and lower 32-bit part
+ * so that the multiplications cannot overflow
+ * Returns the number of nano seconds
+ */
+uint64_t libcdatetime_tsc_cycles_to_nano_seconds(
+          uint64_t number_of_cycles,
+          uint64_t multiplier,
+          uint8_t shift )
+{
+	uint64_t lower_cycles = number_of_cycles & 0xffffffffUL;
+	uint64_t upper_cycles = number_of_cycles >> 32;
+
+	return( ( ( upper_cycles * multiplier ) << ( 32 - shift ) ) + ( ( lower_cycles * multiplier ) >> shift ) );
+}
+
+#if defined( LIBCDATETIME_HAVE_TSC )
+
+/* Determines if the processor provides an invariant time stamp counter
+ * An invariant time stamp counter runs at a constant rate regardless of
+ * the power state of the processor
+ * Returns 1 if the time stamp counter is invariant or 0 if not
+ */
+int libcdatetime_tsc_has_invariant_tsc(
+     void )
+{
+#if defined( _MSC_VER )
+	int cpu_information[ 4 ];
+
+	__cpuid(
+	 cpu_information,
+	 (int) 0x80000000UL );
+
+	if( (unsigned int) cpu_information[ 0 ] < 0x80000007UL )
+	{
+		return( 0 );
+	}
+	__cpuid(
+	 cpu_information,
+	 (int) 0x80000007UL );
+
+	return( ( cpu_information[ 3 ] >> 8 ) & 0x00000001UL );
+#else
+	unsigned int eax = 0;
+	unsigned int ebx = 0;
+	unsigned int ecx = 0;
+	unsigned int edx = 0;
+
+	/* __get_cpuid returns 0 if the leaf is not supported
+	 */
+	if( __get_cpuid(
+	     0x80000007UL,
+	     &eax,
+	     &ebx,
+	     &ecx,
+	     &edx ) == 0 )
+	{
+		return( 0 );
+	}
+	return( (int) ( ( edx >> 8 ) & 0x00000001UL ) );
+#endif
+}
+
+/* Retrieves the time of the clock the time stamp counter is calibrated against
+ * On Windows the performance counter is used
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_tsc_get_calibration_time(
+     int64_t *nano_seconds,
+     libcerror_error_t **error )
+{
+#if !defined( _MSC_VER )
+	struct timespec time_specification;
+
+	clockid_t clock_identifier = CLOCK_MONOTONIC;
+#endif
+
+	static char *function      = "libcdatetime_tsc_get_calibration_time";
+
+	if( nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( _MSC_VER )
+	if( libcdatetime_clock_get_monotonic_time(
+	     LIBCDATETIME_CLOCK_SOURCE_MONOTONIC,
+	     nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic time.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	/* The raw monotonic clock is not adjusted by NTP
+	 */
+#if defined( CLOCK_MONOTONIC_RAW )
+	clock_identifier = CLOCK_MONOTONIC_RAW;
+#endif
+	if( clock_gettime(
+	     clock_identifier,
+	     &time_specification ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve monotonic time.",
+		 function );
+
+		return( -1 );
+	}
+	*nano_seconds = ( (int64_t) time_specification.tv_sec * 1000000000LL ) + (int64_t) time_specification.tv_nsec;
+#endif
+	return( 1 );
+}
+
+/* Sets the anchor of the calibration to the current time stamp counter value
+ * and the current time of the real-time clock
+ * Returns 1 if successful, 0 if the anchor is being set by another thread or -1 on error
+ */
+int libcdatetime_tsc_calibration_set_anchor(
+     libcdatetime_tsc_calibration_t *calibration,
+     libcerror_error_t **error )
+{
+	libcdatetime_clock_settings_t clock_settings = {
+		LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+		NULL,
+		NULL };
+
+	static char *function                        = "libcdatetime_tsc_calibration_set_anchor";
+	uint64_t anchor_cycles                       = 0;
+	int64_t anchor_posix_time_in_nano_seconds    = 0;
+	uint32_t sequence_number                     = 0;
+	int result                                   = 1;
+
+	if( calibration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calibration.",
+		 function );
+
+		return( -1 );
+	}
+	sequence_number = libcdatetime_atomic_load_uint32(
+	                   &( calibration->sequence_number ) );
+
+	/* Only a single thread updates the anchor, other threads continue
+	 * to use the current anchor
+	 */
+	if( ( ( sequence_number & 1 ) != 0 )
+	 || ( libcdatetime_atomic_compare_and_swap_uint32(
+	       &( calibration->sequence_number ),
+	       sequence_number,
+	       sequence_number + 1 ) == 0 ) )
+	{
+		return( 0 );
+	}
+	anchor_cycles = (uint64_t) __rdtsc();
+
+	if( libcdatetime_clock_settings_get_current_time(
+	     &clock_settings,
+	     &anchor_posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		calibration->anchor_cycles                     = anchor_cycles;
+		calibration->anchor_posix_time_in_nano_seconds = anchor_posix_time_in_nano_seconds;
+	}
+	libcdatetime_atomic_store_uint32(
+	 &( calibration->sequence_number ),
+	 sequence_number + 2 );
+
+	return( result );
+}
+
+/* Calibrates the time stamp counter against the monotonic clock
+ * The calibration busy waits for LIBCDATETIME_TSC_CALIBRATION_INTERVAL nano seconds
+ * This function is not thread-safe and should be called before the calibration is shared
+ * Returns 1 if successful, 0 if the processor has no invariant time stamp counter or -1 on error
+ */
+int libcdatetime_tsc_calibration_calibrate(
+     libcdatetime_tsc_calibration_t *calibration,
+     libcerror_error_t **error )
+{
+	static char *function        = "libcdatetime_tsc_calibration_calibrate";
+	uint64_t first_cycles        = 0;
+	uint64_t number_of_cycles    = 0;
+	uint64_t second_cycles       = 0;
+	int64_t first_nano_seconds   = 0;
+	int64_t second_nano_seconds  = 0;
+
+	if( calibration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calibration.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdatetime_tsc_has_invariant_tsc() == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_tsc_get_calibration_time(
+	     &first_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first calibration time.",
+		 function );
+
+		return( -1 );
+	}
+	first_cycles = (uint64_t) __rdtsc();
+
+	do
+	{
+		if( libcdatetime_tsc_get_calibration_time(
+		     &second_nano_seconds,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve second calibration time.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( ( second_nano_seconds - first_nano_seconds ) < LIBCDATETIME_TSC_CALIBRATION_INTERVAL );
+
+	second_cycles = (uint64_t) __rdtsc();
+
+	if( second_cycles <= first_cycles )
+	{
+		return( 0 );
+	}
+	number_of_cycles = second_cycles - first_cycles;
+
+	if( libcdatetime_tsc_calculate_multiplier(
+	     number_of_cycles,
+	     (uint64_t) ( second_nano_seconds - first_nano_seconds ),
+	     &( calibration->multiplier ),
+	     &( calibration->shift ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate multiplier.",
+		 function );
+
+		return( -1 );
+	}
+	calibration->anchor_interval_in_cycles = ( (uint64_t) LIBCDATETIME_TSC_ANCHOR_INTERVAL * number_of_cycles ) / (uint64_t) ( second_nano_seconds - first_nano_seconds );
+
+	if( libcdatetime_tsc_calibration_set_anchor(
+	     calibration,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set anchor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current time from a calibrated time stamp counter
+ * The anchor is renewed when it is older than LIBCDATETIME_TSC_ANCHOR_INTERVAL
+ * Returns 1 if successful or -1 on error
+ */
+int libcdatetime_tsc_calibration_get_current_time(
+     libcdatetime_tsc_calibration_t *calibration,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libcdatetime_tsc_calibration_get_current_time";
+	uint64_t anchor_cycles                    = 0;
+	uint64_t current_cycles                   = 0;
+	uint64_t delta_in_cycles                  = 0;
+	uint64_t delta_in_nano_seconds            = 0;
+	int64_t anchor_posix_time_in_nano_seconds = 0;
+	uint32_t sequence_number                  = 0;
+	int result                                = 0;
+
+	if( calibration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calibration.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+	if( calibration->anchor_interval_in_cycles == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid calibration - missing anchor interval.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		/* Read the anchor, retry if it was updated while being read
+		 */
+		do
+		{
+			sequence_number = libcdatetime_atomic_load_uint32(
+			                   &( calibration->sequence_number ) );
+
+			anchor_cycles                     = calibration->anchor_cycles;
+			anchor_posix_time_in_nano_seconds = calibration->anchor_posix_time_in_nano_seconds;
+
+			libcdatetime_atomic_thread_fence();
+		}
+		while( ( ( sequence_number & 1 ) != 0 )
+		    || ( libcdatetime_atomic_load_uint32(
+		          &( calibration->sequence_number ) ) != sequence_number ) );
+
+		current_cycles = (uint64_t) __rdtsc();
+
+		/* The time stamp counter of another processor can lag slightly behind the anchor
+		 */
+		if( current_cycles > anchor_cycles )
+		{
+			delta_in_cycles = current_cycles - anchor_cycles;
+		}
+		else
+		{
+			delta_in_cycles = 0;
+		}
+		result = 0;
+
+		if( delta_in_cycles >= calibration->anchor_interval_in_cycles )
+		{
+			result = libcdatetime_tsc_calibration_set_anchor(
+			          calibration,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set anchor.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( result != 0 );
+
+	delta_in_nano_seconds = libcdatetime_tsc_cycles_to_nano_seconds(
+	                         delta_in_cycles,
+	                         calibration->multiplier,
+	                         calibration->shift );
+
+	if( ( delta_in_nano_seconds > (uint64_t) INT64_MAX )
+	 || ( anchor_posix_time_in_nano_seconds > ( (int64_t) INT64_MAX - (int64_t) delta_in_nano_seconds ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = anchor_posix_time_in_nano_seconds + (int64_t) delta_in_nano_seconds;
+
+	return( 1 );
+}
+
+#endif /* defined( LIBCDATETIME_HAVE_TSC ) */
+
+/* Retrieves the current time from the time stamp counter
+ * The time stamp counter is calibrated by the first call
+ * Returns 1 if successful, 0 if the time stamp counter is not available or -1 on error
+ */
+int libcdatetime_tsc_get_current_time(
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error )
+{
+	static char *function = "libcdatetime_tsc_get_current_time";
+
+#if defined( LIBCDATETIME_HAVE_TSC )
+	uint32_t state        = 0;
+	int result            = 0;
+#endif
+
+	if( posix_time_in_nano_seconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time in nano seconds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCDATETIME_HAVE_TSC )
+	state = libcdatetime_atomic_load_uint32(
+	         &( libcdatetime_tsc_process_calibration.state ) );
+
+	if( state == LIBCDATETIME_TSC_STATE_NOT_CALIBRATED )
+	{
+		/* Only a single thread calibrates, other threads fall back
+		 * to the real-time clock until the calibration has completed
+		 */
+		if( libcdatetime_atomic_compare_and_swap_uint32(
+		     &( libcdatetime_tsc_process_calibration.state ),
+		     LIBCDATETIME_TSC_STATE_NOT_CALIBRATED,
+		     LIBCDATETIME_TSC_STATE_CALIBRATING ) != 0 )
+		{
+			result = libcdatetime_tsc_calibration_calibrate(
+			          &libcdatetime_tsc_process_calibration,
+			          error );
+
+			if( result == 1 )
+			{
+				state = LIBCDATETIME_TSC_STATE_CALIBRATED;
+			}
+			else
+			{
+				state = LIBCDATETIME_TSC_STATE_UNSUPPORTED;
+			}
+			libcdatetime_atomic_store_uint32(
+			 &( libcdatetime_tsc_process_calibration.state ),
+			 state );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to calibrate time stamp counter.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( state != LIBCDATETIME_TSC_STATE_CALIBRATED )
+	{
+		return( 0 );
+	}
+	if( libcdatetime_tsc_calibration_get_current_time(
+	     &libcdatetime_tsc_process_calibration,
+	     posix_time_in_nano_seconds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( LIBCDATETIME_HAVE_TSC ) */
+}
+
@@ -0,0 +1,133 @@
+/*
+ * Time stamp counter (TSC) functions
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCDATETIME_TSC_H )
+#define _LIBCDATETIME_TSC_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcdatetime_atomic.h"
+#include "libcdatetime_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The time stamp counter is only read on x86 processors with compiler
+ * support for the rdtsc and cpuid instructions
+ */
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && !defined( WINAPI ) && defined( HAVE_CLOCK_GETTIME )
+#define LIBCDATETIME_HAVE_TSC	1
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#define LIBCDATETIME_HAVE_TSC	1
+
+#endif
+
+/* The number of nano seconds the time stamp counter is calibrated over
+ */
+#define LIBCDATETIME_TSC_CALIBRATION_INTERVAL	10000000
+
+/* The number of nano seconds after which the time stamp counter is re-anchored to the real-time clock
+ */
+#define LIBCDATETIME_TSC_ANCHOR_INTERVAL	1000000000
+
+typedef struct libcdatetime_tsc_calibration libcdatetime_tsc_calibration_t;
+
+struct libcdatetime_tsc_calibration
+{
+	/* The calibration state
+	 */
+	uint32_t state;
+
+	/* The sequence number of the anchor
+	 * The sequence number is odd while the anchor is being updated
+	 */
+	uint32_t sequence_number;
+
+	/* The time stamp counter value of the anchor
+	 */
+	uint64_t anchor_cycles;
+
+	/* The number of nano seconds since January 1, 1970 00:00:00 UTC of the anchor
+	 */
+	int64_t anchor_posix_time_in_nano_seconds;
+
+	/* The number of time stamp counter cycles after which the anchor is renewed
+	 */
+	uint64_t anchor_interval_in_cycles;
+
+	/* The fixed-point multiplier to convert cycles into nano seconds
+	 */
+	uint64_t multiplier;
+
+	/* The fixed-point shift to convert cycles into nano seconds
+	 */
+	uint8_t shift;
+};
+
+int libcdatetime_tsc_calculate_multiplier(
+     uint64_t number_of_cycles,
+     uint64_t number_of_nano_seconds,
+     uint64_t *multiplier,
+     uint8_t *shift,
+     libcerror_error_t **error );
+
+uint64_t libcdatetime_tsc_cycles_to_nano_seconds(
+          uint64_t number_of_cycles,
+          uint64_t multiplier,
+          uint8_t shift );
+
+#if defined( LIBCDATETIME_HAVE_TSC )
+
+int libcdatetime_tsc_has_invariant_tsc(
+     void );
+
+int libcdatetime_tsc_get_calibration_time(
+     int64_t *nano_seconds,
+     libcerror_error_t **error );
+
+int libcdatetime_tsc_calibration_set_anchor(
+     libcdatetime_tsc_calibration_t *calibration,
+     libcerror_error_t **error );
+
+int libcdatetime_tsc_calibration_calibrate(
+     libcdatetime_tsc_calibration_t *calibration,
+     libcerror_error_t **error );
+
+int libcdatetime_tsc_calibration_get_current_time(
+     libcdatetime_tsc_calibration_t *calibration,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBCDATETIME_HAVE_TSC ) */
+
+int libcdatetime_tsc_get_current_time(
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCDATETIME_TSC_H ) */
+
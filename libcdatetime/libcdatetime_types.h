@@ -35,11 +35,27 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libcdatetime_elements {}		libcdatetime_elements_t;
+typedef struct libcdatetime_format_detector {}	libcdatetime_format_detector_t;
+typedef struct libcdatetime_identifier_generator {}	libcdatetime_identifier_generator_t;
+typedef struct libcdatetime_monotonic_timestamp {}	libcdatetime_monotonic_timestamp_t;
+typedef struct libcdatetime_stream_parser {}	libcdatetime_stream_parser_t;
+typedef struct libcdatetime_ticker {}		libcdatetime_ticker_t;
 typedef struct libcdatetime_timestamp {}	libcdatetime_timestamp_t;
+typedef struct libcdatetime_timestamp_generator {}	libcdatetime_timestamp_generator_t;
+typedef struct libcdatetime_timezone {}		libcdatetime_timezone_t;
+typedef struct libcdatetime_timezone_database {}	libcdatetime_timezone_database_t;
 
 #else
 typedef intptr_t libcdatetime_elements_t;
+typedef intptr_t libcdatetime_format_detector_t;
+typedef intptr_t libcdatetime_identifier_generator_t;
+typedef intptr_t libcdatetime_monotonic_timestamp_t;
+typedef intptr_t libcdatetime_stream_parser_t;
+typedef intptr_t libcdatetime_ticker_t;
 typedef intptr_t libcdatetime_timestamp_t;
+typedef intptr_t libcdatetime_timestamp_generator_t;
+typedef intptr_t libcdatetime_timezone_t;
+typedef intptr_t libcdatetime_timezone_database_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
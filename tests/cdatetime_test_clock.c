@@ -0,0 +1,631 @@
+/*
+ * Library clock functions test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_clock.h"
+
+/* Clock that returns the time stored in the callback data for testing
+ * Returns 1 if successful or -1 on error
+ */
+int cdatetime_test_fixed_clock(
+     intptr_t *callback_data,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( callback_data == NULL )
+	 || ( posix_time_in_nano_seconds == NULL ) )
+	{
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = *( (int64_t *) callback_data );
+
+	return( 1 );
+}
+
+/* Tests the libcdatetime_set_clock_source function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_set_clock_source(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_set_clock_source(
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_set_clock_source(
+	          LIBCDATETIME_CLOCK_SOURCE_DEFAULT,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_set_clock_source(
+	          LIBCDATETIME_CLOCK_SOURCE_CALLBACK,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_set_clock_source(
+	          LIBCDATETIME_CLOCK_SOURCE_MONOTONIC,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_set_clock_source(
+	          99,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_set_clock_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_set_clock_callback(
+     void )
+{
+	libcdatetime_timestamp_t *first_timestamp  = NULL;
+	libcdatetime_timestamp_t *second_timestamp = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t fixed_time                         = 0;
+	int64_t number_of_nano_seconds             = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_set_clock_callback(
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Timestamps that use the default clock source use the clock of the process
+	 */
+	fixed_time = 86400000000000LL;
+
+	result = libcdatetime_timestamp_set_current_time(
+	          first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixed_time = 0;
+
+	result = libcdatetime_timestamp_set_current_time(
+	          second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 86400000000000LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_set_clock_source(
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_set_clock_callback(
+	          NULL,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &second_timestamp,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	result = libcdatetime_timestamp_free(
+	          &first_timestamp,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &second_timestamp,
+		 NULL );
+	}
+	if( first_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &first_timestamp,
+		 NULL );
+	}
+	libcdatetime_set_clock_source(
+	 LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* Tests the libcdatetime_clock_settings_get_current_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_clock_settings_get_current_time(
+     void )
+{
+	libcdatetime_clock_settings_t clock_settings;
+
+	libcerror_error_t *error           = NULL;
+	int64_t fixed_time                 = -1LL;
+	int64_t posix_time_in_nano_seconds = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	clock_settings.clock_source      = LIBCDATETIME_CLOCK_SOURCE_DEFAULT;
+	clock_settings.callback_function = NULL;
+	clock_settings.callback_data     = NULL;
+
+	result = libcdatetime_clock_settings_get_current_time(
+	          &clock_settings,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_clock_settings_set_clock_source(
+	          &clock_settings,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_clock_settings_get_current_time(
+	          &clock_settings,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The TAI clock source is not supported on every platform
+	 */
+	result = libcdatetime_clock_settings_set_clock_source(
+	          &clock_settings,
+	          LIBCDATETIME_CLOCK_SOURCE_TAI,
+	          NULL );
+
+	if( result == 1 )
+	{
+		result = libcdatetime_clock_settings_get_current_time(
+		          &clock_settings,
+		          &posix_time_in_nano_seconds,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The TSC clock source falls back to the real-time clock if no invariant TSC is available
+	 */
+	result = libcdatetime_clock_settings_set_clock_source(
+	          &clock_settings,
+	          LIBCDATETIME_CLOCK_SOURCE_TSC,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_clock_settings_get_current_time(
+	          &clock_settings,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_clock_settings_set_clock_callback(
+	          &clock_settings,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_clock_settings_get_current_time(
+	          &clock_settings,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 (int64_t) -1LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_clock_settings_get_current_time(
+	          NULL,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_clock_settings_get_current_time(
+	          &clock_settings,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	clock_settings.callback_function = NULL;
+
+	result = libcdatetime_clock_settings_get_current_time(
+	          &clock_settings,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	clock_settings.clock_source = 99;
+
+	result = libcdatetime_clock_settings_get_current_time(
+	          &clock_settings,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_set_clock_source",
+	 cdatetime_test_set_clock_source );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_set_clock_callback",
+	 cdatetime_test_set_clock_callback );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_clock_settings_get_current_time",
+	 cdatetime_test_clock_settings_get_current_time );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -49,14 +49,13 @@
 #include "cdatetime_test_unused.h"
 
 #include "../libcdatetime/libcdatetime_elements.h"
+#include "../libcdatetime/libcdatetime_timestamp.h"
 
 #if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
 
 static struct tm *(*cdatetime_test_real_gmtime_r)(const time_t *, struct tm *) = NULL;
-static time_t (*cdatetime_test_real_time)(time_t *)                            = NULL;
 
 int cdatetime_test_gmtime_r_attempts_before_fail                               = -1;
-int cdatetime_test_time_attempts_before_fail                                   = -1;
 
 /* Custom time for testing error cases
  * Returns a pointer to newly allocated data or NULL
@@ -90,37 +89,50 @@ struct tm *gmtime_r(
 	return( result_tm );
 }
 
-/* Custom time for testing error cases
- * Returns a pointer to newly allocated data or NULL
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
+
+/* Clock that returns the time stored in the callback data for testing
+ * Returns 1 if successful or -1 on error
  */
-time_t time(
-     time_t *tloc )
+int cdatetime_test_fixed_clock(
+     intptr_t *callback_data,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
 {
-	time_t result_time = 0;
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
 
-	if( cdatetime_test_real_time == NULL )
+	if( ( callback_data == NULL )
+	 || ( posix_time_in_nano_seconds == NULL ) )
 	{
-		cdatetime_test_real_time = dlsym(
-		                            RTLD_NEXT,
-		                            "time" );
-	}
-	if( cdatetime_test_time_attempts_before_fail == 0 )
-	{
-		cdatetime_test_time_attempts_before_fail = -1;
-
 		return( -1 );
 	}
-	else if( cdatetime_test_time_attempts_before_fail > 0 )
-	{
-		cdatetime_test_time_attempts_before_fail--;
-	}
-	result_time = cdatetime_test_real_time(
-	               tloc );
+	*posix_time_in_nano_seconds = *( (int64_t *) callback_data );
 
-	return( result_time );
+	return( 1 );
 }
 
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
+/* Clock that fails for testing error cases
+ * Returns -1
+ */
+int cdatetime_test_failing_clock(
+     intptr_t *callback_data CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     int64_t *posix_time_in_nano_seconds CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( callback_data )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( posix_time_in_nano_seconds )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+/* TZif version 1 data with a single local time type: IST (UTC+5:30)
+ */
+uint8_t cdatetime_test_elements_timezone_data1[ 54 ] = {
+	0x54, 0x5a, 0x69, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x4d, 0x58,
+	0x00, 0x00, 0x49, 0x53, 0x54, 0x00 };
 
 /* Tests the libcdatetime_elements_initialize function
  * Returns 1 if successful or 0 if not
@@ -3176,17 +3188,16 @@ on_error:
 
 #endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
 
-#if !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) )
+#if !defined( WINAPI )
 
-/* Tests the libcdatetime_internal_elements_set_from_time_utc function
+/* Tests the libcdatetime_internal_elements_set_tm_from_number_of_seconds function
  * Returns 1 if successful or 0 if not
  */
-int cdatetime_test_internal_elements_set_from_time_utc(
+int cdatetime_test_internal_elements_set_tm_from_number_of_seconds(
      void )
 {
 	libcdatetime_elements_t *elements = NULL;
 	libcerror_error_t *error          = NULL;
-	time_t time_value                 = 0;
 	int result                        = 0;
 
 	/* Initialize test
@@ -3208,11 +3219,11 @@ int cdatetime_test_internal_elements_set_from_time_utc(
 	 "error",
 	 error );
 
-	/* Test set current time in UTC
+	/* Test regular cases
 	 */
-	result = libcdatetime_internal_elements_set_from_time_utc(
+	result = libcdatetime_internal_elements_set_tm_from_number_of_seconds(
 	          (libcdatetime_internal_elements_t *) elements,
-	          &time_value,
+	          (int64_t) 1645557742,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3224,28 +3235,159 @@ int cdatetime_test_internal_elements_set_from_time_utc(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdatetime_internal_elements_set_from_time_utc(
-	          NULL,
-	          &time_value,
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_year",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_year,
+	 122 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_mon",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_mon,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_mday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_mday,
+	 22 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_hour",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_hour,
+	 19 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_min",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_min,
+	 22 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_sec",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_sec,
+	 22 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_wday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_wday,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_yday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_yday,
+	 52 );
+
+	result = libcdatetime_internal_elements_set_tm_from_number_of_seconds(
+	          (libcdatetime_internal_elements_t *) elements,
+	          (int64_t) -1,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_year",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_year,
+	 69 );
 
-	result = libcdatetime_internal_elements_set_from_time_utc(
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_mon",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_mon,
+	 11 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_mday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_mday,
+	 31 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_hour",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_hour,
+	 23 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_min",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_min,
+	 59 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_sec",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_sec,
+	 59 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_wday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_wday,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_yday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_yday,
+	 364 );
+
+	result = libcdatetime_internal_elements_set_tm_from_number_of_seconds(
 	          (libcdatetime_internal_elements_t *) elements,
+	          (int64_t) 951782400,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_year",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_year,
+	 100 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_mon",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_mon,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_mday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_mday,
+	 29 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_hour",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_hour,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_min",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_min,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_sec",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_sec,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_wday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_wday,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "tm.tm_yday",
+	 ( (libcdatetime_internal_elements_t *) elements )->tm.tm_yday,
+	 59 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_internal_elements_set_tm_from_number_of_seconds(
 	          NULL,
+	          (int64_t) 0,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3260,37 +3402,22 @@ int cdatetime_test_internal_elements_set_from_time_utc(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
-
-	/* Test libcdatetime_internal_elements_set_from_time_utc with gmtime_r failing
-	 */
-	cdatetime_test_gmtime_r_attempts_before_fail = 0;
-
-	result = libcdatetime_internal_elements_set_from_time_utc(
+	result = libcdatetime_internal_elements_set_tm_from_number_of_seconds(
 	          (libcdatetime_internal_elements_t *) elements,
-	          &time_value,
+	          (int64_t) INT64_MAX,
 	          &error );
 
-	if( cdatetime_test_gmtime_r_attempts_before_fail != -1 )
-	{
-		cdatetime_test_gmtime_r_attempts_before_fail = -1;
-	}
-	else
-	{
-		CDATETIME_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
@@ -3328,14 +3455,14 @@ on_error:
 	return( 0 );
 }
 
-#endif /* !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) ) */
+#endif /* !defined( WINAPI ) */
 
-#if !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) )
+#if !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) )
 
-/* Tests the libcdatetime_internal_elements_set_from_time_localtime function
+/* Tests the libcdatetime_internal_elements_set_from_time_utc function
  * Returns 1 if successful or 0 if not
  */
-int cdatetime_test_internal_elements_set_from_time_localtime(
+int cdatetime_test_internal_elements_set_from_time_utc(
      void )
 {
 	libcdatetime_elements_t *elements = NULL;
@@ -3364,7 +3491,7 @@ int cdatetime_test_internal_elements_set_from_time_localtime(
 
 	/* Test set current time in UTC
 	 */
-	result = libcdatetime_internal_elements_set_from_time_localtime(
+	result = libcdatetime_internal_elements_set_from_time_utc(
 	          (libcdatetime_internal_elements_t *) elements,
 	          &time_value,
 	          &error );
@@ -3380,7 +3507,7 @@ int cdatetime_test_internal_elements_set_from_time_localtime(
 
 	/* Test error cases
 	 */
-	result = libcdatetime_internal_elements_set_from_time_localtime(
+	result = libcdatetime_internal_elements_set_from_time_utc(
 	          NULL,
 	          &time_value,
 	          &error );
@@ -3397,7 +3524,7 @@ int cdatetime_test_internal_elements_set_from_time_localtime(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdatetime_internal_elements_set_from_time_localtime(
+	result = libcdatetime_internal_elements_set_from_time_utc(
 	          (libcdatetime_internal_elements_t *) elements,
 	          NULL,
 	          &error );
@@ -3414,6 +3541,38 @@ int cdatetime_test_internal_elements_set_from_time_localtime(
 	libcerror_error_free(
 	 &error );
 
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
+
+	/* Test libcdatetime_internal_elements_set_from_time_utc with gmtime_r failing
+	 */
+	cdatetime_test_gmtime_r_attempts_before_fail = 0;
+
+	result = libcdatetime_internal_elements_set_from_time_utc(
+	          (libcdatetime_internal_elements_t *) elements,
+	          &time_value,
+	          &error );
+
+	if( cdatetime_test_gmtime_r_attempts_before_fail != -1 )
+	{
+		cdatetime_test_gmtime_r_attempts_before_fail = -1;
+	}
+	else
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
+
 	/* Clean up
 	 */
 	result = libcdatetime_elements_free(
@@ -3450,18 +3609,19 @@ on_error:
 	return( 0 );
 }
 
-#endif /* !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) ) */
+#endif /* !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) ) */
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+#if !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) )
 
-/* Tests the libcdatetime_elements_set_current_time_utc function
+/* Tests the libcdatetime_internal_elements_set_from_time_localtime function
  * Returns 1 if successful or 0 if not
  */
-int cdatetime_test_elements_set_current_time_utc(
+int cdatetime_test_internal_elements_set_from_time_localtime(
      void )
 {
 	libcdatetime_elements_t *elements = NULL;
 	libcerror_error_t *error          = NULL;
+	time_t time_value                 = 0;
 	int result                        = 0;
 
 	/* Initialize test
@@ -3485,8 +3645,9 @@ int cdatetime_test_elements_set_current_time_utc(
 
 	/* Test set current time in UTC
 	 */
-	result = libcdatetime_elements_set_current_time_utc(
-	          elements,
+	result = libcdatetime_internal_elements_set_from_time_localtime(
+	          (libcdatetime_internal_elements_t *) elements,
+	          &time_value,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3500,8 +3661,9 @@ int cdatetime_test_elements_set_current_time_utc(
 
 	/* Test error cases
 	 */
-	result = libcdatetime_elements_set_current_time_utc(
+	result = libcdatetime_internal_elements_set_from_time_localtime(
 	          NULL,
+	          &time_value,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3516,36 +3678,22 @@ int cdatetime_test_elements_set_current_time_utc(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
-
-	/* Test libcdatetime_elements_set_current_time_utc with time failing
-	 */
-	cdatetime_test_time_attempts_before_fail = 0;
-
-	result = libcdatetime_elements_set_current_time_utc(
-	          elements,
+	result = libcdatetime_internal_elements_set_from_time_localtime(
+	          (libcdatetime_internal_elements_t *) elements,
+	          NULL,
 	          &error );
 
-	if( cdatetime_test_time_attempts_before_fail != -1 )
-	{
-		cdatetime_test_time_attempts_before_fail = -1;
-	}
-	else
-	{
-		CDATETIME_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
@@ -3583,10 +3731,14 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcdatetime_elements_set_current_time_localtime function
+#endif /* !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_LOCALTIME ) || defined( HAVE_LOCALTIME_R ) ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* Tests the libcdatetime_elements_set_clock_source function
  * Returns 1 if successful or 0 if not
  */
-int cdatetime_test_elements_set_current_time_localtime(
+int cdatetime_test_elements_set_clock_source(
      void )
 {
 	libcdatetime_elements_t *elements = NULL;
@@ -3612,10 +3764,11 @@ int cdatetime_test_elements_set_current_time_localtime(
 	 "error",
 	 error );
 
-	/* Test set current time in localtime
+	/* Test regular cases
 	 */
-	result = libcdatetime_elements_set_current_time_localtime(
+	result = libcdatetime_elements_set_clock_source(
 	          elements,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3627,16 +3780,45 @@ int cdatetime_test_elements_set_current_time_localtime(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcdatetime_elements_set_current_time_localtime(
-	          NULL,
+	result = libcdatetime_elements_set_clock_source(
+	          elements,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_clock_source(
+	          elements,
+	          LIBCDATETIME_CLOCK_SOURCE_DEFAULT,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_set_clock_source(
+	          NULL,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -3645,42 +3827,166 @@ int cdatetime_test_elements_set_current_time_localtime(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
+	result = libcdatetime_elements_set_clock_source(
+	          elements,
+	          LIBCDATETIME_CLOCK_SOURCE_CALLBACK,
+	          &error );
 
-	/* Test libcdatetime_elements_set_current_time_localtime with time failing
-	 */
-	cdatetime_test_time_attempts_before_fail = 0;
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	result = libcdatetime_elements_set_current_time_localtime(
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_set_clock_source(
 	          elements,
+	          99,
 	          &error );
 
-	if( cdatetime_test_time_attempts_before_fail != -1 )
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
-		cdatetime_test_time_attempts_before_fail = -1;
+		libcerror_error_free(
+		 &error );
 	}
-	else
+	if( elements != NULL )
 	{
-		CDATETIME_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
 
-		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+/* Tests the libcdatetime_elements_set_clock_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_set_clock_callback(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t fixed_time                = 0;
+	int result                        = 0;
 
-		libcerror_error_free(
-		 &error );
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
 
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_set_clock_callback(
+	          NULL,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          NULL,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
 	result = libcdatetime_elements_free(
 	          &elements,
-	          &error );
+	          NULL );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -3712,22 +4018,3263 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcdatetime_elements_get_delta_in_seconds function
+/* Tests the libcdatetime_elements_set_current_time_utc function
  * Returns 1 if successful or 0 if not
  */
-int cdatetime_test_elements_get_delta_in_seconds(
+int cdatetime_test_elements_set_current_time_utc(
      void )
 {
-	libcdatetime_elements_t *first_elements  = NULL;
-	libcdatetime_elements_t *second_elements = NULL;
-	libcerror_error_t *error                 = NULL;
-	int64_t number_of_seconds                = 0;
-	int result                               = 0;
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t fixed_time                = 1234567891LL;
+	uint16_t milli_seconds            = 0;
+	uint16_t micro_seconds            = 0;
+	uint16_t nano_seconds             = 0;
+	uint8_t seconds                   = 0;
+	int result                        = 0;
 
 	/* Initialize test
 	 */
 	result = libcdatetime_elements_initialize(
-	          &first_elements,
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set current time in UTC
+	 */
+	result = libcdatetime_elements_set_current_time_utc(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set current time in UTC with a fixed clock
+	 */
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_current_time_utc(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_seconds(
+	          elements,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_milli_seconds(
+	          elements,
+	          &milli_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "milli_seconds",
+	 milli_seconds,
+	 234 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( WINAPI )
+	result = libcdatetime_elements_get_micro_seconds(
+	          elements,
+	          &micro_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "micro_seconds",
+	 micro_seconds,
+	 567 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_nano_seconds(
+	          elements,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "nano_seconds",
+	 nano_seconds,
+	 891 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_set_current_time_utc(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcdatetime_elements_set_current_time_utc with the clock failing
+	 */
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_failing_clock,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_current_time_utc(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_set_current_time_localtime function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_set_current_time_localtime(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set current time in localtime
+	 */
+	result = libcdatetime_elements_set_current_time_localtime(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_set_current_time_localtime(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcdatetime_elements_set_current_time_localtime with the clock failing
+	 */
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_failing_clock,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_current_time_localtime(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_set_current_time_in_timezone function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_set_current_time_in_timezone(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t fixed_time                = 1645557742123000000LL;
+	int result                        = 0;
+	uint8_t day_of_month              = 0;
+	uint8_t hours                     = 0;
+	uint8_t minutes                   = 0;
+	uint8_t seconds                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_elements_timezone_data1,
+	          54,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set current time in timezone
+	 */
+	result = libcdatetime_elements_set_current_time_in_timezone(
+	          elements,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 52 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_day_of_month(
+	          elements,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 23 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_set_current_time_in_timezone(
+	          NULL,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_set_current_time_in_timezone(
+	          elements,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_convert_to_timezone function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_convert_to_timezone(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t fixed_time                = 1645557742123000000LL;
+	int result                        = 0;
+	uint8_t day_of_month              = 0;
+	uint8_t hours                     = 0;
+	uint8_t minutes                   = 0;
+	uint8_t seconds                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_elements_timezone_data1,
+	          54,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_current_time_utc(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_convert_to_timezone(
+	          elements,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 52 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_day_of_month(
+	          elements,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 23 );
+
+	/* Test that converting again does not change the date and time
+	 */
+	result = libcdatetime_elements_convert_to_timezone(
+	          elements,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 52 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_day_of_month(
+	          elements,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 23 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_convert_to_timezone(
+	          NULL,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_convert_to_timezone(
+	          elements,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_set_from_delta_in_seconds(
+	          elements,
+	          (int64_t) 3600,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_convert_to_timezone(
+	          elements,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_set_current_time_with_utc_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_set_current_time_with_utc_offset(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t fixed_time                = 1645557742123000000LL;
+	int result                        = 0;
+	int16_t utc_offset                = 0;
+	uint8_t day_of_month              = 0;
+	uint8_t hours                     = 0;
+	uint8_t minutes                   = 0;
+	uint8_t seconds                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_set_current_time_with_utc_offset(
+	          elements,
+	          330,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 52 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_day_of_month(
+	          elements,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 23 );
+
+	result = libcdatetime_elements_get_utc_offset(
+	          elements,
+	          &utc_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT16(
+	 "utc_offset",
+	 utc_offset,
+	 330 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_set_current_time_with_utc_offset(
+	          NULL,
+	          330,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_set_current_time_with_utc_offset(
+	          elements,
+	          1440,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_set_current_time_with_utc_offset(
+	          elements,
+	          -1440,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_convert_to_utc_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_convert_to_utc_offset(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t fixed_time                = 1645557742123000000LL;
+	int result                        = 0;
+	uint8_t day_of_month              = 0;
+	uint8_t hours                     = 0;
+	uint8_t minutes                   = 0;
+	uint8_t seconds                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_current_time_utc(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_convert_to_utc_offset(
+	          elements,
+	          -600,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 9 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 22 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_day_of_month(
+	          elements,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 22 );
+
+	/* Test conversion from one UTC offset to another
+	 */
+	result = libcdatetime_elements_convert_to_utc_offset(
+	          elements,
+	          330,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 52 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_day_of_month(
+	          elements,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 23 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_convert_to_utc_offset(
+	          NULL,
+	          330,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_convert_to_utc_offset(
+	          elements,
+	          1440,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_set_from_delta_in_seconds(
+	          elements,
+	          (int64_t) 3600,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_convert_to_utc_offset(
+	          elements,
+	          330,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_get_utc_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_get_utc_offset(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t fixed_time                = 1645557742123000000LL;
+	int result                        = 0;
+	int16_t utc_offset                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_elements_timezone_data1,
+	          54,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_set_current_time_utc(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_utc_offset(
+	          elements,
+	          &utc_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT16(
+	 "utc_offset",
+	 utc_offset,
+	 0 );
+
+	result = libcdatetime_elements_set_current_time_with_utc_offset(
+	          elements,
+	          -600,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_utc_offset(
+	          elements,
+	          &utc_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT16(
+	 "utc_offset",
+	 utc_offset,
+	 -600 );
+
+	result = libcdatetime_elements_set_current_time_in_timezone(
+	          elements,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_utc_offset(
+	          elements,
+	          &utc_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT16(
+	 "utc_offset",
+	 utc_offset,
+	 330 );
+
+	/* Test that a duration has no UTC offset
+	 */
+	result = libcdatetime_elements_set_from_delta_in_seconds(
+	          elements,
+	          (int64_t) 3600,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_utc_offset(
+	          elements,
+	          &utc_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_get_utc_offset(
+	          NULL,
+	          &utc_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_get_utc_offset(
+	          elements,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_get_delta_in_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_get_delta_in_seconds(
+     void )
+{
+	libcdatetime_elements_t *first_elements  = NULL;
+	libcdatetime_elements_t *second_elements = NULL;
+	libcerror_error_t *error                 = NULL;
+	int64_t number_of_seconds                = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &first_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_elements",
+	 first_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_initialize(
+	          &second_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_elements",
+	 second_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_get_delta_in_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	/* Test that the fraction of a second is truncated when the nano seconds
+	 * cross a second boundary
+	 */
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) first_elements,
+	          (int64_t) 2100000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) second_elements,
+	          (int64_t) 1900000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_delta_in_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 0 );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) first_elements,
+	          (int64_t) 1900000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) second_elements,
+	          (int64_t) 2100000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_delta_in_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 0 );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) first_elements,
+	          (int64_t) 3100000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) second_elements,
+	          (int64_t) 1900000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_delta_in_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 1 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_get_delta_in_seconds(
+	          NULL,
+	          second_elements,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_get_delta_in_seconds(
+	          first_elements,
+	          NULL,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_get_delta_in_seconds(
+	          first_elements,
+	          second_elements,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &second_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_elements",
+	 second_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &first_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_elements",
+	 first_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &second_elements,
+		 NULL );
+	}
+	if( first_elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &first_elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_get_delta_in_seconds_and_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_get_delta_in_seconds_and_nano_seconds(
+     void )
+{
+	libcdatetime_elements_t *first_elements  = NULL;
+	libcdatetime_elements_t *second_elements = NULL;
+	libcerror_error_t *error                 = NULL;
+	int64_t number_of_seconds                = 0;
+	int32_t nano_seconds                     = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &first_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_elements",
+	 first_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_initialize(
+	          &second_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_elements",
+	 second_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	/* Test that the fraction of a second has the same sign as the seconds
+	 */
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) first_elements,
+	          (int64_t) 1250000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) second_elements,
+	          (int64_t) 3500000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) -2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "nano_seconds",
+	 nano_seconds,
+	 -250000000 );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) first_elements,
+	          (int64_t) 3250000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) second_elements,
+	          (int64_t) 1500000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "nano_seconds",
+	 nano_seconds,
+	 750000000 );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) first_elements,
+	          (int64_t) 1500000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) second_elements,
+	          (int64_t) 1500000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "nano_seconds",
+	 nano_seconds,
+	 0 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	          NULL,
+	          second_elements,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	          first_elements,
+	          NULL,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          NULL,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_get_delta_in_seconds_and_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_seconds,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &second_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_elements",
+	 second_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &first_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_elements",
+	 first_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &second_elements,
+		 NULL );
+	}
+	if( first_elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &first_elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_get_delta_in_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_get_delta_in_nano_seconds(
+     void )
+{
+	libcdatetime_elements_t *first_elements  = NULL;
+	libcdatetime_elements_t *second_elements = NULL;
+	libcerror_error_t *error                 = NULL;
+	int64_t number_of_nano_seconds           = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &first_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_elements",
+	 first_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_initialize(
+	          &second_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_elements",
+	 second_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_get_delta_in_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) first_elements,
+	          (int64_t) 1250000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) second_elements,
+	          (int64_t) 3500000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_delta_in_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) -2250000000LL );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) first_elements,
+	          (int64_t) 3250000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_elements_set_from_posix_time_in_nano_seconds_utc(
+	          (libcdatetime_internal_elements_t *) second_elements,
+	          (int64_t) 1500000000LL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_delta_in_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 1750000000LL );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_get_delta_in_nano_seconds(
+	          NULL,
+	          second_elements,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_get_delta_in_nano_seconds(
+	          first_elements,
+	          NULL,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_get_delta_in_nano_seconds(
+	          first_elements,
+	          second_elements,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &second_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_elements",
+	 second_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &first_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_elements",
+	 first_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &second_elements,
+		 NULL );
+	}
+	if( first_elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &first_elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_set_from_delta_in_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_set_from_delta_in_seconds(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_set_from_delta_in_seconds(
+	          elements,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_set_from_delta_in_seconds(
+	          NULL,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_copy_to_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_copy_to_timestamp(
+     void )
+{
+	libcdatetime_elements_t *elements   = NULL;
+	libcdatetime_timestamp_t *timestamp = NULL;
+	libcerror_error_t *error            = NULL;
+	int64_t fixed_time                  = 1645557742123000000LL;
+	int64_t posix_time_in_nano_seconds  = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_set_clock_callback(
+	          elements,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_set_current_time_utc(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	result = libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	          (libcdatetime_internal_timestamp_t *) timestamp,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 fixed_time );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	result = libcdatetime_elements_set_current_time_localtime(
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	result = libcdatetime_internal_timestamp_get_posix_time_in_nano_seconds(
+	          (libcdatetime_internal_timestamp_t *) timestamp,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 fixed_time );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_elements_copy_to_timestamp(
+	          NULL,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test copy to timestamp with elements that contain a duration
+	 */
+	result = libcdatetime_elements_set_from_delta_in_seconds(
+	          elements,
+	          60,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_elements_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_elements_copy_from_utf8_string(
+     void )
+{
+	uint8_t string[ 32 ];
+
+	libcdatetime_elements_t *elements          = NULL;
+	libcdatetime_timestamp_t *copied_timestamp = NULL;
+	libcdatetime_timestamp_t *timestamp        = NULL;
+	libcerror_error_t *error                   = NULL;
+	size_t string_size                         = 0;
+	int64_t fixed_time                         = 1645557742123000000LL;
+	int64_t number_of_nano_seconds             = 0;
+	int result                                 = 0;
+	int16_t utc_offset                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &copied_timestamp,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3736,15 +7283,20 @@ int cdatetime_test_elements_get_delta_in_seconds(
 	 1 );
 
 	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "first_elements",
-	 first_elements );
+	 "copied_timestamp",
+	 copied_timestamp );
 
 	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdatetime_elements_initialize(
-	          &second_elements,
+	/* Test regular cases
+	 */
+	result = libcdatetime_elements_copy_from_utf8_string(
+	          elements,
+	          (uint8_t *) "2022-02-23T00:52:22.123+05:30",
+	          30,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3752,20 +7304,13 @@ int cdatetime_test_elements_get_delta_in_seconds(
 	 result,
 	 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "second_elements",
-	 second_elements );
-
 	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcdatetime_elements_get_delta_in_seconds(
-	          first_elements,
-	          second_elements,
-	          &number_of_seconds,
+	result = libcdatetime_elements_get_utc_offset(
+	          elements,
+	          &utc_offset,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3777,66 +7322,90 @@ int cdatetime_test_elements_get_delta_in_seconds(
 	 "error",
 	 error );
 
-	/* Test error cases
+	CDATETIME_TEST_ASSERT_EQUAL_INT16(
+	 "utc_offset",
+	 utc_offset,
+	 330 );
+
+	/* Test that the UTC offset is retained when formatted
 	 */
-	result = libcdatetime_elements_get_delta_in_seconds(
-	          NULL,
-	          second_elements,
-	          &number_of_seconds,
+	result = libcdatetime_elements_get_string_size(
+	          elements,
+	          &string_size,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 30 );
 
-	result = libcdatetime_elements_get_delta_in_seconds(
-	          first_elements,
-	          NULL,
-	          &number_of_seconds,
+	result = libcdatetime_elements_copy_to_string(
+	          elements,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          string,
+	          "2022-02-23T00:52:22.123+05:30",
+	          30 );
 
-	result = libcdatetime_elements_get_delta_in_seconds(
-	          first_elements,
-	          second_elements,
-	          NULL,
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdatetime_elements_copy_to_string(
+	          elements,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          string,
+	          "Feb 23, 2022 00:52:22 UTC+05:30",
+	          32 );
 
-	/* Clean up
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the date and time with the UTC offset represents the same timestamp
 	 */
-	result = libcdatetime_elements_free(
-	          &second_elements,
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          copied_timestamp,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3844,16 +7413,14 @@ int cdatetime_test_elements_get_delta_in_seconds(
 	 result,
 	 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NULL(
-	 "second_elements",
-	 second_elements );
-
 	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdatetime_elements_free(
-	          &first_elements,
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          copied_timestamp,
+	          &number_of_nano_seconds,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3861,51 +7428,22 @@ int cdatetime_test_elements_get_delta_in_seconds(
 	 result,
 	 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NULL(
-	 "first_elements",
-	 first_elements );
-
 	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( second_elements != NULL )
-	{
-		libcdatetime_elements_free(
-		 &second_elements,
-		 NULL );
-	}
-	if( first_elements != NULL )
-	{
-		libcdatetime_elements_free(
-		 &first_elements,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libcdatetime_elements_set_from_delta_in_seconds function
- * Returns 1 if successful or 0 if not
- */
-int cdatetime_test_elements_set_from_delta_in_seconds(
-     void )
-{
-	libcdatetime_elements_t *elements = NULL;
-	libcerror_error_t *error          = NULL;
-	int result                        = 0;
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 0 );
 
-	/* Initialize test
+	/* Test that a string in UTC is set in UTC
 	 */
-	result = libcdatetime_elements_initialize(
-	          &elements,
+	result = libcdatetime_elements_copy_from_utf8_string(
+	          elements,
+	          (uint8_t *) "2022-02-22T19:22:22.123Z",
+	          25,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3913,19 +7451,34 @@ int cdatetime_test_elements_set_from_delta_in_seconds(
 	 result,
 	 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "elements",
-	 elements );
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_utc_offset(
+	          elements,
+	          &utc_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcdatetime_elements_set_from_delta_in_seconds(
+	CDATETIME_TEST_ASSERT_EQUAL_INT16(
+	 "utc_offset",
+	 utc_offset,
+	 0 );
+
+	result = libcdatetime_elements_copy_to_string(
 	          elements,
-	          1,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3937,11 +7490,61 @@ int cdatetime_test_elements_set_from_delta_in_seconds(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          string,
+	          "2022-02-22T19:22:22.123Z",
+	          25 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libcdatetime_elements_set_from_delta_in_seconds(
+	result = libcdatetime_elements_copy_from_utf8_string(
 	          NULL,
-	          1,
+	          (uint8_t *) "2022-02-22T19:22:22.123Z",
+	          25,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_copy_from_utf8_string(
+	          elements,
+	          NULL,
+	          25,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_elements_copy_from_utf8_string(
+	          elements,
+	          (uint8_t *) "2022-02-22T19:22",
+	          17,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -3958,6 +7561,40 @@ int cdatetime_test_elements_set_from_delta_in_seconds(
 
 	/* Clean up
 	 */
+	result = libcdatetime_timestamp_free(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libcdatetime_elements_free(
 	          &elements,
 	          &error );
@@ -3983,6 +7620,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( copied_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &copied_timestamp,
+		 NULL );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
 	if( elements != NULL )
 	{
 		libcdatetime_elements_free(
@@ -5134,6 +8783,14 @@ int main(
 
 #endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
 
+#if !defined( WINAPI )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_internal_elements_set_tm_from_number_of_seconds",
+	 cdatetime_test_internal_elements_set_tm_from_number_of_seconds );
+
+#endif /* !defined( WINAPI ) */
+
 #if !defined( WINAPI ) && defined( HAVE_TIME ) && ( defined( HAVE_GMTIME ) || defined( HAVE_GMTIME_R ) )
 
 	CDATETIME_TEST_RUN(
@@ -5152,6 +8809,14 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
 
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_set_clock_source",
+	 cdatetime_test_elements_set_clock_source );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_set_clock_callback",
+	 cdatetime_test_elements_set_clock_callback );
+
 	CDATETIME_TEST_RUN(
 	 "libcdatetime_elements_set_current_time_utc",
 	 cdatetime_test_elements_set_current_time_utc );
@@ -5160,14 +8825,50 @@ int main(
 	 "libcdatetime_elements_set_current_time_localtime",
 	 cdatetime_test_elements_set_current_time_localtime );
 
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_set_current_time_in_timezone",
+	 cdatetime_test_elements_set_current_time_in_timezone );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_convert_to_timezone",
+	 cdatetime_test_elements_convert_to_timezone );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_set_current_time_with_utc_offset",
+	 cdatetime_test_elements_set_current_time_with_utc_offset );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_convert_to_utc_offset",
+	 cdatetime_test_elements_convert_to_utc_offset );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_get_utc_offset",
+	 cdatetime_test_elements_get_utc_offset );
+
 	CDATETIME_TEST_RUN(
 	 "libcdatetime_elements_get_delta_in_seconds",
 	 cdatetime_test_elements_get_delta_in_seconds );
 
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_get_delta_in_seconds_and_nano_seconds",
+	 cdatetime_test_elements_get_delta_in_seconds_and_nano_seconds );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_get_delta_in_nano_seconds",
+	 cdatetime_test_elements_get_delta_in_nano_seconds );
+
 	CDATETIME_TEST_RUN(
 	 "libcdatetime_elements_set_from_delta_in_seconds",
 	 cdatetime_test_elements_set_from_delta_in_seconds );
 
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_copy_to_timestamp",
+	 cdatetime_test_elements_copy_to_timestamp );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_elements_copy_from_utf8_string",
+	 cdatetime_test_elements_copy_from_utf8_string );
+
 	CDATETIME_TEST_RUN(
 	 "libcdatetime_elements_get_string_size",
 	 cdatetime_test_elements_get_string_size );
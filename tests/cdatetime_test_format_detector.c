@@ -0,0 +1,1259 @@
+/*
+ * Library format_detector type test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+/* Tests the libcdatetime_format_detector_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_format_detector_initialize(
+     void )
+{
+	libcdatetime_format_detector_t *format_detector = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_format_detector_initialize(
+	          &format_detector,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "format_detector",
+	 format_detector );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_format_detector_free(
+	          &format_detector,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "format_detector",
+	 format_detector );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_format_detector_initialize(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	format_detector = (libcdatetime_format_detector_t *) 0x12345678UL;
+
+	result = libcdatetime_format_detector_initialize(
+	          &format_detector,
+	          &error );
+
+	format_detector = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_format_detector_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_format_detector_initialize(
+		          &format_detector,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( format_detector != NULL )
+			{
+				libcdatetime_format_detector_free(
+				 &format_detector,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "format_detector",
+			 format_detector );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_format_detector_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_format_detector_initialize(
+		          &format_detector,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( format_detector != NULL )
+			{
+				libcdatetime_format_detector_free(
+				 &format_detector,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "format_detector",
+			 format_detector );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( format_detector != NULL )
+	{
+		libcdatetime_format_detector_free(
+		 &format_detector,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_format_detector_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_format_detector_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_format_detector_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_format_detector_set_reference_year function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_format_detector_set_reference_year(
+     libcdatetime_format_detector_t *format_detector )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_format_detector_set_reference_year(
+	          format_detector,
+	          2020,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_format_detector_set_reference_year(
+	          NULL,
+	          2020,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_format_detector_get_string_format_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_format_detector_get_string_format_flags(
+     void )
+{
+	libcdatetime_format_detector_t *format_detector = NULL;
+	libcerror_error_t *error                        = NULL;
+	int64_t posix_time                              = 0;
+	uint32_t string_format_flags                    = 0;
+	int result                                      = 0;
+	int string_index                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_format_detector_initialize(
+	          &format_detector,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "format_detector",
+	 format_detector );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_format_detector_get_string_format_flags(
+	          format_detector,
+	          &string_format_flags,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The format detector locks onto a string format after 3 successive strings
+	 */
+	for( string_index = 0;
+	     string_index < 3;
+	     string_index++ )
+	{
+		result = libcdatetime_format_detector_parse_utf8_string_to_posix_time(
+		          format_detector,
+		          (uint8_t *) "Sat, 14 Mar 2020 15:09:26 GMT",
+		          29,
+		          &posix_time,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdatetime_format_detector_get_string_format_flags(
+	          format_detector,
+	          &string_format_flags,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "string_format_flags",
+	 string_format_flags,
+	 (uint32_t) ( LIBCDATETIME_STRING_FORMAT_TYPE_RFC2822 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME ) );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A string with a different format unlocks the format detector
+	 */
+	result = libcdatetime_format_detector_parse_utf8_string_to_posix_time(
+	          format_detector,
+	          (uint8_t *) "2020-03-14T15:09:26",
+	          19,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1584198566LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_format_detector_get_string_format_flags(
+	          format_detector,
+	          &string_format_flags,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_format_detector_get_string_format_flags(
+	          NULL,
+	          &string_format_flags,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_format_detector_get_string_format_flags(
+	          format_detector,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_format_detector_free(
+	          &format_detector,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( format_detector != NULL )
+	{
+		libcdatetime_format_detector_free(
+		 &format_detector,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_format_detector_parse_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_format_detector_parse_utf8_string(
+     libcdatetime_format_detector_t *format_detector )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	uint16_t year                     = 0;
+	uint8_t day_of_month              = 0;
+	uint8_t hours                     = 0;
+	uint8_t minutes                   = 0;
+	uint8_t month                     = 0;
+	uint8_t seconds                   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_format_detector_parse_utf8_string(
+	          format_detector,
+	          (uint8_t *) "Mar 14 15:09:26",
+	          15,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_date_values(
+	          elements,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 2020 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 14 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 15 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 9 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 26 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_format_detector_parse_utf8_string(
+	          NULL,
+	          (uint8_t *) "Mar 14 15:09:26",
+	          15,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_format_detector_parse_utf8_string(
+	          format_detector,
+	          (uint8_t *) "Mar 14 15:09:26",
+	          15,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_format_detector_parse_utf8_string(
+	          format_detector,
+	          (uint8_t *) "no date",
+	          7,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_format_detector_parse_utf8_string_with_parse_result function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_format_detector_parse_utf8_string_with_parse_result(
+     libcdatetime_format_detector_t *format_detector )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t parse_offset               = 0;
+	uint8_t hours                     = 0;
+	int parse_result                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_format_detector_parse_utf8_string_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "Sat, 14 Mar 2020 15:09:26 GMT",
+	          29,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	result = libcdatetime_elements_get_hours(
+	          elements,
+	          &hours,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 15 );
+
+	result = libcdatetime_format_detector_parse_utf8_string_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "Sat, 14 Mar 2020 15:0x:26 GMT",
+	          29,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 21 );
+
+	result = libcdatetime_format_detector_parse_utf8_string_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "no date",
+	          7,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_UNSUPPORTED_FORMAT );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_format_detector_parse_utf8_string_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "1584198566",
+	          10,
+	          NULL,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_format_detector_parse_utf8_string_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "1584198566",
+	          10,
+	          elements,
+	          NULL,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_format_detector_parse_utf8_string_to_posix_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_format_detector_parse_utf8_string_to_posix_time(
+     libcdatetime_format_detector_t *format_detector )
+{
+	const char *test_strings[ 5 ] = {
+		"2020-03-14T15:09:26",
+		"Sat, 14 Mar 2020 15:09:26 GMT",
+		"Sat Mar 14 15:09:26 2020",
+		"Mar 14 15:09:26",
+		"1584198566" };
+
+	libcerror_error_t *error      = NULL;
+	int64_t posix_time            = 0;
+	int result                    = 0;
+	int string_index              = 0;
+
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < 5;
+	     string_index++ )
+	{
+		posix_time = 0;
+
+		result = libcdatetime_format_detector_parse_utf8_string_to_posix_time(
+		          format_detector,
+		          (uint8_t *) test_strings[ string_index ],
+		          narrow_string_length(
+		           test_strings[ string_index ] ),
+		          &posix_time,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "posix_time",
+		 posix_time,
+		 (int64_t) 1584198566LL );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcdatetime_format_detector_parse_utf8_string_to_posix_time(
+	          NULL,
+	          (uint8_t *) "1584198566",
+	          10,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_format_detector_parse_utf8_string_to_posix_time(
+	          format_detector,
+	          (uint8_t *) "1584198566",
+	          10,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_format_detector_parse_utf8_string_to_posix_time_with_parse_result(
+     libcdatetime_format_detector_t *format_detector )
+{
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	size_t parse_offset      = 0;
+	int parse_result         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "Sat, 14 Mar 2020 15:09:26 GMT",
+	          29,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1584198566LL );
+
+	result = libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "Sat, 14 Mar 2020 15:0x:26 GMT",
+	          29,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 21 );
+
+	result = libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "no date",
+	          7,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_UNSUPPORTED_FORMAT );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result(
+	          format_detector,
+	          (uint8_t *) "1584198566",
+	          10,
+	          &posix_time,
+	          NULL,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcdatetime_format_detector_t *format_detector = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_format_detector_initialize",
+	 cdatetime_test_format_detector_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_format_detector_free",
+	 cdatetime_test_format_detector_free );
+
+	/* Initialize test
+	 */
+	result = libcdatetime_format_detector_initialize(
+	          &format_detector,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "format_detector",
+	 format_detector );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_RUN_WITH_ARGS(
+	 "libcdatetime_format_detector_set_reference_year",
+	 cdatetime_test_format_detector_set_reference_year,
+	 format_detector );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_format_detector_get_string_format_flags",
+	 cdatetime_test_format_detector_get_string_format_flags );
+
+	CDATETIME_TEST_RUN_WITH_ARGS(
+	 "libcdatetime_format_detector_parse_utf8_string",
+	 cdatetime_test_format_detector_parse_utf8_string,
+	 format_detector );
+
+	CDATETIME_TEST_RUN_WITH_ARGS(
+	 "libcdatetime_format_detector_parse_utf8_string_with_parse_result",
+	 cdatetime_test_format_detector_parse_utf8_string_with_parse_result,
+	 format_detector );
+
+	CDATETIME_TEST_RUN_WITH_ARGS(
+	 "libcdatetime_format_detector_parse_utf8_string_to_posix_time",
+	 cdatetime_test_format_detector_parse_utf8_string_to_posix_time,
+	 format_detector );
+
+	CDATETIME_TEST_RUN_WITH_ARGS(
+	 "libcdatetime_format_detector_parse_utf8_string_to_posix_time_with_parse_result",
+	 cdatetime_test_format_detector_parse_utf8_string_to_posix_time_with_parse_result,
+	 format_detector );
+
+	/* Clean up
+	 */
+	result = libcdatetime_format_detector_free(
+	          &format_detector,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( format_detector != NULL )
+	{
+		libcdatetime_format_detector_free(
+		 &format_detector,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1484 @@
+/*
+ * Library identifier functions test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_identifier.h"
+
+/* UUID version 7 from the example in RFC 9562: 017f22e2-79b0-7cc3-98c4-dc0c0c07398f
+ * which contains the time 2022-02-22T19:22:22.000Z
+ */
+uint8_t cdatetime_test_identifier_uuidv7_data[ 16 ] = {
+	0x01, 0x7f, 0x22, 0xe2, 0x79, 0xb0, 0x7c, 0xc3, 0x98, 0xc4, 0xdc, 0x0c, 0x0c, 0x07, 0x39, 0x8f };
+
+/* ULID from the example in the ULID specification: 01ARZ3NDEKTSV4RRFFQ69G5FAV
+ * which contains the time 2016-07-30T23:54:10.259Z
+ */
+uint8_t cdatetime_test_identifier_ulid_data[ 16 ] = {
+	0x01, 0x56, 0x3e, 0x3a, 0xb5, 0xd3, 0xd6, 0x76, 0x4c, 0x61, 0xef, 0xb9, 0x93, 0x02, 0xbd, 0x5b };
+
+/* UUID version 7 with all bits of the time set, which contains a time after April 11, 2262
+ * that cannot be represented as a 64-bit number of nano seconds
+ */
+uint8_t cdatetime_test_identifier_uuidv7_maximum_time_data[ 16 ] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xc3, 0x98, 0xc4, 0xdc, 0x0c, 0x0c, 0x07, 0x39, 0x8f };
+
+/* ULID with all bits of the time set: 7ZZZZZZZZZZZZZZZZZZZZZZZZZ
+ */
+uint8_t cdatetime_test_identifier_ulid_maximum_time_data[ 16 ] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+/* Tests the libcdatetime_uuidv7_copy_to_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_uuidv7_copy_to_timestamp(
+     void )
+{
+	uint8_t string[ 32 ];
+
+	libcdatetime_timestamp_t *timestamp = NULL;
+	libcerror_error_t *error            = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          cdatetime_test_identifier_uuidv7_data,
+	          16,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_copy_to_string(
+	          timestamp,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "2022-02-22T19:22:22.000Z",
+	          25 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a prefix that only contains the time
+	 */
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          cdatetime_test_identifier_uuidv7_data,
+	          6,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_copy_to_string(
+	          timestamp,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "2022-02-22T19:22:22.000Z",
+	          25 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          NULL,
+	          16,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          cdatetime_test_identifier_uuidv7_data,
+	          5,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          cdatetime_test_identifier_uuidv7_data,
+	          (size_t) SSIZE_MAX + 1,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          cdatetime_test_identifier_uuidv7_data,
+	          16,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the version is not 7
+	 */
+	cdatetime_test_identifier_uuidv7_data[ 6 ] = 0x4c;
+
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          cdatetime_test_identifier_uuidv7_data,
+	          16,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cdatetime_test_identifier_uuidv7_data[ 6 ] = 0x7c;
+
+	/* Test error case where the variant is not RFC 9562
+	 */
+	cdatetime_test_identifier_uuidv7_data[ 8 ] = 0xd8;
+
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          cdatetime_test_identifier_uuidv7_data,
+	          16,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cdatetime_test_identifier_uuidv7_data[ 8 ] = 0x98;
+
+	/* Test error case where the time is out of bounds
+	 */
+	result = libcdatetime_uuidv7_copy_to_timestamp(
+	          cdatetime_test_identifier_uuidv7_maximum_time_data,
+	          16,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_uuidv7_copy_to_elements function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_uuidv7_copy_to_elements(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	uint16_t milli_seconds            = 0;
+	uint16_t year                     = 0;
+	uint8_t day_of_month              = 0;
+	uint8_t hours                     = 0;
+	uint8_t minutes                   = 0;
+	uint8_t month                     = 0;
+	uint8_t seconds                   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_uuidv7_copy_to_elements(
+	          cdatetime_test_identifier_uuidv7_data,
+	          16,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_date_values(
+	          elements,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 2022 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 22 );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 19 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 22 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_milli_seconds(
+	          elements,
+	          &milli_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "milli_seconds",
+	 milli_seconds,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_uuidv7_copy_to_elements(
+	          NULL,
+	          16,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_uuidv7_copy_to_elements(
+	          cdatetime_test_identifier_uuidv7_data,
+	          5,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_uuidv7_copy_to_elements(
+	          cdatetime_test_identifier_uuidv7_data,
+	          16,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the time is out of bounds
+	 */
+	result = libcdatetime_uuidv7_copy_to_elements(
+	          cdatetime_test_identifier_uuidv7_maximum_time_data,
+	          16,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ulid_copy_to_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ulid_copy_to_timestamp(
+     void )
+{
+	uint8_t string[ 32 ];
+
+	libcdatetime_timestamp_t *timestamp = NULL;
+	libcerror_error_t *error            = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ulid_copy_to_timestamp(
+	          cdatetime_test_identifier_ulid_data,
+	          16,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_copy_to_string(
+	          timestamp,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "2016-07-30T23:54:10.259Z",
+	          25 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a prefix that only contains the time
+	 */
+	result = libcdatetime_ulid_copy_to_timestamp(
+	          cdatetime_test_identifier_ulid_data,
+	          6,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_copy_to_string(
+	          timestamp,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "2016-07-30T23:54:10.259Z",
+	          25 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ulid_copy_to_timestamp(
+	          NULL,
+	          16,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_timestamp(
+	          cdatetime_test_identifier_ulid_data,
+	          5,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_timestamp(
+	          cdatetime_test_identifier_ulid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_timestamp(
+	          cdatetime_test_identifier_ulid_data,
+	          16,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the time is out of bounds
+	 */
+	result = libcdatetime_ulid_copy_to_timestamp(
+	          cdatetime_test_identifier_ulid_maximum_time_data,
+	          16,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ulid_copy_to_elements function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ulid_copy_to_elements(
+     void )
+{
+	libcdatetime_elements_t *elements = NULL;
+	libcerror_error_t *error          = NULL;
+	uint16_t milli_seconds            = 0;
+	uint16_t year                     = 0;
+	uint8_t day_of_month              = 0;
+	uint8_t hours                     = 0;
+	uint8_t minutes                   = 0;
+	uint8_t month                     = 0;
+	uint8_t seconds                   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ulid_copy_to_elements(
+	          cdatetime_test_identifier_ulid_data,
+	          16,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_date_values(
+	          elements,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 2016 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 7 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 30 );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 23 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 54 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 10 );
+
+	result = libcdatetime_elements_get_milli_seconds(
+	          elements,
+	          &milli_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "milli_seconds",
+	 milli_seconds,
+	 259 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ulid_copy_to_elements(
+	          NULL,
+	          16,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_elements(
+	          cdatetime_test_identifier_ulid_data,
+	          5,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_elements(
+	          cdatetime_test_identifier_ulid_data,
+	          16,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the time is out of bounds
+	 */
+	result = libcdatetime_ulid_copy_to_elements(
+	          cdatetime_test_identifier_ulid_maximum_time_data,
+	          16,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ulid_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ulid_copy_from_utf8_string(
+     void )
+{
+	uint8_t ulid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ulid_copy_from_utf8_string(
+	          ulid_data,
+	          16,
+	          (uint8_t *) "01ARZ3NDEKTSV4RRFFQ69G5FAV",
+	          26,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          ulid_data,
+	          cdatetime_test_identifier_ulid_data,
+	          16 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that lower case characters and the aliases of 0 and 1 are supported
+	 */
+	result = libcdatetime_ulid_copy_from_utf8_string(
+	          ulid_data,
+	          16,
+	          (uint8_t *) "oiarz3ndektsv4rrffq69g5fav",
+	          26,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          ulid_data,
+	          cdatetime_test_identifier_ulid_data,
+	          16 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ulid_copy_from_utf8_string(
+	          NULL,
+	          16,
+	          (uint8_t *) "01ARZ3NDEKTSV4RRFFQ69G5FAV",
+	          26,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_from_utf8_string(
+	          ulid_data,
+	          15,
+	          (uint8_t *) "01ARZ3NDEKTSV4RRFFQ69G5FAV",
+	          26,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_from_utf8_string(
+	          ulid_data,
+	          16,
+	          NULL,
+	          26,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_from_utf8_string(
+	          ulid_data,
+	          16,
+	          (uint8_t *) "01ARZ3NDEKTSV4RRFFQ69G5FAV",
+	          25,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the string contains an unsupported character
+	 */
+	result = libcdatetime_ulid_copy_from_utf8_string(
+	          ulid_data,
+	          16,
+	          (uint8_t *) "01ARZ3NDEKTSV4RRFFQ69G5FAU",
+	          26,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the string value exceeds 128 bits
+	 */
+	result = libcdatetime_ulid_copy_from_utf8_string(
+	          ulid_data,
+	          16,
+	          (uint8_t *) "81ARZ3NDEKTSV4RRFFQ69G5FAV",
+	          26,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ulid_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ulid_copy_to_utf8_string(
+     void )
+{
+	uint8_t string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ulid_copy_to_utf8_string(
+	          cdatetime_test_identifier_ulid_data,
+	          16,
+	          string,
+	          27,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "01ARZ3NDEKTSV4RRFFQ69G5FAV",
+	          27 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ulid_copy_to_utf8_string(
+	          NULL,
+	          16,
+	          string,
+	          27,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_utf8_string(
+	          cdatetime_test_identifier_ulid_data,
+	          15,
+	          string,
+	          27,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_utf8_string(
+	          cdatetime_test_identifier_ulid_data,
+	          16,
+	          NULL,
+	          27,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_utf8_string(
+	          cdatetime_test_identifier_ulid_data,
+	          16,
+	          string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ulid_copy_to_utf8_string(
+	          cdatetime_test_identifier_ulid_data,
+	          16,
+	          string,
+	          26,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_uuidv7_copy_to_timestamp",
+	 cdatetime_test_uuidv7_copy_to_timestamp );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_uuidv7_copy_to_elements",
+	 cdatetime_test_uuidv7_copy_to_elements );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ulid_copy_to_timestamp",
+	 cdatetime_test_ulid_copy_to_timestamp );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ulid_copy_to_elements",
+	 cdatetime_test_ulid_copy_to_elements );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ulid_copy_from_utf8_string",
+	 cdatetime_test_ulid_copy_from_utf8_string );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ulid_copy_to_utf8_string",
+	 cdatetime_test_ulid_copy_to_utf8_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1538 @@
+/*
+ * Library identifier_generator type test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_identifier.h"
+#include "../libcdatetime/libcdatetime_identifier_generator.h"
+
+/* Clock that returns the time stored in the callback data for testing
+ * Returns 1 if successful or -1 on error
+ */
+int cdatetime_test_fixed_clock(
+     intptr_t *callback_data,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( callback_data == NULL )
+	 || ( posix_time_in_nano_seconds == NULL ) )
+	{
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = *( (int64_t *) callback_data );
+
+	return( 1 );
+}
+
+/* Tests the libcdatetime_identifier_generator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_identifier_generator_initialize(
+     void )
+{
+	libcdatetime_identifier_generator_t *identifier_generator = NULL;
+	libcerror_error_t *error                                  = NULL;
+	int result                                                = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests                           = 1;
+	int number_of_memset_fail_tests                           = 1;
+	int test_number                                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_identifier_generator_initialize(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_identifier_generator_free(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_identifier_generator_initialize(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	identifier_generator = (libcdatetime_identifier_generator_t *) 0x12345678UL;
+
+	result = libcdatetime_identifier_generator_initialize(
+	          &identifier_generator,
+	          &error );
+
+	identifier_generator = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_identifier_generator_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_identifier_generator_initialize(
+		          &identifier_generator,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( identifier_generator != NULL )
+			{
+				libcdatetime_identifier_generator_free(
+				 &identifier_generator,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "identifier_generator",
+			 identifier_generator );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_identifier_generator_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_identifier_generator_initialize(
+		          &identifier_generator,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( identifier_generator != NULL )
+			{
+				libcdatetime_identifier_generator_free(
+				 &identifier_generator,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "identifier_generator",
+			 identifier_generator );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_generator != NULL )
+	{
+		libcdatetime_identifier_generator_free(
+		 &identifier_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_identifier_generator_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_identifier_generator_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_identifier_generator_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_identifier_generator_set_clock_source function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_identifier_generator_set_clock_source(
+     void )
+{
+	libcdatetime_identifier_generator_t *identifier_generator = NULL;
+	libcerror_error_t *error                                  = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_identifier_generator_initialize(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_identifier_generator_set_clock_source(
+	          identifier_generator,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_identifier_generator_set_clock_source(
+	          NULL,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_set_clock_source(
+	          identifier_generator,
+	          LIBCDATETIME_CLOCK_SOURCE_MONOTONIC,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_identifier_generator_free(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_generator != NULL )
+	{
+		libcdatetime_identifier_generator_free(
+		 &identifier_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_identifier_generator_set_clock_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_identifier_generator_set_clock_callback(
+     void )
+{
+	libcdatetime_identifier_generator_t *identifier_generator = NULL;
+	libcerror_error_t *error                                  = NULL;
+	int64_t fixed_time                                        = 0;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_identifier_generator_initialize(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_identifier_generator_set_clock_callback(
+	          identifier_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_identifier_generator_set_clock_callback(
+	          NULL,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_set_clock_callback(
+	          identifier_generator,
+	          NULL,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_identifier_generator_free(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_generator != NULL )
+	{
+		libcdatetime_identifier_generator_free(
+		 &identifier_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_identifier_generator_get_next_uuidv7 function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_identifier_generator_get_next_uuidv7(
+     void )
+{
+	uint8_t expected_time_data[ 6 ] = {
+		0x01, 0x7f, 0x22, 0xe2, 0x79, 0xb0 };
+
+	uint8_t first_uuid_data[ 16 ];
+	uint8_t second_uuid_data[ 16 ];
+
+	libcdatetime_identifier_generator_t *identifier_generator = NULL;
+	libcerror_error_t *error                                  = NULL;
+	int64_t fixed_time                                        = 1645557742000123456LL;
+	int64_t posix_time_in_milli_seconds                       = 0;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_identifier_generator_initialize(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_identifier_generator_set_clock_callback(
+	          identifier_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          first_uuid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the UUID contains the time, version and variant
+	 */
+	result = memory_compare(
+	          first_uuid_data,
+	          expected_time_data,
+	          6 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "first_uuid_data[ 6 ] >> 4",
+	 (uint8_t) ( first_uuid_data[ 6 ] >> 4 ),
+	 7 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "first_uuid_data[ 8 ] & 0xc0",
+	 (uint8_t) ( first_uuid_data[ 8 ] & 0xc0 ),
+	 0x80 );
+
+	/* Test that a UUID generated in the same milli second is larger
+	 */
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          second_uuid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          second_uuid_data,
+	          first_uuid_data,
+	          16 );
+
+	CDATETIME_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          second_uuid_data,
+	          expected_time_data,
+	          6 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a UUID generated after the clock went backwards is larger
+	 */
+	fixed_time -= 1000000000;
+
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          first_uuid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          first_uuid_data,
+	          second_uuid_data,
+	          16 );
+
+	CDATETIME_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          first_uuid_data,
+	          expected_time_data,
+	          6 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          NULL,
+	          first_uuid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          NULL,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          first_uuid_data,
+	          15,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          first_uuid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the current time is before January 1, 1970
+	 */
+	fixed_time = -1;
+
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          first_uuid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	/* Test that the time is advanced when the counter overflows
+	 */
+	fixed_time = 1645557742000000000LL;
+
+	( (libcdatetime_internal_identifier_generator_t *) identifier_generator )->uuidv7_counter = 0x0fff;
+
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          first_uuid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_uuidv7_get_posix_time_in_milli_seconds(
+	          first_uuid_data,
+	          16,
+	          &posix_time_in_milli_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_milli_seconds",
+	 posix_time_in_milli_seconds,
+	 (int64_t) 1645557742001LL );
+
+	/* Test error case where the time cannot be advanced
+	 */
+	( (libcdatetime_internal_identifier_generator_t *) identifier_generator )->uuidv7_posix_time_in_milli_seconds = LIBCDATETIME_IDENTIFIER_MAXIMUM_TIME;
+	( (libcdatetime_internal_identifier_generator_t *) identifier_generator )->uuidv7_counter                     = 0x0fff;
+
+	result = libcdatetime_identifier_generator_get_next_uuidv7(
+	          identifier_generator,
+	          first_uuid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libcdatetime_identifier_generator_free(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_generator != NULL )
+	{
+		libcdatetime_identifier_generator_free(
+		 &identifier_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_identifier_generator_get_next_ulid function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_identifier_generator_get_next_ulid(
+     void )
+{
+	uint8_t expected_time_data[ 6 ] = {
+		0x01, 0x7f, 0x22, 0xe2, 0x79, 0xb0 };
+
+	uint8_t first_ulid_data[ 16 ];
+	uint8_t second_ulid_data[ 16 ];
+
+	libcdatetime_identifier_generator_t *identifier_generator = NULL;
+	libcerror_error_t *error                                  = NULL;
+	int64_t fixed_time                                        = 1645557742000123456LL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_identifier_generator_initialize(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_identifier_generator_set_clock_callback(
+	          identifier_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          identifier_generator,
+	          first_ulid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          first_ulid_data,
+	          expected_time_data,
+	          6 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a ULID generated in the same milli second is larger
+	 */
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          identifier_generator,
+	          second_ulid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          second_ulid_data,
+	          first_ulid_data,
+	          16 );
+
+	CDATETIME_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          second_ulid_data,
+	          expected_time_data,
+	          6 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a ULID generated after the clock went backwards is larger
+	 */
+	fixed_time -= 1000000000;
+
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          identifier_generator,
+	          first_ulid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          first_ulid_data,
+	          second_ulid_data,
+	          16 );
+
+	CDATETIME_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          first_ulid_data,
+	          expected_time_data,
+	          6 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          NULL,
+	          first_ulid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          identifier_generator,
+	          NULL,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          identifier_generator,
+	          first_ulid_data,
+	          15,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          identifier_generator,
+	          first_ulid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the current time is before January 1, 1970
+	 */
+	fixed_time = -1;
+
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          identifier_generator,
+	          first_ulid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	/* Test error case where the random part cannot be incremented
+	 */
+	fixed_time = 1645557742000000000LL;
+
+	memory_set(
+	 ( (libcdatetime_internal_identifier_generator_t *) identifier_generator )->ulid_random_data,
+	 0xff,
+	 10 );
+
+	result = libcdatetime_identifier_generator_get_next_ulid(
+	          identifier_generator,
+	          first_ulid_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libcdatetime_identifier_generator_free(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_generator != NULL )
+	{
+		libcdatetime_identifier_generator_free(
+		 &identifier_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* Tests the libcdatetime_identifier_generator_read_system_random_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_identifier_generator_read_system_random_data(
+     void )
+{
+	uint8_t random_data[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_identifier_generator_read_system_random_data(
+	          random_data,
+	          32,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_identifier_generator_read_system_random_data(
+	          NULL,
+	          32,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_identifier_generator_read_system_random_data(
+	          random_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_internal_identifier_generator_get_random_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_internal_identifier_generator_get_random_data(
+     void )
+{
+	uint8_t first_random_data[ LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE + 1 ];
+	uint8_t second_random_data[ 16 ];
+
+	libcdatetime_identifier_generator_t *identifier_generator = NULL;
+	libcerror_error_t *error                                  = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_identifier_generator_initialize(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_internal_identifier_generator_get_random_data(
+	          (libcdatetime_internal_identifier_generator_t *) identifier_generator,
+	          first_random_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_identifier_generator_get_random_data(
+	          (libcdatetime_internal_identifier_generator_t *) identifier_generator,
+	          second_random_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that random data is not handed out twice
+	 */
+	result = memory_compare(
+	          first_random_data,
+	          second_random_data,
+	          16 );
+
+	CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_internal_identifier_generator_get_random_data(
+	          NULL,
+	          first_random_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_identifier_generator_get_random_data(
+	          (libcdatetime_internal_identifier_generator_t *) identifier_generator,
+	          NULL,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_identifier_generator_get_random_data(
+	          (libcdatetime_internal_identifier_generator_t *) identifier_generator,
+	          first_random_data,
+	          LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	( (libcdatetime_internal_identifier_generator_t *) identifier_generator )->random_data_offset = LIBCDATETIME_IDENTIFIER_GENERATOR_RANDOM_DATA_SIZE + 1;
+
+	result = libcdatetime_internal_identifier_generator_get_random_data(
+	          (libcdatetime_internal_identifier_generator_t *) identifier_generator,
+	          first_random_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	( (libcdatetime_internal_identifier_generator_t *) identifier_generator )->random_data_offset = 0;
+
+	/* Clean up
+	 */
+	result = libcdatetime_identifier_generator_free(
+	          &identifier_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "identifier_generator",
+	 identifier_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_generator != NULL )
+	{
+		libcdatetime_identifier_generator_free(
+		 &identifier_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_identifier_generator_initialize",
+	 cdatetime_test_identifier_generator_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_identifier_generator_free",
+	 cdatetime_test_identifier_generator_free );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_identifier_generator_set_clock_source",
+	 cdatetime_test_identifier_generator_set_clock_source );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_identifier_generator_set_clock_callback",
+	 cdatetime_test_identifier_generator_set_clock_callback );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_identifier_generator_read_system_random_data",
+	 cdatetime_test_identifier_generator_read_system_random_data );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_internal_identifier_generator_get_random_data",
+	 cdatetime_test_internal_identifier_generator_get_random_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_identifier_generator_get_next_uuidv7",
+	 cdatetime_test_identifier_generator_get_next_uuidv7 );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_identifier_generator_get_next_ulid",
+	 cdatetime_test_identifier_generator_get_next_ulid );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
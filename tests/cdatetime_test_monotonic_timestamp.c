@@ -0,0 +1,1658 @@
+/*
+ * Library monotonic_timestamp type test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_monotonic_timestamp.h"
+
+/* Clock that returns the time stored in the callback data for testing
+ * Returns 1 if successful or -1 on error
+ */
+int cdatetime_test_fixed_clock(
+     intptr_t *callback_data,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( callback_data == NULL )
+	 || ( posix_time_in_nano_seconds == NULL ) )
+	{
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = *( (int64_t *) callback_data );
+
+	return( 1 );
+}
+
+/* Tests the libcdatetime_monotonic_timestamp_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_monotonic_timestamp_initialize(
+     void )
+{
+	libcdatetime_monotonic_timestamp_t *monotonic_timestamp = NULL;
+	libcerror_error_t *error                                = NULL;
+	int result                                              = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests                         = 1;
+	int number_of_memset_fail_tests                         = 1;
+	int test_number                                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_free(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	monotonic_timestamp = (libcdatetime_monotonic_timestamp_t *) 0x12345678UL;
+
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &monotonic_timestamp,
+	          &error );
+
+	monotonic_timestamp = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_monotonic_timestamp_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_monotonic_timestamp_initialize(
+		          &monotonic_timestamp,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( monotonic_timestamp != NULL )
+			{
+				libcdatetime_monotonic_timestamp_free(
+				 &monotonic_timestamp,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "monotonic_timestamp",
+			 monotonic_timestamp );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_monotonic_timestamp_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_monotonic_timestamp_initialize(
+		          &monotonic_timestamp,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( monotonic_timestamp != NULL )
+			{
+				libcdatetime_monotonic_timestamp_free(
+				 &monotonic_timestamp,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "monotonic_timestamp",
+			 monotonic_timestamp );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &monotonic_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_monotonic_timestamp_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_monotonic_timestamp_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_monotonic_timestamp_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_monotonic_timestamp_copy function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_monotonic_timestamp_copy(
+     void )
+{
+	libcdatetime_monotonic_timestamp_t *destination_monotonic_timestamp = NULL;
+	libcdatetime_monotonic_timestamp_t *source_monotonic_timestamp      = NULL;
+	libcerror_error_t *error                                            = NULL;
+	int64_t number_of_nano_seconds                                      = 0;
+	int result                                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &source_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "source_monotonic_timestamp",
+	 source_monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &destination_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_monotonic_timestamp",
+	 destination_monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_set_current_time(
+	          source_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_monotonic_timestamp_copy(
+	          destination_monotonic_timestamp,
+	          source_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+	          destination_monotonic_timestamp,
+	          source_monotonic_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_monotonic_timestamp_copy(
+	          NULL,
+	          source_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_monotonic_timestamp_copy(
+	          destination_monotonic_timestamp,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_monotonic_timestamp_free(
+	          &destination_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "destination_monotonic_timestamp",
+	 destination_monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_free(
+	          &source_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "source_monotonic_timestamp",
+	 source_monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &destination_monotonic_timestamp,
+		 NULL );
+	}
+	if( source_monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &source_monotonic_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_monotonic_timestamp_set_clock_source function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_monotonic_timestamp_set_clock_source(
+     void )
+{
+	libcdatetime_monotonic_timestamp_t *monotonic_timestamp = NULL;
+	libcerror_error_t *error                                = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          monotonic_timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_BOOTTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_set_current_time(
+	          monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          monotonic_timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_DEFAULT,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "monotonic_timestamp->clock_source",
+	 ( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->clock_source,
+	 LIBCDATETIME_CLOCK_SOURCE_MONOTONIC );
+
+	/* Test that changing the clock source discards the reference
+	 */
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "monotonic_timestamp->has_reference",
+	 ( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->has_reference,
+	 (uint8_t) 0 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          monotonic_timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_MONOTONIC,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          NULL,
+	          LIBCDATETIME_CLOCK_SOURCE_MONOTONIC,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          monotonic_timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          monotonic_timestamp,
+	          -1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_monotonic_timestamp_free(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &monotonic_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_monotonic_timestamp_capture_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_monotonic_timestamp_capture_reference(
+     void )
+{
+	libcdatetime_monotonic_timestamp_t *monotonic_timestamp = NULL;
+	libcerror_error_t *error                                = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_monotonic_timestamp_capture_reference(
+	          monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "monotonic_timestamp->has_reference",
+	 ( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->has_reference,
+	 (uint8_t) 1 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_monotonic_timestamp_capture_reference(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_monotonic_timestamp_free(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &monotonic_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_monotonic_timestamp_set_current_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_monotonic_timestamp_set_current_time(
+     void )
+{
+	libcdatetime_monotonic_timestamp_t *monotonic_timestamp = NULL;
+	libcerror_error_t *error                                = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_monotonic_timestamp_set_current_time(
+	          monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	/* Test that the reference is captured by the first call
+	 */
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "monotonic_timestamp->has_reference",
+	 ( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->has_reference,
+	 (uint8_t) 1 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          monotonic_timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_BOOTTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_set_current_time(
+	          monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_monotonic_timestamp_set_current_time(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_monotonic_timestamp_free(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &monotonic_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_monotonic_timestamp_get_delta_in_nano_seconds(
+     void )
+{
+	libcdatetime_monotonic_timestamp_t *first_monotonic_timestamp  = NULL;
+	libcdatetime_monotonic_timestamp_t *second_monotonic_timestamp = NULL;
+	libcerror_error_t *error                                       = NULL;
+	int64_t number_of_nano_seconds                                 = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &first_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_monotonic_timestamp",
+	 first_monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &second_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_monotonic_timestamp",
+	 second_monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_set_current_time(
+	          first_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_set_current_time(
+	          second_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+	          second_monotonic_timestamp,
+	          first_monotonic_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "number_of_nano_seconds >= 0",
+	 (int) ( number_of_nano_seconds >= 0 ),
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	( (libcdatetime_internal_monotonic_timestamp_t *) first_monotonic_timestamp )->nano_seconds  = 1500000000LL;
+	( (libcdatetime_internal_monotonic_timestamp_t *) second_monotonic_timestamp )->nano_seconds = 1000000250LL;
+
+	result = libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+	          first_monotonic_timestamp,
+	          second_monotonic_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 499999750LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+	          second_monotonic_timestamp,
+	          first_monotonic_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) -499999750LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+	          NULL,
+	          first_monotonic_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+	          second_monotonic_timestamp,
+	          NULL,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+	          second_monotonic_timestamp,
+	          first_monotonic_timestamp,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the clock sources differ
+	 */
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          second_monotonic_timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_BOOTTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds(
+	          second_monotonic_timestamp,
+	          first_monotonic_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_monotonic_timestamp_free(
+	          &second_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_monotonic_timestamp",
+	 second_monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_free(
+	          &first_monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_monotonic_timestamp",
+	 first_monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &second_monotonic_timestamp,
+		 NULL );
+	}
+	if( first_monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &first_monotonic_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_monotonic_timestamp_copy_to_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_monotonic_timestamp_copy_to_timestamp(
+     void )
+{
+	libcdatetime_monotonic_timestamp_t *monotonic_timestamp = NULL;
+	libcdatetime_timestamp_t *expected_timestamp            = NULL;
+	libcdatetime_timestamp_t *timestamp                     = NULL;
+	libcerror_error_t *error                                = NULL;
+	int64_t number_of_nano_seconds                          = 0;
+	int64_t posix_time_in_nano_seconds                      = 1404648000000000000LL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_monotonic_timestamp_initialize(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &expected_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_timestamp",
+	 expected_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          expected_timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          expected_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_monotonic_timestamp_set_current_time(
+	          monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_copy_to_timestamp(
+	          monotonic_timestamp,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	/* Test that the wall clock time is determined relative to the reference
+	 */
+	( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->nano_seconds                         = 1000002500LL;
+	( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->reference_nano_seconds               = 1000000000LL;
+	( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->reference_posix_time_in_nano_seconds = posix_time_in_nano_seconds;
+
+	result = libcdatetime_monotonic_timestamp_copy_to_timestamp(
+	          monotonic_timestamp,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          expected_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 2500 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->nano_seconds = 999997500LL;
+
+	result = libcdatetime_monotonic_timestamp_copy_to_timestamp(
+	          monotonic_timestamp,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          expected_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) -2500 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the POSIX time would overflow
+	 */
+	( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->nano_seconds                         = 1000002500LL;
+	( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->reference_posix_time_in_nano_seconds = (int64_t) INT64_MAX - 1000;
+
+	result = libcdatetime_monotonic_timestamp_copy_to_timestamp(
+	          monotonic_timestamp,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->nano_seconds                         = 999997500LL;
+	( (libcdatetime_internal_monotonic_timestamp_t *) monotonic_timestamp )->reference_posix_time_in_nano_seconds = (int64_t) INT64_MIN + 1000;
+
+	result = libcdatetime_monotonic_timestamp_copy_to_timestamp(
+	          monotonic_timestamp,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_monotonic_timestamp_copy_to_timestamp(
+	          NULL,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_monotonic_timestamp_copy_to_timestamp(
+	          monotonic_timestamp,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the reference is missing
+	 */
+	result = libcdatetime_monotonic_timestamp_set_clock_source(
+	          monotonic_timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_BOOTTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_copy_to_timestamp(
+	          monotonic_timestamp,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &expected_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "expected_timestamp",
+	 expected_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_monotonic_timestamp_free(
+	          &monotonic_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "monotonic_timestamp",
+	 monotonic_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &expected_timestamp,
+		 NULL );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	if( monotonic_timestamp != NULL )
+	{
+		libcdatetime_monotonic_timestamp_free(
+		 &monotonic_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_monotonic_timestamp_initialize",
+	 cdatetime_test_monotonic_timestamp_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_monotonic_timestamp_free",
+	 cdatetime_test_monotonic_timestamp_free );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_monotonic_timestamp_copy",
+	 cdatetime_test_monotonic_timestamp_copy );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_monotonic_timestamp_set_clock_source",
+	 cdatetime_test_monotonic_timestamp_set_clock_source );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_monotonic_timestamp_capture_reference",
+	 cdatetime_test_monotonic_timestamp_capture_reference );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_monotonic_timestamp_set_current_time",
+	 cdatetime_test_monotonic_timestamp_set_current_time );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_monotonic_timestamp_get_delta_in_nano_seconds",
+	 cdatetime_test_monotonic_timestamp_get_delta_in_nano_seconds );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_monotonic_timestamp_copy_to_timestamp",
+	 cdatetime_test_monotonic_timestamp_copy_to_timestamp );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
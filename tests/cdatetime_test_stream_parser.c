@@ -0,0 +1,2060 @@
+/*
+ * Library stream_parser type test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+/* Tests the libcdatetime_stream_parser_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_stream_parser_initialize(
+     void )
+{
+	libcdatetime_stream_parser_t *stream_parser = NULL;
+	libcerror_error_t *error                    = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 1;
+	int number_of_memset_fail_tests             = 1;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_stream_parser_initialize(
+	          &stream_parser,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_parser",
+	 stream_parser );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_stream_parser_free(
+	          &stream_parser,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "stream_parser",
+	 stream_parser );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_stream_parser_initialize(
+	          NULL,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream_parser = (libcdatetime_stream_parser_t *) 0x12345678UL;
+
+	result = libcdatetime_stream_parser_initialize(
+	          &stream_parser,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	stream_parser = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_stream_parser_initialize(
+	          &stream_parser,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_stream_parser_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_stream_parser_initialize(
+		          &stream_parser,
+		          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( stream_parser != NULL )
+			{
+				libcdatetime_stream_parser_free(
+				 &stream_parser,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "stream_parser",
+			 stream_parser );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_stream_parser_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_stream_parser_initialize(
+		          &stream_parser,
+		          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( stream_parser != NULL )
+			{
+				libcdatetime_stream_parser_free(
+				 &stream_parser,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "stream_parser",
+			 stream_parser );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_parser != NULL )
+	{
+		libcdatetime_stream_parser_free(
+		 &stream_parser,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_stream_parser_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_stream_parser_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_stream_parser_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_stream_parser_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_stream_parser_reset(
+     void )
+{
+	uint8_t data[ 8 ]                           = { '2', '0', '2', '0', '-', '0', '3', '-' };
+
+	libcdatetime_elements_t *elements           = NULL;
+	libcdatetime_stream_parser_t *stream_parser = NULL;
+	libcerror_error_t *error                    = NULL;
+	size_t data_offset                          = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdatetime_stream_parser_initialize(
+	          &stream_parser,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data,
+	          8,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_stream_parser_reset(
+	          stream_parser,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_stream_parser_flush(
+	          stream_parser,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_stream_parser_reset(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_stream_parser_free(
+	          &stream_parser,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_parser != NULL )
+	{
+		libcdatetime_stream_parser_free(
+		 &stream_parser,
+		 NULL );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_stream_parser_parse_utf8_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_stream_parser_parse_utf8_data(
+     void )
+{
+	uint8_t data1[ 16 ]                         = { '2', '0', '2', '0', '-', '0', '3', '-', '1', '5', 'T', '1', '2', ':', '3', '4' };
+	uint8_t data2[ 20 ]                         = { ':', '5', '6', '.', '7', '8', '9', 'Z', '\n', '1', '9', '9', '9', '-', '1', '2', '-', '3', '1', 'T' };
+	uint8_t data3[ 10 ]                         = { '2', '3', ':', '5', '9', ':', '5', '9', '+', '0' };
+	uint8_t data4[ 4 ]                          = { '1', ':', '0', '0' };
+	uint8_t data5[ 13 ]                         = { '2', '0', '2', '0', '-', '1', '3', '-', '0', '1', 'T', '0', '0' };
+
+	libcdatetime_elements_t *elements           = NULL;
+	libcdatetime_stream_parser_t *stream_parser = NULL;
+	libcerror_error_t *error                    = NULL;
+	size_t data_offset                          = 0;
+	uint16_t year                               = 0;
+	uint8_t day_of_month                        = 0;
+	uint8_t hours                               = 0;
+	uint8_t minutes                             = 0;
+	uint8_t month                               = 0;
+	uint8_t seconds                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_stream_parser_initialize(
+	          &stream_parser,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_parser",
+	 stream_parser );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data1,
+	          16,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 16 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data2,
+	          20,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 8 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_date_values(
+	          elements,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 2020 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 15 );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 12 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 34 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 56 );
+
+	/* Continue with the second value that starts in the same buffer
+	 * and has a timezone offset split across buffers
+	 */
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data2,
+	          20,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 20 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data3,
+	          10,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 10 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data4,
+	          4,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 4 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* 1999-12-31T23:59:59+01:00 is 1999-12-31T22:59:59 in UTC
+	 */
+	result = libcdatetime_elements_get_date_values(
+	          elements,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 1999 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 12 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 31 );
+
+	result = libcdatetime_elements_get_hours(
+	          elements,
+	          &hours,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 22 );
+
+	/* Test a value that is completed at the end of the stream
+	 */
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data3,
+	          8,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data1,
+	          10,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_stream_parser_flush(
+	          stream_parser,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that parsing resumes after invalid data within a buffer
+	 */
+	result = libcdatetime_stream_parser_reset(
+	          stream_parser,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) "2024-01-01T00:00:00Z junk 2024-02-02T00:00:00Z",
+	          46,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 20 );
+
+	result = libcdatetime_elements_get_month(
+	          elements,
+	          &month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 1 );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) "2024-01-01T00:00:00Z junk 2024-02-02T00:00:00Z",
+	          46,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 25 );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) "2024-01-01T00:00:00Z junk 2024-02-02T00:00:00Z",
+	          46,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 46 );
+
+	result = libcdatetime_elements_get_month(
+	          elements,
+	          &month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 2 );
+
+	/* Test that parsing resumes after invalid data across buffers
+	 */
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) "2024-0",
+	          6,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 6 );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) "x-01 2024-03-03T00:00:00Z",
+	          25,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 4 );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) "x-01 2024-03-03T00:00:00Z",
+	          25,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 25 );
+
+	result = libcdatetime_elements_get_month(
+	          elements,
+	          &month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 3 );
+
+	/* Test that parsing resumes after an out of bounds value across buffers
+	 */
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) "2024-02-30T00:00",
+	          16,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 16 );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) ":00Z 2024-04-04T00:00:00Z",
+	          25,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 4 );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          (uint8_t *) ":00Z 2024-04-04T00:00:00Z",
+	          25,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 25 );
+
+	result = libcdatetime_elements_get_month(
+	          elements,
+	          &month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 4 );
+
+	/* Test error cases
+	 */
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data5,
+	          13,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data4,
+	          4,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          NULL,
+	          data1,
+	          16,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          NULL,
+	          16,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data1,
+	          16,
+	          NULL,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_offset = 17;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data1,
+	          16,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data1,
+	          16,
+	          &data_offset,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_stream_parser_free(
+	          &stream_parser,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "stream_parser",
+	 stream_parser );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_parser != NULL )
+	{
+		libcdatetime_stream_parser_free(
+		 &stream_parser,
+		 NULL );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_stream_parser_parse_utf8_data_with_parse_result function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_stream_parser_parse_utf8_data_with_parse_result(
+     void )
+{
+	libcdatetime_elements_t *elements           = NULL;
+	libcdatetime_stream_parser_t *stream_parser = NULL;
+	libcerror_error_t *error                    = NULL;
+	size_t data_offset                          = 0;
+	size_t parse_offset                         = 0;
+	uint8_t month                               = 0;
+	int parse_result                            = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	result = libcdatetime_stream_parser_initialize(
+	          &stream_parser,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_parser",
+	 stream_parser );
+
+	/* Test regular cases
+	 */
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "2024-01-01T00:00:00Z junk 2024-02-02T00:00:00Z",
+	          46,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 20 );
+
+	result = libcdatetime_elements_get_month(
+	          elements,
+	          &month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 1 );
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "2024-01-01T00:00:00Z junk 2024-02-02T00:00:00Z",
+	          46,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 21 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 25 );
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "2024-01-01T00:00:00Z junk 2024-02-02T00:00:00Z",
+	          46,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 46 );
+
+	result = libcdatetime_elements_get_month(
+	          elements,
+	          &month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 2 );
+
+	/* Test invalid data in previously buffered data
+	 */
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "2024-0",
+	          6,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_TRUNCATED );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 6 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 6 );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "x-01 2024-03-03T00:00:00Z",
+	          25,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 4 );
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "x-01 2024-03-03T00:00:00Z",
+	          25,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 25 );
+
+	result = libcdatetime_elements_get_month(
+	          elements,
+	          &month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 3 );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "2024-02-30T00:00",
+	          16,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_TRUNCATED );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 16 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 16 );
+
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) ":00Z 2024-04-04T00:00:00Z",
+	          25,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_VALUE_OUT_OF_BOUNDS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 4 );
+
+	/* Test error cases
+	 */
+	data_offset = 0;
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "2024-01-01T00:00:00Z",
+	          20,
+	          &data_offset,
+	          elements,
+	          NULL,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_stream_parser_parse_utf8_data_with_parse_result(
+	          stream_parser,
+	          (uint8_t *) "2024-01-01T00:00:00Z",
+	          20,
+	          &data_offset,
+	          elements,
+	          &parse_result,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_stream_parser_free(
+	          &stream_parser,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "stream_parser",
+	 stream_parser );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_parser != NULL )
+	{
+		libcdatetime_stream_parser_free(
+		 &stream_parser,
+		 NULL );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_stream_parser_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_stream_parser_flush(
+     void )
+{
+	uint8_t data[ 22 ]                          = { 'J', 'a', 'n', ' ', '0', '2', ',', ' ', '2', '0', '0', '1', ' ', '0', '3', ':', '0', '4', ':', '0', '5', '\n' };
+
+	libcdatetime_elements_t *elements           = NULL;
+	libcdatetime_stream_parser_t *stream_parser = NULL;
+	libcerror_error_t *error                    = NULL;
+	size_t data_offset                          = 0;
+	uint16_t year                               = 0;
+	uint8_t day_of_month                        = 0;
+	uint8_t month                               = 0;
+	uint8_t seconds                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdatetime_stream_parser_initialize(
+	          &stream_parser,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_stream_parser_flush(
+	          stream_parser,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_stream_parser_parse_utf8_data(
+	          stream_parser,
+	          data,
+	          21,
+	          &data_offset,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_stream_parser_flush(
+	          stream_parser,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_date_values(
+	          elements,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 2001 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 2 );
+
+	result = libcdatetime_elements_get_seconds(
+	          elements,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 5 );
+
+	result = libcdatetime_stream_parser_flush(
+	          stream_parser,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_stream_parser_flush(
+	          NULL,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_stream_parser_flush(
+	          stream_parser,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_stream_parser_free(
+	          &stream_parser,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_parser != NULL )
+	{
+		libcdatetime_stream_parser_free(
+		 &stream_parser,
+		 NULL );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_stream_parser_initialize",
+	 cdatetime_test_stream_parser_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_stream_parser_free",
+	 cdatetime_test_stream_parser_free );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_stream_parser_reset",
+	 cdatetime_test_stream_parser_reset );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_stream_parser_parse_utf8_data",
+	 cdatetime_test_stream_parser_parse_utf8_data );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_stream_parser_parse_utf8_data_with_parse_result",
+	 cdatetime_test_stream_parser_parse_utf8_data_with_parse_result );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_stream_parser_flush",
+	 cdatetime_test_stream_parser_flush );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
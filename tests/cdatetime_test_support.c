@@ -404,8 +404,1560 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcdatetime_get_days_since_epoch function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_get_days_since_epoch(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t number_of_days   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_get_days_since_epoch(
+	          &number_of_days,
+	          1970,
+	          1,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 0 );
+
+	result = libcdatetime_get_days_since_epoch(
+	          &number_of_days,
+	          2000,
+	          3,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 11017 );
+
+	result = libcdatetime_get_days_since_epoch(
+	          &number_of_days,
+	          1601,
+	          1,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) -134774 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_get_days_since_epoch(
+	          NULL,
+	          1970,
+	          1,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_get_days_since_epoch(
+	          &number_of_days,
+	          1970,
+	          13,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_get_days_since_epoch(
+	          &number_of_days,
+	          1999,
+	          2,
+	          29,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_get_date_values_from_days_since_epoch function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_get_date_values_from_days_since_epoch(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t year            = 0;
+	uint8_t day_of_month     = 0;
+	uint8_t month            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_get_date_values_from_days_since_epoch(
+	          11017,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 2000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 1 );
+
+	result = libcdatetime_get_date_values_from_days_since_epoch(
+	          -134774,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 1601 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_get_date_values_from_days_since_epoch(
+	          0,
+	          NULL,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_get_date_values_from_days_since_epoch(
+	          -719529,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
 
+/* Tests the libcdatetime_parse_utf8_string_to_posix_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_parse_utf8_string_to_posix_time(
+     void )
+{
+	uint8_t utf8_string1[ 21 ] = { '2', '0', '0', '1', '-', '0', '9', '-', '0', '9', 'T', '0', '1', ':', '4', '6', ':', '4', '0', 'Z', 0 };
+	uint8_t utf8_string2[ 29 ] = { 'D', 'e', 'c', ' ', '3', '1', ',', ' ', '1', '9', '6', '9', ' ', '2', '3', ':', '5', '9', ':', '5', '9', '.', '5', ' ', 'U', 'T', 'C', 0, 0 };
+
+	libcerror_error_t *error   = NULL;
+	int64_t posix_time         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time(
+	          utf8_string1,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time(
+	          utf8_string1,
+	          10,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 999993600 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time(
+	          utf8_string2,
+	          27,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) -1 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time(
+	          NULL,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time(
+	          utf8_string1,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a string that is too small
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time(
+	          utf8_string1,
+	          15,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with trailing data
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time(
+	          utf8_string2,
+	          29,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_parse_utf8_string_to_posix_time_in_nano_seconds(
+     void )
+{
+	uint8_t utf8_string1[ 30 ] = { '1', '9', '6', '9', '-', '1', '2', '-', '3', '1', 'T', '2', '3', ':', '5', '9', ':', '5', '9', '.', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'Z' };
+	uint8_t utf8_string2[ 20 ] = { '2', '2', '6', '3', '-', '0', '1', '-', '0', '1', 'T', '0', '0', ':', '0', '0', ':', '0', '0', 'Z' };
+
+	libcerror_error_t *error   = NULL;
+	int64_t posix_time         = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds(
+	          utf8_string1,
+	          30,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) -876543211 );
+
+	/* Test negative POSIX times with a fraction of a second
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds(
+	          (uint8_t *) "-0.5",
+	          4,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_POSIX_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) -500000000 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds(
+	          (uint8_t *) "-1.25",
+	          5,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_POSIX_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) -1250000000 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds(
+	          NULL,
+	          30,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds(
+	          utf8_string1,
+	          30,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a date and time value that exceeds the 64-bit range
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds(
+	          utf8_string2,
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_parse_utf8_string_to_posix_time_with_parse_result function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_parse_utf8_string_to_posix_time_with_parse_result(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	size_t parse_offset      = 0;
+	int parse_result         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          (uint8_t *) "2001-09-09T01:46:40Z",
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          (uint8_t *) "2001-09-09T06:46:40+05",
+	          22,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          (uint8_t *) "2001-09-08T20:16:40-0530",
+	          24,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          (uint8_t *) "2001-09-09T01:4x:40Z",
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 15 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          (uint8_t *) "2001-13-09",
+	          10,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_VALUE_OUT_OF_BOUNDS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 0 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          (uint8_t *) "2001-09",
+	          7,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_TRUNCATED );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 7 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          (uint8_t *) "2001-09-09 01:46:40",
+	          19,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_TRAILING_DATA );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 10 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          NULL,
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_with_parse_result(
+	          (uint8_t *) "2001-09-09T01:46:40Z",
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          NULL,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	size_t parse_offset      = 0;
+	int parse_result         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          (uint8_t *) "2001-09-09T01:46:40Z",
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_SUCCESS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000000000000LL );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          (uint8_t *) "2001-09-09T01:4x:40Z",
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 15 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          (uint8_t *) "2001-13-09",
+	          10,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_VALUE_OUT_OF_BOUNDS );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 0 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          (uint8_t *) "2001-09",
+	          7,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_TRUNCATED );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 7 );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          (uint8_t *) "2001-09-09 01:46:40",
+	          19,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_TRAILING_DATA );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 10 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          NULL,
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result(
+	          (uint8_t *) "2001-09-09T01:46:40Z",
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          NULL,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_detect_utf8_string_format function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_detect_utf8_string_format(
+     void )
+{
+	const char *test_strings[ 7 ] = {
+		"2020-03-14",
+		"2020-03-14T15:09:26.535Z",
+		"Sat, 14 Mar 2020 15:09:26 +0100",
+		"Sat Mar 14 15:09:26 2020",
+		"Mar 14, 2020 15:09:26 UTC",
+		"Mar 14 15:09:26",
+		"1584198566" };
+
+	uint32_t expected_string_format_flags[ 7 ] = {
+		LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+		LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		LIBCDATETIME_STRING_FORMAT_TYPE_RFC2822 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		LIBCDATETIME_STRING_FORMAT_TYPE_SYSLOG | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		LIBCDATETIME_STRING_FORMAT_TYPE_POSIX_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME };
+
+	libcerror_error_t *error      = NULL;
+	uint32_t string_format_flags  = 0;
+	int result                    = 0;
+	int string_index              = 0;
+
+	/* Test regular cases
+	 */
+	for( string_index = 0;
+	     string_index < 7;
+	     string_index++ )
+	{
+		result = libcdatetime_detect_utf8_string_format(
+		          (uint8_t *) test_strings[ string_index ],
+		          narrow_string_length(
+		           test_strings[ string_index ] ),
+		          &string_format_flags,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+		 "string_format_flags",
+		 string_format_flags,
+		 expected_string_format_flags[ string_index ] );
+	}
+	result = libcdatetime_detect_utf8_string_format(
+	          (uint8_t *) "no date",
+	          7,
+	          &string_format_flags,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_detect_utf8_string_format(
+	          NULL,
+	          10,
+	          &string_format_flags,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_detect_utf8_string_format(
+	          (uint8_t *) "1584198566",
+	          10,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_parse_utf16_string_to_posix_time_with_parse_result function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_parse_utf16_string_to_posix_time_with_parse_result(
+     void )
+{
+	uint16_t utf16_string1[ 21 ] = { '2', '0', '0', '1', '-', '0', '9', '-', '0', '9', 'T', '0', '1', ':', '4', '6', ':', '4', '0', 'Z', 0 };
+	uint16_t utf16_string2[ 10 ] = { '2', '0', '0', '1', '-', '0', '9', '-', '0', 0x0969 };
+
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	size_t parse_offset      = 0;
+	int parse_result         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_parse_utf16_string_to_posix_time_with_parse_result(
+	          utf16_string1,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000 );
+
+	/* A code unit outside the ASCII range is an invalid character
+	 */
+	result = libcdatetime_parse_utf16_string_to_posix_time_with_parse_result(
+	          utf16_string2,
+	          10,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 9 );
+
+	result = libcdatetime_parse_utf16_string_to_posix_time_in_nano_seconds(
+	          utf16_string1,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000000000000LL );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_parse_utf16_string_to_posix_time_with_parse_result(
+	          NULL,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_parse_utf16_string_to_posix_time(
+	          utf16_string2,
+	          10,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_parse_utf32_string_to_posix_time_with_parse_result function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_parse_utf32_string_to_posix_time_with_parse_result(
+     void )
+{
+	uint32_t utf32_string1[ 21 ] = { '2', '0', '0', '1', '-', '0', '9', '-', '0', '9', 'T', '0', '1', ':', '4', '6', ':', '4', '0', 'Z', 0 };
+	uint32_t utf32_string2[ 10 ] = { '2', '0', '0', '1', '-', '0', '9', '-', '0', 0x0969 };
+
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	size_t parse_offset      = 0;
+	int parse_result         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_parse_utf32_string_to_posix_time_with_parse_result(
+	          utf32_string1,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000 );
+
+	/* A code unit outside the ASCII range is an invalid character
+	 */
+	result = libcdatetime_parse_utf32_string_to_posix_time_with_parse_result(
+	          utf32_string2,
+	          10,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "parse_result",
+	 parse_result,
+	 LIBCDATETIME_PARSE_RESULT_INVALID_CHARACTER );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 9 );
+
+	result = libcdatetime_parse_utf32_string_to_posix_time_in_nano_seconds(
+	          utf32_string1,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1000000000000000000LL );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_parse_utf32_string_to_posix_time_with_parse_result(
+	          NULL,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &posix_time,
+	          &parse_result,
+	          &parse_offset,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_parse_utf32_string_to_posix_time(
+	          utf32_string2,
+	          10,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_detect_utf16_string_format function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_detect_utf16_string_format(
+     void )
+{
+	uint16_t utf16_string[ 16 ] = { 'M', 'a', 'r', ' ', '1', '4', ' ', '1', '5', ':', '0', '9', ':', '2', '6', 0 };
+
+	libcerror_error_t *error     = NULL;
+	uint32_t string_format_flags = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_detect_utf16_string_format(
+	          utf16_string,
+	          16,
+	          &string_format_flags,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "string_format_flags",
+	 string_format_flags,
+	 (uint32_t) ( LIBCDATETIME_STRING_FORMAT_TYPE_SYSLOG | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME ) );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_detect_utf16_string_format(
+	          NULL,
+	          16,
+	          &string_format_flags,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -439,8 +1991,48 @@ int main(
 	 "libcdatetime_get_day_of_year",
 	 cdatetime_test_get_day_of_year );
 
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_get_days_since_epoch",
+	 cdatetime_test_get_days_since_epoch );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_get_date_values_from_days_since_epoch",
+	 cdatetime_test_get_date_values_from_days_since_epoch );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
 
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_parse_utf8_string_to_posix_time",
+	 cdatetime_test_parse_utf8_string_to_posix_time );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds",
+	 cdatetime_test_parse_utf8_string_to_posix_time_in_nano_seconds );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_parse_utf8_string_to_posix_time_with_parse_result",
+	 cdatetime_test_parse_utf8_string_to_posix_time_with_parse_result );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result",
+	 cdatetime_test_parse_utf8_string_to_posix_time_in_nano_seconds_with_parse_result );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_detect_utf8_string_format",
+	 cdatetime_test_detect_utf8_string_format );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_parse_utf16_string_to_posix_time_with_parse_result",
+	 cdatetime_test_parse_utf16_string_to_posix_time_with_parse_result );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_parse_utf32_string_to_posix_time_with_parse_result",
+	 cdatetime_test_parse_utf32_string_to_posix_time_with_parse_result );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_detect_utf16_string_format",
+	 cdatetime_test_detect_utf16_string_format );
+
 	return( EXIT_SUCCESS );
 
 on_error:
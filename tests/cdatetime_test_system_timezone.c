@@ -0,0 +1,942 @@
+/*
+ * Library system timezone functions test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_system_timezone.h"
+#include "../libcdatetime/libcdatetime_timezone.h"
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+
+#define CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_THREADS	4
+#define CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_CONVERSIONS	2000
+#define CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_RELOADS	100
+
+#endif /* defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* Tests the libcdatetime_system_timezone_read function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_system_timezone_read(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int32_t utc_offset                = 0;
+	uint8_t is_daylight_saving_time   = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_system_timezone_read(
+	          NULL,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "timezone",
+		 timezone );
+
+		result = libcdatetime_timezone_free(
+		          &timezone,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "timezone",
+		 timezone );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The UTC timezone is not available on all systems
+	 */
+	result = libcdatetime_system_timezone_read(
+	          ":UTC",
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "timezone",
+		 timezone );
+
+		result = libcdatetime_timezone_free(
+		          &timezone,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "timezone",
+		 timezone );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a TZ value that contains a POSIX TZ rule string
+	 */
+	result = libcdatetime_system_timezone_read(
+	          "XYZ-3",
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          1600000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 (int32_t) 10800 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test TZ values that are not available as TZif data
+	 */
+	result = libcdatetime_system_timezone_read(
+	          "",
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_system_timezone_read(
+	          ":",
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_system_timezone_read(
+	          "/nonexistent",
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_system_timezone_read(
+	          "../UTC",
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_system_timezone_read(
+	          "X-3",
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_system_timezone_read(
+	          NULL,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timezone = (libcdatetime_timezone_t *) 0x12345678UL;
+
+	result = libcdatetime_system_timezone_read(
+	          NULL,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timezone = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_system_timezone_get_timezone function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_system_timezone_get_timezone(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_system_timezone_get_timezone(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "timezone",
+		 timezone );
+
+		result = libcdatetime_system_timezone_release_timezone(
+		          &timezone,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "timezone",
+		 timezone );
+	}
+	/* Test error cases
+	 */
+	result = libcdatetime_system_timezone_get_timezone(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_system_timezone_release_timezone function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_system_timezone_release_timezone(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_system_timezone_release_timezone(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_system_timezone_release_timezone(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+
+/* Tests the libcdatetime_system_timezone_reload function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_system_timezone_reload(
+     void )
+{
+	char abbreviation[ 16 ];
+
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_system_timezone_reload(
+	          &error );
+
+	CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		result = libcdatetime_system_timezone_get_timezone(
+		          &timezone,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "timezone",
+		 timezone );
+	}
+	/* Test that a timezone that is still used remains valid after it was retired
+	 */
+	result = libcdatetime_system_timezone_reload(
+	          &error );
+
+	CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( timezone != NULL )
+	{
+		result = libcdatetime_timezone_get_abbreviation(
+		          timezone,
+		          0,
+		          abbreviation,
+		          16,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdatetime_system_timezone_release_timezone(
+		          &timezone,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Free the retired timezones
+	 */
+	result = libcdatetime_stop_system_timezone_watcher(
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_system_timezone_release_timezone(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H )
+
+/* The start function of the threads that convert into and from localtime
+ * Returns NULL
+ */
+void *cdatetime_test_system_timezone_thread_start_function(
+       void *arguments )
+{
+	libcdatetime_elements_t *elements   = NULL;
+	libcdatetime_timestamp_t *timestamp = NULL;
+	int *number_of_errors               = NULL;
+	int conversion_index                = 0;
+
+	number_of_errors = (int *) arguments;
+
+	if( libcdatetime_elements_initialize(
+	     &elements,
+	     NULL ) != 1 )
+	{
+		*number_of_errors += 1;
+
+		goto on_error;
+	}
+	if( libcdatetime_timestamp_initialize(
+	     &timestamp,
+	     NULL ) != 1 )
+	{
+		*number_of_errors += 1;
+
+		goto on_error;
+	}
+	for( conversion_index = 0;
+	     conversion_index < CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_CONVERSIONS;
+	     conversion_index++ )
+	{
+		if( libcdatetime_elements_set_current_time_localtime(
+		     elements,
+		     NULL ) != 1 )
+		{
+			*number_of_errors += 1;
+		}
+		else if( libcdatetime_elements_copy_to_timestamp(
+		          elements,
+		          timestamp,
+		          NULL ) != 1 )
+		{
+			*number_of_errors += 1;
+		}
+	}
+on_error:
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Tests the libcdatetime_system_timezone_reload function while other threads convert into and from localtime
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_system_timezone_reload_threaded(
+     void )
+{
+	int number_of_errors[ CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_THREADS ];
+	pthread_t threads[ CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int reload_index         = 0;
+	int result               = 0;
+	int thread_index         = 0;
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		number_of_errors[ thread_index ] = 0;
+
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &cdatetime_test_system_timezone_thread_start_function,
+		          (void *) &( number_of_errors[ thread_index ] ) );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_threads++;
+	}
+	/* Every reload replaces the system timezone the threads are converting with
+	 */
+	for( reload_index = 0;
+	     reload_index < CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_RELOADS;
+	     reload_index++ )
+	{
+		result = libcdatetime_system_timezone_reload(
+		          &error );
+
+		CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		pthread_join(
+		 threads[ number_of_threads ],
+		 NULL );
+	}
+	for( thread_index = 0;
+	     thread_index < CDATETIME_TEST_SYSTEM_TIMEZONE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "number_of_errors[ thread_index ]",
+		 number_of_errors[ thread_index ],
+		 0 );
+	}
+	/* Free the retired timezones
+	 */
+	result = libcdatetime_stop_system_timezone_watcher(
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		pthread_join(
+		 threads[ number_of_threads ],
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) */
+
+#endif /* defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* Tests the libcdatetime_start_system_timezone_watcher and libcdatetime_stop_system_timezone_watcher functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_start_system_timezone_watcher(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+	int expected_result      = 0;
+#endif
+
+#if !defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+	/* Test error cases
+	 */
+	result = libcdatetime_start_system_timezone_watcher(
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#else
+	if( getenv( "TZ" ) == NULL )
+	{
+		expected_result = 1;
+	}
+	/* Test regular cases
+	 */
+	result = libcdatetime_start_system_timezone_watcher(
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 expected_result );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	if( expected_result == 1 )
+	{
+		result = libcdatetime_start_system_timezone_watcher(
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* !defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+
+	result = libcdatetime_stop_system_timezone_watcher(
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stop without a running watcher
+	 */
+	result = libcdatetime_stop_system_timezone_watcher(
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+	libcdatetime_stop_system_timezone_watcher(
+	 NULL );
+#endif
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_system_timezone_read",
+	 cdatetime_test_system_timezone_read );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_system_timezone_get_timezone",
+	 cdatetime_test_system_timezone_get_timezone );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_system_timezone_release_timezone",
+	 cdatetime_test_system_timezone_release_timezone );
+
+#if defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_system_timezone_reload",
+	 cdatetime_test_system_timezone_reload );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_system_timezone_reload (threaded)",
+	 cdatetime_test_system_timezone_reload_threaded );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) */
+
+#endif /* defined( LIBCDATETIME_HAVE_SYSTEM_TIMEZONE_WATCHER ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_start_system_timezone_watcher",
+	 cdatetime_test_start_system_timezone_watcher );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1837 @@
+/*
+ * Library ticker type test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_ticker.h"
+
+/* Clock that returns the time stored in the callback data for testing
+ * Returns 1 if successful or -1 on error
+ */
+int cdatetime_test_fixed_clock(
+     intptr_t *callback_data,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( callback_data == NULL )
+	 || ( posix_time_in_nano_seconds == NULL ) )
+	{
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = *( (int64_t *) callback_data );
+
+	return( 1 );
+}
+
+/* Clock that fails for testing
+ * Returns -1
+ */
+int cdatetime_test_failing_clock(
+     intptr_t *callback_data CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     int64_t *posix_time_in_nano_seconds CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( callback_data )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( posix_time_in_nano_seconds )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+/* Tests the libcdatetime_ticker_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ticker_initialize(
+     void )
+{
+	libcdatetime_ticker_t *ticker   = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ticker_initialize(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_free(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ticker_initialize(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ticker = (libcdatetime_ticker_t *) 0x12345678UL;
+
+	result = libcdatetime_ticker_initialize(
+	          &ticker,
+	          &error );
+
+	ticker = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_ticker_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_ticker_initialize(
+		          &ticker,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( ticker != NULL )
+			{
+				libcdatetime_ticker_free(
+				 &ticker,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "ticker",
+			 ticker );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_ticker_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_ticker_initialize(
+		          &ticker,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( ticker != NULL )
+			{
+				libcdatetime_ticker_free(
+				 &ticker,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "ticker",
+			 ticker );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ticker != NULL )
+	{
+		libcdatetime_ticker_free(
+		 &ticker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ticker_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ticker_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ticker_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ticker_set_clock_source function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ticker_set_clock_source(
+     void )
+{
+	libcdatetime_ticker_t *ticker = NULL;
+	libcerror_error_t *error      = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_ticker_initialize(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ticker_set_clock_source(
+	          ticker,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_refresh(
+	          ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ticker_set_clock_source(
+	          NULL,
+	          LIBCDATETIME_CLOCK_SOURCE_DEFAULT,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_set_clock_source(
+	          ticker,
+	          LIBCDATETIME_CLOCK_SOURCE_CALLBACK,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_ticker_free(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ticker != NULL )
+	{
+		libcdatetime_ticker_free(
+		 &ticker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ticker_set_clock_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ticker_set_clock_callback(
+     void )
+{
+	libcdatetime_ticker_t *ticker = NULL;
+	libcerror_error_t *error      = NULL;
+	int64_t fixed_time            = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_ticker_initialize(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ticker_set_clock_callback(
+	          ticker,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ticker_set_clock_callback(
+	          NULL,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_set_clock_callback(
+	          ticker,
+	          NULL,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_ticker_free(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ticker != NULL )
+	{
+		libcdatetime_ticker_free(
+		 &ticker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ticker_refresh function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ticker_refresh(
+     void )
+{
+	uint8_t string[ 32 ];
+
+	libcdatetime_ticker_t *ticker      = NULL;
+	libcerror_error_t *error           = NULL;
+	int64_t fixed_time                 = 0;
+	int64_t posix_time_in_nano_seconds = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_ticker_initialize(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_set_clock_callback(
+	          ticker,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ticker_get_posix_time_in_nano_seconds(
+	          ticker,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixed_time = 1234567891LL;
+
+	result = libcdatetime_ticker_refresh(
+	          ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_get_posix_time_in_nano_seconds(
+	          ticker,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 (int64_t) 1234567891LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "1970-01-01T00:00:01Z",
+	          21 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the strings are retained within the same second
+	 */
+	fixed_time = 1999999999LL;
+
+	result = libcdatetime_ticker_refresh(
+	          ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_get_posix_time_in_nano_seconds(
+	          ticker,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 (int64_t) 1999999999LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "Jan 01, 1970 00:00:01 UTC",
+	          26 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the strings are rendered again when the second changes
+	 * the fraction of a second is relative to the preceding second
+	 */
+	fixed_time = -1LL;
+
+	result = libcdatetime_ticker_refresh(
+	          ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "1969-12-31T23:59:59",
+	          20 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ticker_refresh(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_set_clock_callback(
+	          ticker,
+	          &cdatetime_test_failing_clock,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_refresh(
+	          ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the previous values remain available
+	 */
+	result = libcdatetime_ticker_get_posix_time_in_nano_seconds(
+	          ticker,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 (int64_t) -1LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_get_posix_time_in_nano_seconds(
+	          NULL,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_get_posix_time_in_nano_seconds(
+	          ticker,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_ticker_free(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ticker != NULL )
+	{
+		libcdatetime_ticker_free(
+		 &ticker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ticker_start and libcdatetime_ticker_stop functions
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ticker_start(
+     void )
+{
+	libcdatetime_ticker_t *ticker      = NULL;
+	libcerror_error_t *error           = NULL;
+	int64_t fixed_time                 = 86400000000000LL;
+	int64_t posix_time_in_nano_seconds = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_ticker_initialize(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_set_clock_callback(
+	          ticker,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ticker_start(
+	          NULL,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_start(
+	          ticker,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_stop(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( LIBCDATETIME_HAVE_TICKER_THREAD )
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ticker_start(
+	          ticker,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The current time is available when the ticker thread has started
+	 */
+	result = libcdatetime_ticker_get_posix_time_in_nano_seconds(
+	          ticker,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 (int64_t) 86400000000000LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases while the ticker thread is running
+	 */
+	result = libcdatetime_ticker_start(
+	          ticker,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_set_clock_source(
+	          ticker,
+	          LIBCDATETIME_CLOCK_SOURCE_DEFAULT,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_stop(
+	          ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the ticker thread can be restarted and is stopped when freed
+	 */
+	result = libcdatetime_ticker_start(
+	          ticker,
+	          1000,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#else
+	result = libcdatetime_ticker_start(
+	          ticker,
+	          1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( LIBCDATETIME_HAVE_TICKER_THREAD ) */
+
+	/* Clean up
+	 */
+	result = libcdatetime_ticker_free(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ticker != NULL )
+	{
+		libcdatetime_ticker_free(
+		 &ticker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ticker_copy_to_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ticker_copy_to_timestamp(
+     void )
+{
+	libcdatetime_ticker_t *ticker          = NULL;
+	libcdatetime_timestamp_t *timestamp    = NULL;
+	libcdatetime_timestamp_t *timestamp2   = NULL;
+	libcerror_error_t *error               = NULL;
+	int64_t fixed_time                     = 0;
+	int64_t number_of_nano_seconds         = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_ticker_initialize(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_set_clock_callback(
+	          ticker,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp2,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp2",
+	 timestamp2 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp2,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ticker_copy_to_timestamp(
+	          ticker,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixed_time = 1234567800LL;
+
+	result = libcdatetime_ticker_refresh(
+	          ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_copy_to_timestamp(
+	          ticker,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixed_time = 1000000000LL;
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp2,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          timestamp2,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 234567800LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ticker_copy_to_timestamp(
+	          NULL,
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_copy_to_timestamp(
+	          ticker,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &timestamp2,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp2",
+	 timestamp2 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_free(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp2 != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp2,
+		 NULL );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	if( ticker != NULL )
+	{
+		libcdatetime_ticker_free(
+		 &ticker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_ticker_copy_to_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_ticker_copy_to_string(
+     void )
+{
+	uint8_t string[ 32 ];
+
+	libcdatetime_ticker_t *ticker = NULL;
+	libcerror_error_t *error      = NULL;
+	int64_t fixed_time            = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_ticker_initialize(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_set_clock_callback(
+	          ticker,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixed_time = 1404648000123456789LL;
+
+	result = libcdatetime_ticker_refresh(
+	          ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          22,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "Jul 06, 2014 12:00:00",
+	          22 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          21,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "2014-07-06T12:00:00Z",
+	          21 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_ticker_copy_to_string(
+	          NULL,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          NULL,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          20,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The strings only contain the date and time up to the second
+	 */
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_ticker_copy_to_string(
+	          ticker,
+	          string,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_RFC2822 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_ticker_free(
+	          &ticker,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "ticker",
+	 ticker );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ticker != NULL )
+	{
+		libcdatetime_ticker_free(
+		 &ticker,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ticker_initialize",
+	 cdatetime_test_ticker_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ticker_free",
+	 cdatetime_test_ticker_free );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ticker_set_clock_source",
+	 cdatetime_test_ticker_set_clock_source );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ticker_set_clock_callback",
+	 cdatetime_test_ticker_set_clock_callback );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ticker_refresh",
+	 cdatetime_test_ticker_refresh );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ticker_start",
+	 cdatetime_test_ticker_start );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ticker_copy_to_timestamp",
+	 cdatetime_test_ticker_copy_to_timestamp );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_ticker_copy_to_string",
+	 cdatetime_test_ticker_copy_to_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
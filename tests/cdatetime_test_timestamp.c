@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,6 +35,8 @@
 #include <time.h>
 #endif /* !defined( WINAPI ) */
 
+#include <errno.h>
+
 #if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
 #define __USE_GNU
 #include <dlfcn.h>
@@ -46,11 +49,19 @@
 #include "cdatetime_test_memory.h"
 #include "cdatetime_test_unused.h"
 
+#include "../libcdatetime/libcdatetime_timestamp.h"
+
 #if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
 
 static struct tm *(*cdatetime_test_real_gmtime_r)(const time_t *, struct tm *) = NULL;
 static time_t (*cdatetime_test_real_time)(time_t *)                            = NULL;
 
+#if defined( HAVE_CLOCK_GETTIME )
+static int (*cdatetime_test_real_clock_gettime)(clockid_t, struct timespec *)  = NULL;
+
+int cdatetime_test_clock_gettime_attempts_before_fail                          = -1;
+#endif
+
 int cdatetime_test_gmtime_r_attempts_before_fail                               = -1;
 int cdatetime_test_time_attempts_before_fail                                   = -1;
 
@@ -116,8 +127,89 @@ time_t time(
 	return( result_time );
 }
 
+#if defined( HAVE_CLOCK_GETTIME )
+
+/* Custom clock_gettime for testing error cases
+ * Returns 0 if successful or -1 on error
+ */
+int clock_gettime(
+     clockid_t clock_identifier,
+     struct timespec *time_specification )
+{
+	int result = 0;
+
+	if( cdatetime_test_real_clock_gettime == NULL )
+	{
+		cdatetime_test_real_clock_gettime = dlsym(
+		                                     RTLD_NEXT,
+		                                     "clock_gettime" );
+	}
+	if( cdatetime_test_clock_gettime_attempts_before_fail == 0 )
+	{
+		cdatetime_test_clock_gettime_attempts_before_fail = -1;
+
+		errno = EINVAL;
+
+		return( -1 );
+	}
+	else if( cdatetime_test_clock_gettime_attempts_before_fail > 0 )
+	{
+		cdatetime_test_clock_gettime_attempts_before_fail--;
+	}
+	result = cdatetime_test_real_clock_gettime(
+	          clock_identifier,
+	          time_specification );
+
+	return( result );
+}
+
+#endif /* defined( HAVE_CLOCK_GETTIME ) */
+
 #endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
 
+/* Clock that returns the time stored in the callback data for testing
+ * Returns 1 if successful or -1 on error
+ */
+int cdatetime_test_fixed_clock(
+     intptr_t *callback_data,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( callback_data == NULL )
+	 || ( posix_time_in_nano_seconds == NULL ) )
+	{
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = *( (int64_t *) callback_data );
+
+	return( 1 );
+}
+
+/* Clock that fails for testing error cases
+ * Returns -1
+ */
+int cdatetime_test_failing_clock(
+     intptr_t *callback_data CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     int64_t *posix_time_in_nano_seconds CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( callback_data )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( posix_time_in_nano_seconds )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+/* TZif version 1 data with a single local time type: IST (UTC+5:30)
+ */
+uint8_t cdatetime_test_timestamp_timezone_data1[ 54 ] = {
+	0x54, 0x5a, 0x69, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x4d, 0x58,
+	0x00, 0x00, 0x49, 0x53, 0x54, 0x00 };
+
 /* Tests the libcdatetime_timestamp_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -540,10 +632,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcdatetime_timestamp_set_current_time function
+/* Tests the libcdatetime_timestamp_set_clock_source function
  * Returns 1 if successful or 0 if not
  */
-int cdatetime_test_timestamp_set_current_time(
+int cdatetime_test_timestamp_set_clock_source(
      void )
 {
 	libcdatetime_timestamp_t *timestamp = NULL;
@@ -571,8 +663,37 @@ int cdatetime_test_timestamp_set_current_time(
 
 	/* Test regular cases
 	 */
-	result = libcdatetime_timestamp_set_current_time(
+	result = libcdatetime_timestamp_set_clock_source(
+	          timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_source(
+	          timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_source(
 	          timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_DEFAULT,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -586,8 +707,9 @@ int cdatetime_test_timestamp_set_current_time(
 
 	/* Test error cases
 	 */
-	result = libcdatetime_timestamp_set_current_time(
+	result = libcdatetime_timestamp_set_clock_source(
 	          NULL,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -602,75 +724,39 @@ int cdatetime_test_timestamp_set_current_time(
 	libcerror_error_free(
 	 &error );
 
-#if defined( WINAPI ) && ( WINVER >= 0x0500 )
-
-#if defined( HAVE_CDATETIME_TEST_MEMORY )
-
-	/* Test libcdatetime_timestamp_set_current_time with memset failing
-	 */
-	cdatetime_test_memset_attempts_before_fail = 0;
-
-	result = libcdatetime_timestamp_set_current_time(
+	result = libcdatetime_timestamp_set_clock_source(
 	          timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_CALLBACK,
 	          &error );
 
-	if( cdatetime_test_memset_attempts_before_fail != -1 )
-	{
-		cdatetime_test_memset_attempts_before_fail = -1;
-	}
-	else
-	{
-		CDATETIME_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
-
-	/* TODO: Test libcdatetime_timestamp_set_current_time with SystemTimeToFileTime failing
-	 */
-
-#else
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test libcdatetime_timestamp_set_current_time with time failing
-	 */
-	cdatetime_test_time_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libcdatetime_timestamp_set_current_time(
+	result = libcdatetime_timestamp_set_clock_source(
 	          timestamp,
+	          99,
 	          &error );
 
-	if( cdatetime_test_time_attempts_before_fail != -1 )
-	{
-		cdatetime_test_time_attempts_before_fail = -1;
-	}
-	else
-	{
-		CDATETIME_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	}
-#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
@@ -708,39 +794,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcdatetime_timestamp_get_delta_in_seconds function
+/* Tests the libcdatetime_timestamp_set_clock_callback function
  * Returns 1 if successful or 0 if not
  */
-int cdatetime_test_timestamp_get_delta_in_seconds(
+int cdatetime_test_timestamp_set_clock_callback(
      void )
 {
-	libcdatetime_timestamp_t *first_timestamp  = NULL;
-	libcdatetime_timestamp_t *second_timestamp = NULL;
-	libcerror_error_t *error                   = NULL;
-	int64_t number_of_seconds                  = 0;
-	int result                                 = 0;
+	libcdatetime_timestamp_t *timestamp = NULL;
+	libcerror_error_t *error            = NULL;
+	int64_t fixed_time                  = 0;
+	int result                          = 0;
 
 	/* Initialize test
 	 */
 	result = libcdatetime_timestamp_initialize(
-	          &first_timestamp,
-	          &error );
-
-	CDATETIME_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "first_timestamp",
-	 first_timestamp );
-
-	CDATETIME_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdatetime_timestamp_initialize(
-	          &second_timestamp,
+	          &timestamp,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -749,21 +817,8 @@ int cdatetime_test_timestamp_get_delta_in_seconds(
 	 1 );
 
 	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "second_timestamp",
-	 second_timestamp );
-
-	CDATETIME_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdatetime_timestamp_set_current_time(
-	          second_timestamp,
-	          &error );
-
-	CDATETIME_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	 "timestamp",
+	 timestamp );
 
 	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -771,25 +826,10 @@ int cdatetime_test_timestamp_get_delta_in_seconds(
 
 	/* Test regular cases
 	 */
-	result = libcdatetime_timestamp_get_delta_in_seconds(
-	          first_timestamp,
-	          second_timestamp,
-	          &number_of_seconds,
-	          &error );
-
-	CDATETIME_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CDATETIME_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libcdatetime_timestamp_get_delta_in_seconds(
-	          second_timestamp,
-	          first_timestamp,
-	          &number_of_seconds,
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -803,28 +843,10 @@ int cdatetime_test_timestamp_get_delta_in_seconds(
 
 	/* Test error cases
 	 */
-	result = libcdatetime_timestamp_get_delta_in_seconds(
-	          NULL,
-	          second_timestamp,
-	          &number_of_seconds,
-	          &error );
-
-	CDATETIME_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libcdatetime_timestamp_get_delta_in_seconds(
-	          first_timestamp,
+	result = libcdatetime_timestamp_set_clock_callback(
 	          NULL,
-	          &number_of_seconds,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -839,10 +861,10 @@ int cdatetime_test_timestamp_get_delta_in_seconds(
 	libcerror_error_free(
 	 &error );
 
-	result = libcdatetime_timestamp_get_delta_in_seconds(
-	          first_timestamp,
-	          second_timestamp,
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
 	          NULL,
+	          (intptr_t *) &fixed_time,
 	          &error );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -860,7 +882,7 @@ int cdatetime_test_timestamp_get_delta_in_seconds(
 	/* Clean up
 	 */
 	result = libcdatetime_timestamp_free(
-	          &second_timestamp,
+	          &timestamp,
 	          NULL );
 
 	CDATETIME_TEST_ASSERT_EQUAL_INT(
@@ -869,29 +891,4226 @@ int cdatetime_test_timestamp_get_delta_in_seconds(
 	 1 );
 
 	CDATETIME_TEST_ASSERT_IS_NULL(
-	 "second_timestamp",
-	 second_timestamp );
+	 "timestamp",
+	 timestamp );
 
 	CDATETIME_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcdatetime_timestamp_free(
-	          &first_timestamp,
-	          NULL );
-
-	CDATETIME_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CDATETIME_TEST_ASSERT_IS_NULL(
-	 "first_timestamp",
-	 first_timestamp );
+	return( 1 );
 
-	CDATETIME_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_set_current_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_set_current_time(
+     void )
+{
+	libcdatetime_timestamp_t *second_timestamp = NULL;
+	libcdatetime_timestamp_t *timestamp        = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t fixed_time                         = 0;
+	int64_t number_of_nano_seconds             = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set current time with a fixed clock
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          second_timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixed_time = 1234567800LL;
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixed_time = 1000000000LL;
+
+	result = libcdatetime_timestamp_set_current_time(
+	          second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          second_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 234567800LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &second_timestamp,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_set_current_time(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcdatetime_timestamp_set_current_time with the clock failing
+	 */
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_failing_clock,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_set_clock_source(
+	          timestamp,
+	          LIBCDATETIME_CLOCK_SOURCE_DEFAULT,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	/* Test libcdatetime_timestamp_set_current_time with memset failing
+	 */
+	cdatetime_test_memset_attempts_before_fail = 0;
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	if( cdatetime_test_memset_attempts_before_fail != -1 )
+	{
+		cdatetime_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	/* TODO: Test libcdatetime_timestamp_set_current_time with SystemTimeToFileTime failing
+	 */
+
+#else
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ )
+
+#if defined( HAVE_CLOCK_GETTIME )
+
+	/* Test libcdatetime_timestamp_set_current_time with clock_gettime failing
+	 */
+	cdatetime_test_clock_gettime_attempts_before_fail = 0;
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	if( cdatetime_test_clock_gettime_attempts_before_fail != -1 )
+	{
+		cdatetime_test_clock_gettime_attempts_before_fail = -1;
+	}
+#else
+	/* Test libcdatetime_timestamp_set_current_time with time failing
+	 */
+	cdatetime_test_time_attempts_before_fail = 0;
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	if( cdatetime_test_time_attempts_before_fail != -1 )
+	{
+		cdatetime_test_time_attempts_before_fail = -1;
+	}
+#endif /* defined( HAVE_CLOCK_GETTIME ) */
+	else
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+	}
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __CYGWIN__ ) */
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	if( second_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &second_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_get_delta_in_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_get_delta_in_seconds(
+     void )
+{
+	libcdatetime_timestamp_t *first_timestamp  = NULL;
+	libcdatetime_timestamp_t *second_timestamp = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t number_of_seconds                  = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_get_delta_in_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_seconds(
+	          second_timestamp,
+	          first_timestamp,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI )
+
+	/* Test that the fraction of a second is truncated
+	 */
+	( (libcdatetime_internal_timestamp_t *) first_timestamp )->nano_seconds  = 500000000LL;
+	( (libcdatetime_internal_timestamp_t *) second_timestamp )->nano_seconds = -1500000000LL;
+
+	result = libcdatetime_timestamp_get_delta_in_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 2 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libcdatetime_internal_timestamp_t *) first_timestamp )->nano_seconds  = -500000000LL;
+	( (libcdatetime_internal_timestamp_t *) second_timestamp )->nano_seconds = 1400000000LL;
+
+	result = libcdatetime_timestamp_get_delta_in_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_get_delta_in_seconds(
+	          NULL,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_delta_in_seconds(
+	          first_timestamp,
+	          NULL,
+	          &number_of_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_delta_in_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &second_timestamp,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &first_timestamp,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &second_timestamp,
+		 NULL );
+	}
+	if( first_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &first_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_get_delta_in_seconds_and_nano_seconds(
+     void )
+{
+	libcdatetime_timestamp_t *first_timestamp  = NULL;
+	libcdatetime_timestamp_t *second_timestamp = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t number_of_seconds                  = 0;
+	int32_t nano_seconds                       = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "nano_seconds",
+	 nano_seconds,
+	 0 );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI )
+
+	/* Test that the fraction of a second has the same sign as the seconds
+	 */
+	( (libcdatetime_internal_timestamp_t *) first_timestamp )->nano_seconds  = 500000000LL;
+	( (libcdatetime_internal_timestamp_t *) second_timestamp )->nano_seconds = -1500000000LL;
+
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "nano_seconds",
+	 nano_seconds,
+	 0 );
+
+	( (libcdatetime_internal_timestamp_t *) first_timestamp )->nano_seconds  = -500000000LL;
+	( (libcdatetime_internal_timestamp_t *) second_timestamp )->nano_seconds = 1400000000LL;
+
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) -1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "nano_seconds",
+	 nano_seconds,
+	 -900000000 );
+
+	( (libcdatetime_internal_timestamp_t *) first_timestamp )->nano_seconds  = 2500000000LL;
+	( (libcdatetime_internal_timestamp_t *) second_timestamp )->nano_seconds = 0;
+
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "nano_seconds",
+	 nano_seconds,
+	 500000000 );
+
+	( (libcdatetime_internal_timestamp_t *) first_timestamp )->nano_seconds  = (int64_t) INT64_MAX;
+	( (libcdatetime_internal_timestamp_t *) second_timestamp )->nano_seconds = (int64_t) INT64_MIN;
+
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_seconds",
+	 number_of_seconds,
+	 (int64_t) 18446744073 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "nano_seconds",
+	 nano_seconds,
+	 709551615 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          NULL,
+	          second_timestamp,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          first_timestamp,
+	          NULL,
+	          &number_of_seconds,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          NULL,
+	          &nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_seconds,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &second_timestamp,
+		 NULL );
+	}
+	if( first_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &first_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_get_delta_in_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_get_delta_in_nano_seconds(
+     void )
+{
+	libcdatetime_timestamp_t *first_timestamp  = NULL;
+	libcdatetime_timestamp_t *second_timestamp = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t number_of_nano_seconds             = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          second_timestamp,
+	          first_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI )
+
+	( (libcdatetime_internal_timestamp_t *) first_timestamp )->nano_seconds  = 1500000000LL;
+	( (libcdatetime_internal_timestamp_t *) second_timestamp )->nano_seconds = -500000001LL;
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 2000000001LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          second_timestamp,
+	          first_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) -2000000001LL );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI ) */
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          NULL,
+	          second_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          first_timestamp,
+	          NULL,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI )
+
+	/* Test error case where the delta exceeds the 64-bit range
+	 */
+	( (libcdatetime_internal_timestamp_t *) first_timestamp )->nano_seconds  = 9223372035999999999LL;
+	( (libcdatetime_internal_timestamp_t *) second_timestamp )->nano_seconds = -1000000000LL;
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          first_timestamp,
+	          second_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI ) */
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &second_timestamp,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &first_timestamp,
+	          NULL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &second_timestamp,
+		 NULL );
+	}
+	if( first_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &first_timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_copy_to_elements_utc function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_copy_to_elements_utc(
+     void )
+{
+	libcdatetime_elements_t *elements          = NULL;
+	libcdatetime_timestamp_t *copied_timestamp = NULL;
+	libcdatetime_timestamp_t *timestamp        = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t fixed_time                         = 1645557742123000000LL;
+	int64_t number_of_nano_seconds             = 0;
+	uint16_t milli_seconds                     = 0;
+	uint16_t year                              = 0;
+	uint8_t day_of_month                       = 0;
+	uint8_t hours                              = 0;
+	uint8_t minutes                            = 0;
+	uint8_t month                              = 0;
+	uint8_t seconds                            = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_utc(
+	          timestamp,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_date_values(
+	          elements,
+	          &year,
+	          &month,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "year",
+	 year,
+	 2022 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "month",
+	 month,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 22 );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 19 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 22 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_milli_seconds(
+	          elements,
+	          &milli_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "milli_seconds",
+	 milli_seconds,
+	 123 );
+
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          copied_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_utc(
+	          NULL,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_utc(
+	          timestamp,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	if( copied_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &copied_timestamp,
+		 NULL );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_copy_to_elements_localtime function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_copy_to_elements_localtime(
+     void )
+{
+	libcdatetime_elements_t *elements          = NULL;
+	libcdatetime_timestamp_t *copied_timestamp = NULL;
+	libcdatetime_timestamp_t *timestamp        = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t fixed_time                         = 1645557742123000000LL;
+	int64_t number_of_nano_seconds             = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_localtime(
+	          timestamp,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the localtime converts back to the same timestamp
+	 */
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          copied_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_localtime(
+	          NULL,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_localtime(
+	          timestamp,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	if( copied_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &copied_timestamp,
+		 NULL );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_copy_to_elements_with_utc_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_copy_to_elements_with_utc_offset(
+     void )
+{
+	libcdatetime_elements_t *elements          = NULL;
+	libcdatetime_timestamp_t *copied_timestamp = NULL;
+	libcdatetime_timestamp_t *timestamp        = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t fixed_time                         = 1645557742123000000LL;
+	int64_t number_of_nano_seconds             = 0;
+	int result                                 = 0;
+	uint8_t day_of_month                       = 0;
+	uint8_t hours                              = 0;
+	uint8_t minutes                            = 0;
+	uint8_t seconds                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_with_utc_offset(
+	          timestamp,
+	          -600,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 9 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 22 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_day_of_month(
+	          elements,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 22 );
+
+	/* Test that the date and time with the UTC offset converts back to the same timestamp
+	 */
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          copied_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_with_utc_offset(
+	          NULL,
+	          -600,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_with_utc_offset(
+	          timestamp,
+	          1440,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_with_utc_offset(
+	          timestamp,
+	          -600,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	if( copied_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &copied_timestamp,
+		 NULL );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_copy_to_elements_in_timezone function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_copy_to_elements_in_timezone(
+     void )
+{
+	libcdatetime_elements_t *elements          = NULL;
+	libcdatetime_timestamp_t *copied_timestamp = NULL;
+	libcdatetime_timestamp_t *timestamp        = NULL;
+	libcdatetime_timezone_t *timezone          = NULL;
+	libcerror_error_t *error                   = NULL;
+	int64_t fixed_time                         = 1645557742123000000LL;
+	int64_t number_of_nano_seconds             = 0;
+	int result                                 = 0;
+	uint8_t day_of_month                       = 0;
+	uint8_t hours                              = 0;
+	uint8_t minutes                            = 0;
+	uint8_t seconds                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_initialize(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timestamp_timezone_data1,
+	          54,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_in_timezone(
+	          timestamp,
+	          timezone,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_get_time_values(
+	          elements,
+	          &hours,
+	          &minutes,
+	          &seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "hours",
+	 hours,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "minutes",
+	 minutes,
+	 52 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "seconds",
+	 seconds,
+	 22 );
+
+	result = libcdatetime_elements_get_day_of_month(
+	          elements,
+	          &day_of_month,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "day_of_month",
+	 day_of_month,
+	 23 );
+
+	/* Test that the date and time in the timezone converts back to the same timestamp
+	 */
+	result = libcdatetime_elements_copy_to_timestamp(
+	          elements,
+	          copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          timestamp,
+	          copied_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_in_timezone(
+	          NULL,
+	          timezone,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_in_timezone(
+	          timestamp,
+	          NULL,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_in_timezone(
+	          timestamp,
+	          timezone,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_free(
+	          &elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements",
+	 elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	if( elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &elements,
+		 NULL );
+	}
+	if( copied_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &copied_timestamp,
+		 NULL );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_copy_to_elements_in_timezones function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_copy_to_elements_in_timezones(
+     void )
+{
+	libcdatetime_elements_t *elements[ 5 ]       = { NULL, NULL, NULL, NULL, NULL };
+	libcdatetime_elements_t *expected_elements   = NULL;
+	libcdatetime_timestamp_t *copied_timestamp   = NULL;
+	libcdatetime_timestamp_t *timestamp          = NULL;
+	libcdatetime_timezone_t *timezones[ 5 ]      = { NULL, NULL, NULL, NULL, NULL };
+	libcerror_error_t *error                     = NULL;
+	int64_t fixed_time                           = 0;
+	int64_t number_of_nano_seconds               = 0;
+	int result                                   = 0;
+	int test_number                              = 0;
+	int timezone_index                           = 0;
+	uint16_t expected_nano_seconds               = 0;
+	uint16_t expected_year                       = 0;
+	uint16_t nano_seconds                        = 0;
+	uint16_t year                                = 0;
+	uint8_t day_of_month                         = 0;
+	uint8_t expected_day_of_month                = 0;
+	uint8_t expected_hours                       = 0;
+	uint8_t expected_minutes                     = 0;
+	uint8_t expected_month                       = 0;
+	uint8_t expected_seconds                     = 0;
+	uint8_t hours                                = 0;
+	uint8_t minutes                              = 0;
+	uint8_t month                                = 0;
+	uint8_t seconds                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_elements_initialize(
+	          &expected_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_elements",
+	 expected_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first timezone is the system timezone
+	 */
+	for( timezone_index = 0;
+	     timezone_index < 5;
+	     timezone_index++ )
+	{
+		result = libcdatetime_elements_initialize(
+		          &elements[ timezone_index ],
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+		 "elements[ timezone_index ]",
+		 elements[ timezone_index ] );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 1 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 1 ]",
+	 timezones[ 1 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezones[ 1 ],
+	          "UTC0",
+	          5,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 2 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 2 ]",
+	 timezones[ 2 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezones[ 2 ],
+	          "IST-5:30",
+	          9,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 3 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 3 ]",
+	 timezones[ 3 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezones[ 3 ],
+	          "HST10",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 4 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 4 ]",
+	 timezones[ 4 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezones[ 4 ],
+	          "LINT-14",
+	          8,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The times cross the end of a year and a leap day in every timezone
+	 */
+	for( test_number = 0;
+	     test_number < 64;
+	     test_number++ )
+	{
+		if( test_number < 32 )
+		{
+			fixed_time = 1703980800123456789LL;
+		}
+		else
+		{
+			fixed_time = 1709078400987654321LL;
+		}
+		fixed_time += (int64_t) ( test_number % 32 ) * 11220LL * 1000000000LL;
+
+		result = libcdatetime_timestamp_set_current_time(
+		          timestamp,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdatetime_timestamp_copy_to_elements_in_timezones(
+		          timestamp,
+		          timezones,
+		          5,
+		          elements,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( timezone_index = 0;
+		     timezone_index < 5;
+		     timezone_index++ )
+		{
+			if( timezone_index == 0 )
+			{
+					result = libcdatetime_timestamp_copy_to_elements_localtime(
+					          timestamp,
+					          expected_elements,
+					          &error );
+
+					CDATETIME_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 1 );
+
+					CDATETIME_TEST_ASSERT_IS_NULL(
+					 "error",
+					 error );
+
+			}
+			else
+			{
+					result = libcdatetime_timestamp_copy_to_elements_in_timezone(
+					          timestamp,
+					          timezones[ timezone_index ],
+					          expected_elements,
+					          &error );
+
+					CDATETIME_TEST_ASSERT_EQUAL_INT(
+					 "result",
+					 result,
+					 1 );
+
+					CDATETIME_TEST_ASSERT_IS_NULL(
+					 "error",
+					 error );
+
+			}
+			result = libcdatetime_elements_get_date_values(
+			          elements[ timezone_index ],
+			          &year,
+			          &month,
+			          &day_of_month,
+			          &error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcdatetime_elements_get_date_values(
+			          expected_elements,
+			          &expected_year,
+			          &expected_month,
+			          &expected_day_of_month,
+			          &error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+			 "year",
+			 year,
+			 expected_year );
+
+			CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+			 "month",
+			 month,
+			 expected_month );
+
+			CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+			 "day_of_month",
+			 day_of_month,
+			 expected_day_of_month );
+
+			result = libcdatetime_elements_get_time_values(
+			          elements[ timezone_index ],
+			          &hours,
+			          &minutes,
+			          &seconds,
+			          &error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcdatetime_elements_get_time_values(
+			          expected_elements,
+			          &expected_hours,
+			          &expected_minutes,
+			          &expected_seconds,
+			          &error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+			 "hours",
+			 hours,
+			 expected_hours );
+
+			CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+			 "minutes",
+			 minutes,
+			 expected_minutes );
+
+			CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+			 "seconds",
+			 seconds,
+			 expected_seconds );
+
+			result = libcdatetime_elements_get_nano_seconds(
+			          elements[ timezone_index ],
+			          &nano_seconds,
+			          &error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcdatetime_elements_get_nano_seconds(
+			          expected_elements,
+			          &expected_nano_seconds,
+			          &error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+			 "nano_seconds",
+			 nano_seconds,
+			 expected_nano_seconds );
+
+			/* Test that the date and time in the timezone converts back to the same timestamp
+			 */
+			result = libcdatetime_elements_copy_to_timestamp(
+			          elements[ timezone_index ],
+			          copied_timestamp,
+			          &error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+			          timestamp,
+			          copied_timestamp,
+			          &number_of_nano_seconds,
+			          &error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			CDATETIME_TEST_ASSERT_EQUAL_INT64(
+			 "number_of_nano_seconds",
+			 number_of_nano_seconds,
+			 (int64_t) 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_copy_to_elements_in_timezones(
+	          NULL,
+	          timezones,
+	          5,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_in_timezones(
+	          timestamp,
+	          NULL,
+	          5,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_in_timezones(
+	          timestamp,
+	          timezones,
+	          (size_t) SSIZE_MAX,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_elements_in_timezones(
+	          timestamp,
+	          timezones,
+	          5,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcdatetime_timestamp_copy_to_elements_in_timezones with missing elements
+	 */
+	result = libcdatetime_elements_free(
+	          &elements[ 4 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "elements[ 4 ]",
+	 elements[ 4 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_copy_to_elements_in_timezones(
+	          timestamp,
+	          timezones,
+	          5,
+	          elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( timezone_index = 1;
+	     timezone_index < 5;
+	     timezone_index++ )
+	{
+		result = libcdatetime_timezone_free(
+		          &timezones[ timezone_index ],
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "timezones[ timezone_index ]",
+		 timezones[ timezone_index ] );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	for( timezone_index = 0;
+	     timezone_index < 4;
+	     timezone_index++ )
+	{
+		result = libcdatetime_elements_free(
+		          &elements[ timezone_index ],
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "elements[ timezone_index ]",
+		 elements[ timezone_index ] );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	result = libcdatetime_elements_free(
+	          &expected_elements,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "expected_elements",
+	 expected_elements );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &copied_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "copied_timestamp",
+	 copied_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( timezone_index = 0;
+	     timezone_index < 5;
+	     timezone_index++ )
+	{
+		if( timezones[ timezone_index ] != NULL )
+		{
+			libcdatetime_timezone_free(
+			 &( timezones[ timezone_index ] ),
+			 NULL );
+		}
+		if( elements[ timezone_index ] != NULL )
+		{
+			libcdatetime_elements_free(
+			 &( elements[ timezone_index ] ),
+			 NULL );
+		}
+	}
+	if( expected_elements != NULL )
+	{
+		libcdatetime_elements_free(
+		 &expected_elements,
+		 NULL );
+	}
+	if( copied_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &copied_timestamp,
+		 NULL );
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_get_string_size_in_timezones function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_get_string_size_in_timezones(
+     void )
+{
+	uint8_t strings[ 2 * 39 ];
+
+	libcdatetime_timestamp_t *timestamp     = NULL;
+	libcdatetime_timezone_t *timezones[ 2 ] = { NULL, NULL };
+	libcerror_error_t *error                = NULL;
+	size_t string_size                      = 0;
+	int64_t fixed_time                      = 1700000000123456789LL;
+	int result                              = 0;
+	int timezone_index                      = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 0 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 0 ]",
+	 timezones[ 0 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezones[ 0 ],
+	          "IST-5:30",
+	          9,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 1 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 1 ]",
+	 timezones[ 1 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezones[ 1 ],
+	          "LMT-0:30:17",
+	          12,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Test that strings of the ISO 8601 date and time in the UTC offset of
+	 * a timezone fit in a buffer of exactly the string size
+	 */
+	result = libcdatetime_timestamp_get_string_size_in_timezones(
+	          timestamp,
+	          &string_size,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 29 );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          2,
+	          strings,
+	          string_size,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( strings[ 0 ] ),
+	          "2023-11-15T03:43:20+05:30",
+	          26 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( strings[ 29 ] ),
+	          "2023-11-14T22:43:37+00:30:17",
+	          29 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that strings of the ctime date and time in the UTC offset of
+	 * a timezone fit in a buffer of exactly the string size
+	 */
+	result = libcdatetime_timestamp_get_string_size_in_timezones(
+	          timestamp,
+	          &string_size,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 35 );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          2,
+	          strings,
+	          string_size,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( strings[ 0 ] ),
+	          "Nov 15, 2023 03:43:20 UTC+05:30",
+	          32 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( strings[ 35 ] ),
+	          "Nov 14, 2023 22:43:37 UTC+00:30:17",
+	          35 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that strings of the ISO 8601 date and time with nano seconds in the UTC offset of
+	 * a timezone fit in a buffer of exactly the string size
+	 */
+	result = libcdatetime_timestamp_get_string_size_in_timezones(
+	          timestamp,
+	          &string_size,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 39 );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          2,
+	          strings,
+	          string_size,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS | LIBCDATETIME_STRING_FORMAT_FLAG_TIMEZONE_INDICATOR,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( strings[ 0 ] ),
+	          "2023-11-15T03:43:20.123456789+05:30",
+	          36 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( strings[ 39 ] ),
+	          "2023-11-14T22:43:37.123456789+00:30:17",
+	          39 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_get_string_size_in_timezones(
+	          NULL,
+	          &string_size,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_string_size_in_timezones(
+	          timestamp,
+	          NULL,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_CTIME | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_get_string_size_in_timezones(
+	          timestamp,
+	          &string_size,
+	          0xffffffffUL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( timezone_index = 0;
+	     timezone_index < 2;
+	     timezone_index++ )
+	{
+		result = libcdatetime_timezone_free(
+		          &timezones[ timezone_index ],
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "timezones[ timezone_index ]",
+		 timezones[ timezone_index ] );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( timezone_index = 0;
+	     timezone_index < 2;
+	     timezone_index++ )
+	{
+		if( timezones[ timezone_index ] != NULL )
+		{
+			libcdatetime_timezone_free(
+			 &( timezones[ timezone_index ] ),
+			 NULL );
+		}
+	}
+	if( timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &timestamp,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_copy_to_strings_in_timezones function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_copy_to_strings_in_timezones(
+     void )
+{
+	uint8_t strings[ 3 * 32 ];
+
+	libcdatetime_timestamp_t *timestamp     = NULL;
+	libcdatetime_timezone_t *timezones[ 3 ] = { NULL, NULL, NULL };
+	libcerror_error_t *error                = NULL;
+	int64_t fixed_time                      = 1645557742123000000LL;
+	int result                              = 0;
+	int timezone_index                      = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_initialize(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_clock_callback(
+	          timestamp,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_set_current_time(
+	          timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 0 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 0 ]",
+	 timezones[ 0 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezones[ 0 ],
+	          "UTC0",
+	          5,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 1 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 1 ]",
+	 timezones[ 1 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezones[ 1 ],
+	          cdatetime_test_timestamp_timezone_data1,
+	          54,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezones[ 2 ],
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezones[ 2 ]",
+	 timezones[ 2 ] );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezones[ 2 ],
+	          "HST10",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          3,
+	          strings,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( strings[ 0 ] ),
+	          "2022-02-22T19:22:22.123",
+	          24 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( strings[ 32 ] ),
+	          "2022-02-23T00:52:22.123",
+	          24 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( strings[ 64 ] ),
+	          "2022-02-22T09:22:22.123",
+	          24 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          NULL,
+	          timezones,
+	          3,
+	          strings,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          NULL,
+	          3,
+	          strings,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          (size_t) SSIZE_MAX,
+	          strings,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          3,
+	          NULL,
+	          32,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          3,
+	          strings,
+	          0,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          3,
+	          strings,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          3,
+	          strings,
+	          8,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_copy_to_strings_in_timezones(
+	          timestamp,
+	          timezones,
+	          3,
+	          strings,
+	          32,
+	          0xffffffffUL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( timezone_index = 0;
+	     timezone_index < 3;
+	     timezone_index++ )
+	{
+		result = libcdatetime_timezone_free(
+		          &timezones[ timezone_index ],
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "timezones[ timezone_index ]",
+		 timezones[ timezone_index ] );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	result = libcdatetime_timestamp_free(
+	          &timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp",
+	 timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -901,16 +5120,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( second_timestamp != NULL )
+	for( timezone_index = 0;
+	     timezone_index < 3;
+	     timezone_index++ )
 	{
-		libcdatetime_timestamp_free(
-		 &second_timestamp,
-		 NULL );
+		if( timezones[ timezone_index ] != NULL )
+		{
+			libcdatetime_timezone_free(
+			 &( timezones[ timezone_index ] ),
+			 NULL );
+		}
 	}
-	if( first_timestamp != NULL )
+	if( timestamp != NULL )
 	{
 		libcdatetime_timestamp_free(
-		 &first_timestamp,
+		 &timestamp,
 		 NULL );
 	}
 	return( 0 );
@@ -1245,6 +5469,74 @@ int cdatetime_test_timestamp_copy_to_string_with_index(
 	 "error",
 	 error );
 
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI )
+
+	( (libcdatetime_internal_timestamp_t *) timestamp )->nano_seconds = 1234567891LL;
+
+	string_index = 0;
+
+	result = libcdatetime_timestamp_copy_to_string_with_index(
+	          timestamp,
+	          string,
+	          64,
+	          &string_index,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "1970-01-01T00:00:01.234567891",
+	          30 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	( (libcdatetime_internal_timestamp_t *) timestamp )->nano_seconds = -1LL;
+
+	string_index = 0;
+
+	result = libcdatetime_timestamp_copy_to_string_with_index(
+	          timestamp,
+	          string,
+	          64,
+	          &string_index,
+	          LIBCDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBCDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "1969-12-31T23:59:59.999999999",
+	          30 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	( (libcdatetime_internal_timestamp_t *) timestamp )->nano_seconds = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) && !defined( WINAPI ) */
+
 	/* Test error cases
 	 */
 	result = libcdatetime_timestamp_copy_to_string_with_index(
@@ -1421,6 +5713,14 @@ int main(
 	 "libcdatetime_timestamp_copy",
 	 cdatetime_test_timestamp_copy );
 
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_set_clock_source",
+	 cdatetime_test_timestamp_set_clock_source );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_set_clock_callback",
+	 cdatetime_test_timestamp_set_clock_callback );
+
 	CDATETIME_TEST_RUN(
 	 "libcdatetime_timestamp_set_current_time",
 	 cdatetime_test_timestamp_set_current_time );
@@ -1429,6 +5729,42 @@ int main(
 	 "libcdatetime_timestamp_get_delta_in_seconds",
 	 cdatetime_test_timestamp_get_delta_in_seconds );
 
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_get_delta_in_seconds_and_nano_seconds",
+	 cdatetime_test_timestamp_get_delta_in_seconds_and_nano_seconds );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_get_delta_in_nano_seconds",
+	 cdatetime_test_timestamp_get_delta_in_nano_seconds );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_copy_to_elements_utc",
+	 cdatetime_test_timestamp_copy_to_elements_utc );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_copy_to_elements_localtime",
+	 cdatetime_test_timestamp_copy_to_elements_localtime );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_copy_to_elements_with_utc_offset",
+	 cdatetime_test_timestamp_copy_to_elements_with_utc_offset );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_copy_to_elements_in_timezone",
+	 cdatetime_test_timestamp_copy_to_elements_in_timezone );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_copy_to_elements_in_timezones",
+	 cdatetime_test_timestamp_copy_to_elements_in_timezones );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_get_string_size_in_timezones",
+	 cdatetime_test_timestamp_get_string_size_in_timezones );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_copy_to_strings_in_timezones",
+	 cdatetime_test_timestamp_copy_to_strings_in_timezones );
+
 	CDATETIME_TEST_RUN(
 	 "libcdatetime_timestamp_get_string_size",
 	 cdatetime_test_timestamp_get_string_size );
@@ -0,0 +1,1898 @@
+/*
+ * Library timestamp_generator type test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_timestamp_generator.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+#define CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_THREADS	4
+#define CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_VALUES	10000
+
+typedef struct cdatetime_test_timestamp_generator_thread_values cdatetime_test_timestamp_generator_thread_values_t;
+
+struct cdatetime_test_timestamp_generator_thread_values
+{
+	/* The timestamp generator
+	 */
+	libcdatetime_timestamp_generator_t *timestamp_generator;
+
+	/* The number of values that were not strictly increasing
+	 */
+	int number_of_errors;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
+/* Clock that returns the time stored in the callback data for testing
+ * Returns 1 if successful or -1 on error
+ */
+int cdatetime_test_fixed_clock(
+     intptr_t *callback_data,
+     int64_t *posix_time_in_nano_seconds,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( callback_data == NULL )
+	 || ( posix_time_in_nano_seconds == NULL ) )
+	{
+		return( -1 );
+	}
+	*posix_time_in_nano_seconds = *( (int64_t *) callback_data );
+
+	return( 1 );
+}
+
+/* Clock that fails for testing
+ * Returns -1
+ */
+int cdatetime_test_failing_clock(
+     intptr_t *callback_data CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     int64_t *posix_time_in_nano_seconds CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error CDATETIME_TEST_ATTRIBUTE_UNUSED )
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( callback_data )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( posix_time_in_nano_seconds )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( -1 );
+}
+
+/* Tests the libcdatetime_timestamp_generator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_initialize(
+     void )
+{
+	libcdatetime_timestamp_generator_t *timestamp_generator = NULL;
+	libcerror_error_t *error                                = NULL;
+	int result                                              = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests                         = 1;
+	int number_of_memset_fail_tests                         = 1;
+	int test_number                                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_free(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timestamp_generator = (libcdatetime_timestamp_generator_t *) 0x12345678UL;
+
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	timestamp_generator = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_timestamp_generator_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_timestamp_generator_initialize(
+		          &timestamp_generator,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( timestamp_generator != NULL )
+			{
+				libcdatetime_timestamp_generator_free(
+				 &timestamp_generator,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "timestamp_generator",
+			 timestamp_generator );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_timestamp_generator_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_timestamp_generator_initialize(
+		          &timestamp_generator,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( timestamp_generator != NULL )
+			{
+				libcdatetime_timestamp_generator_free(
+				 &timestamp_generator,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "timestamp_generator",
+			 timestamp_generator );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_generator != NULL )
+	{
+		libcdatetime_timestamp_generator_free(
+		 &timestamp_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_generator_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_generator_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_generator_set_clock_source function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_set_clock_source(
+     void )
+{
+	libcdatetime_timestamp_generator_t *timestamp_generator = NULL;
+	libcerror_error_t *error                                = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_generator_set_clock_source(
+	          timestamp_generator,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME_COARSE,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_generator_set_clock_source(
+	          NULL,
+	          LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_set_clock_source(
+	          timestamp_generator,
+	          LIBCDATETIME_CLOCK_SOURCE_MONOTONIC,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_generator_free(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_generator != NULL )
+	{
+		libcdatetime_timestamp_generator_free(
+		 &timestamp_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_generator_set_clock_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_set_clock_callback(
+     void )
+{
+	libcdatetime_timestamp_generator_t *timestamp_generator = NULL;
+	libcerror_error_t *error                                = NULL;
+	int64_t fixed_time                                      = 1000;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          NULL,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          NULL,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_generator_free(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_generator != NULL )
+	{
+		libcdatetime_timestamp_generator_free(
+		 &timestamp_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_get_next_posix_time_in_nano_seconds(
+     void )
+{
+	libcdatetime_timestamp_generator_t *timestamp_generator = NULL;
+	libcerror_error_t *error                                = NULL;
+	int64_t fixed_time                                      = 1000;
+	int64_t posix_time_in_nano_seconds                      = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the value increases when the clock goes backwards
+	 */
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "fixed_time",
+	 fixed_time,
+	 posix_time_in_nano_seconds + LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the value increases when the clock does not advance
+	 */
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 fixed_time + LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the value follows the clock when the clock advances
+	 */
+	fixed_time += 1000000000LL;
+
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 fixed_time );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          NULL,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_failing_clock,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	/* Test error case where the next value would overflow
+	 */
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libcdatetime_internal_timestamp_generator_t *) timestamp_generator )->last_posix_time_in_nano_seconds = (int64_t) INT64_MAX;
+
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_generator_free(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_generator != NULL )
+	{
+		libcdatetime_timestamp_generator_free(
+		 &timestamp_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_get_next_posix_times_in_nano_seconds(
+     void )
+{
+	libcdatetime_timestamp_generator_t *timestamp_generator = NULL;
+	libcerror_error_t *error                                = NULL;
+	int64_t posix_times_in_nano_seconds[ 4 ];
+	int64_t fixed_time                                      = 1000000000LL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          4,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 0 ]",
+	 posix_times_in_nano_seconds[ 0 ],
+	 fixed_time );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 3 ]",
+	 posix_times_in_nano_seconds[ 3 ],
+	 fixed_time + ( 3 * LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION ) );
+
+	/* Test that the values of a batch follow the previous batch when the clock does not advance
+	 */
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          4,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 0 ]",
+	 posix_times_in_nano_seconds[ 0 ],
+	 fixed_time + ( 4 * LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION ) );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 3 ]",
+	 posix_times_in_nano_seconds[ 3 ],
+	 fixed_time + ( 7 * LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION ) );
+
+	/* Test that the values are spread between the previous batch and the current time
+	 */
+	fixed_time = posix_times_in_nano_seconds[ 3 ] + 4000000LL;
+
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          4,
+	          LIBCDATETIME_TIMESTAMP_GENERATOR_FLAG_INTERPOLATE,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 0 ]",
+	 posix_times_in_nano_seconds[ 0 ],
+	 fixed_time - (int64_t) 3000000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 1 ]",
+	 posix_times_in_nano_seconds[ 1 ],
+	 fixed_time - (int64_t) 2000000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 3 ]",
+	 posix_times_in_nano_seconds[ 3 ],
+	 fixed_time );
+
+	/* Test that the values are spread across at most the maximum interpolation span after an idle period
+	 */
+	fixed_time = posix_times_in_nano_seconds[ 3 ] + 60000000000LL;
+
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          4,
+	          LIBCDATETIME_TIMESTAMP_GENERATOR_FLAG_INTERPOLATE,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 0 ]",
+	 posix_times_in_nano_seconds[ 0 ],
+	 fixed_time - (int64_t) 750000000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_times_in_nano_seconds[ 3 ]",
+	 posix_times_in_nano_seconds[ 3 ],
+	 fixed_time );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          NULL,
+	          posix_times_in_nano_seconds,
+	          4,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          NULL,
+	          4,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          0,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          (size_t) SSIZE_MAX,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          4,
+	          0xff,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	/* Test error case where the values of the batch would overflow
+	 */
+	( (libcdatetime_internal_timestamp_generator_t *) timestamp_generator )->last_posix_time_in_nano_seconds = (int64_t) INT64_MAX - LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION;
+
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          4,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_failing_clock,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds(
+	          timestamp_generator,
+	          posix_times_in_nano_seconds,
+	          4,
+	          0,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_generator_free(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_generator != NULL )
+	{
+		libcdatetime_timestamp_generator_free(
+		 &timestamp_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+/* The start function of the threads that retrieve values from the timestamp generator
+ * Returns NULL
+ */
+void *cdatetime_test_timestamp_generator_thread_start_function(
+       void *arguments )
+{
+	cdatetime_test_timestamp_generator_thread_values_t *thread_values = NULL;
+	int64_t last_posix_time_in_nano_seconds                           = 0;
+	int64_t posix_time_in_nano_seconds                                = 0;
+	int value_index                                                   = 0;
+
+	thread_values = (cdatetime_test_timestamp_generator_thread_values_t *) arguments;
+
+	for( value_index = 0;
+	     value_index < CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_VALUES;
+	     value_index++ )
+	{
+		if( libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+		     thread_values->timestamp_generator,
+		     &posix_time_in_nano_seconds,
+		     NULL ) != 1 )
+		{
+			thread_values->number_of_errors += 1;
+		}
+		else if( ( value_index > 0 )
+		      && ( posix_time_in_nano_seconds <= last_posix_time_in_nano_seconds ) )
+		{
+			thread_values->number_of_errors += 1;
+		}
+		last_posix_time_in_nano_seconds = posix_time_in_nano_seconds;
+	}
+	return( NULL );
+}
+
+/* Tests the libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds function with multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_get_next_posix_time_in_nano_seconds_threaded(
+     void )
+{
+	cdatetime_test_timestamp_generator_thread_values_t thread_values[ CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_THREADS ];
+	pthread_t threads[ CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_THREADS ];
+
+	libcdatetime_timestamp_generator_t *timestamp_generator = NULL;
+	libcerror_error_t *error                                = NULL;
+	int64_t fixed_time                                      = 1000;
+	int64_t posix_time_in_nano_seconds                      = 0;
+	int number_of_threads                                   = 0;
+	int result                                              = 0;
+	int thread_index                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A clock that does not advance makes every value depend on the previous one
+	 */
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_values[ thread_index ].timestamp_generator = timestamp_generator;
+		thread_values[ thread_index ].number_of_errors    = 0;
+
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &cdatetime_test_timestamp_generator_thread_start_function,
+		          (void *) &( thread_values[ thread_index ] ) );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_threads++;
+	}
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		pthread_join(
+		 threads[ number_of_threads ],
+		 NULL );
+	}
+	for( thread_index = 0;
+	     thread_index < CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "thread_values[ thread_index ].number_of_errors",
+		 thread_values[ thread_index ].number_of_errors,
+		 0 );
+	}
+	/* Test that every value was handed out exactly once
+	 */
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time_in_nano_seconds",
+	 posix_time_in_nano_seconds,
+	 fixed_time + ( (int64_t) CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_THREADS * CDATETIME_TEST_TIMESTAMP_GENERATOR_NUMBER_OF_VALUES * LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION ) );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_generator_free(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		pthread_join(
+		 threads[ number_of_threads ],
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_generator != NULL )
+	{
+		libcdatetime_timestamp_generator_free(
+		 &timestamp_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
+/* Tests the libcdatetime_timestamp_generator_get_next_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_get_next_timestamp(
+     void )
+{
+	libcdatetime_timestamp_generator_t *timestamp_generator = NULL;
+	libcdatetime_timestamp_t *first_timestamp               = NULL;
+	libcdatetime_timestamp_t *second_timestamp              = NULL;
+	libcerror_error_t *error                                = NULL;
+	int64_t fixed_time                                      = 1404648000000000000LL;
+	int64_t number_of_nano_seconds                          = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_initialize(
+	          &second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_generator_get_next_timestamp(
+	          timestamp_generator,
+	          first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_get_next_timestamp(
+	          timestamp_generator,
+	          second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that successive timestamps differ while the clock does not advance
+	 */
+	result = libcdatetime_timestamp_get_delta_in_nano_seconds(
+	          second_timestamp,
+	          first_timestamp,
+	          &number_of_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_nano_seconds",
+	 number_of_nano_seconds,
+	 (int64_t) LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_generator_get_next_timestamp(
+	          NULL,
+	          first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_get_next_timestamp(
+	          timestamp_generator,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_free(
+	          &second_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "second_timestamp",
+	 second_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_free(
+	          &first_timestamp,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "first_timestamp",
+	 first_timestamp );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_free(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &second_timestamp,
+		 NULL );
+	}
+	if( first_timestamp != NULL )
+	{
+		libcdatetime_timestamp_free(
+		 &first_timestamp,
+		 NULL );
+	}
+	if( timestamp_generator != NULL )
+	{
+		libcdatetime_timestamp_generator_free(
+		 &timestamp_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timestamp_generator_get_drift_in_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timestamp_generator_get_drift_in_nano_seconds(
+     void )
+{
+	libcdatetime_timestamp_generator_t *timestamp_generator = NULL;
+	libcerror_error_t *error                                = NULL;
+	int64_t drift_in_nano_seconds                           = 0;
+	int64_t fixed_time                                      = 5000;
+	int64_t posix_time_in_nano_seconds                      = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timestamp_generator_initialize(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_set_clock_callback(
+	          timestamp_generator,
+	          &cdatetime_test_fixed_clock,
+	          (intptr_t *) &fixed_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timestamp_generator_get_drift_in_nano_seconds(
+	          timestamp_generator,
+	          &drift_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "drift_in_nano_seconds",
+	 drift_in_nano_seconds,
+	 (int64_t) 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds(
+	          timestamp_generator,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the drift after the clock was set backwards
+	 */
+	fixed_time = 1000;
+
+	result = libcdatetime_timestamp_generator_get_drift_in_nano_seconds(
+	          timestamp_generator,
+	          &drift_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "drift_in_nano_seconds",
+	 drift_in_nano_seconds,
+	 (int64_t) 4000 + LIBCDATETIME_TIMESTAMP_GENERATOR_RESOLUTION );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timestamp_generator_get_drift_in_nano_seconds(
+	          NULL,
+	          &drift_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timestamp_generator_get_drift_in_nano_seconds(
+	          timestamp_generator,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timestamp_generator_free(
+	          &timestamp_generator,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timestamp_generator",
+	 timestamp_generator );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_generator != NULL )
+	{
+		libcdatetime_timestamp_generator_free(
+		 &timestamp_generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_initialize",
+	 cdatetime_test_timestamp_generator_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_free",
+	 cdatetime_test_timestamp_generator_free );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_set_clock_source",
+	 cdatetime_test_timestamp_generator_set_clock_source );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_set_clock_callback",
+	 cdatetime_test_timestamp_generator_set_clock_callback );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds",
+	 cdatetime_test_timestamp_generator_get_next_posix_time_in_nano_seconds );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_get_next_posix_times_in_nano_seconds",
+	 cdatetime_test_timestamp_generator_get_next_posix_times_in_nano_seconds );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_get_next_posix_time_in_nano_seconds (threaded)",
+	 cdatetime_test_timestamp_generator_get_next_posix_time_in_nano_seconds_threaded );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_get_next_timestamp",
+	 cdatetime_test_timestamp_generator_get_next_timestamp );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timestamp_generator_get_drift_in_nano_seconds",
+	 cdatetime_test_timestamp_generator_get_drift_in_nano_seconds );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
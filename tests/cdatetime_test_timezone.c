@@ -0,0 +1,5452 @@
+/*
+ * Library timezone type test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_timezone.h"
+
+/* TZif version 2 data with the 2021 daylight saving time transitions of CET
+ * and the footer: CET-1CEST,M3.5.0,M10.5.0/3
+ */
+uint8_t cdatetime_test_timezone_data1[ 186 ] = {
+	0x54, 0x5a, 0x69, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x60, 0x5f, 0xd5, 0x10,
+	0x61, 0x7d, 0xea, 0x90, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20,
+	0x01, 0x04, 0x43, 0x45, 0x54, 0x00, 0x43, 0x45, 0x53, 0x54, 0x00, 0x54, 0x5a, 0x69, 0x66, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x60, 0x5f, 0xd5, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x61, 0x7d, 0xea, 0x90, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x1c, 0x20, 0x01, 0x04, 0x43, 0x45, 0x54, 0x00, 0x43, 0x45, 0x53, 0x54, 0x00, 0x0a, 0x43,
+	0x45, 0x54, 0x2d, 0x31, 0x43, 0x45, 0x53, 0x54, 0x2c, 0x4d, 0x33, 0x2e, 0x35, 0x2e, 0x30, 0x2c,
+	0x4d, 0x31, 0x30, 0x2e, 0x35, 0x2e, 0x30, 0x2f, 0x33, 0x0a };
+
+/* Windows REG_TZI_FORMAT data of W. Europe Standard Time
+ */
+uint8_t cdatetime_test_timezone_time_zone_information_data1[ 44 ] = {
+	0xc4, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0a, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Windows TIME_ZONE_INFORMATION data of W. Europe Standard Time
+ */
+uint8_t cdatetime_test_timezone_time_zone_information_data2[ 172 ] = {
+	0xc4, 0xff, 0xff, 0xff, 0x57, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x45, 0x00, 0x75, 0x00, 0x72, 0x00,
+	0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6e, 0x00,
+	0x64, 0x00, 0x61, 0x00, 0x72, 0x00, 0x64, 0x00, 0x20, 0x00, 0x54, 0x00, 0x69, 0x00, 0x6d, 0x00,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x45, 0x00,
+	0x75, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x20, 0x00, 0x44, 0x00, 0x61, 0x00,
+	0x79, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x54, 0x00,
+	0x69, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff };
+
+/* Windows DYNAMIC_TIME_ZONE_INFORMATION data of W. Europe Standard Time
+ * with dynamic daylight saving time disabled
+ */
+uint8_t cdatetime_test_timezone_time_zone_information_data3[ 432 ] = {
+	0xc4, 0xff, 0xff, 0xff, 0x57, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x45, 0x00, 0x75, 0x00, 0x72, 0x00,
+	0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6e, 0x00,
+	0x64, 0x00, 0x61, 0x00, 0x72, 0x00, 0x64, 0x00, 0x20, 0x00, 0x54, 0x00, 0x69, 0x00, 0x6d, 0x00,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x45, 0x00,
+	0x75, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x20, 0x00, 0x44, 0x00, 0x61, 0x00,
+	0x79, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x54, 0x00,
+	0x69, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff, 0x57, 0x00, 0x2e, 0x00,
+	0x20, 0x00, 0x45, 0x00, 0x75, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65, 0x00, 0x20, 0x00,
+	0x53, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x61, 0x00, 0x72, 0x00, 0x64, 0x00,
+	0x20, 0x00, 0x54, 0x00, 0x69, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 };
+
+/* Tests the libcdatetime_timezone_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_initialize(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_initialize(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timezone = (libcdatetime_timezone_t *) 0x12345678UL;
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	timezone = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_timezone_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_timezone_initialize(
+		          &timezone,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( timezone != NULL )
+			{
+				libcdatetime_timezone_free(
+				 &timezone,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "timezone",
+			 timezone );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_timezone_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_timezone_initialize(
+		          &timezone,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( timezone != NULL )
+			{
+				libcdatetime_timezone_free(
+				 &timezone,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "timezone",
+			 timezone );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* Tests the libcdatetime_timezone_file_header_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_file_header_read_data(
+     void )
+{
+	libcdatetime_timezone_file_header_t file_header;
+	uint8_t data[ 44 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_file_header_read_data(
+	          &file_header,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "file_header.format_version",
+	 file_header.format_version,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header.number_of_transitions",
+	 file_header.number_of_transitions,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header.number_of_local_time_types",
+	 file_header.number_of_local_time_types,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header.abbreviations_size",
+	 file_header.abbreviations_size,
+	 9 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_file_header_read_data(
+	          NULL,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_file_header_read_data(
+	          &file_header,
+	          NULL,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_file_header_read_data(
+	          &file_header,
+	          cdatetime_test_timezone_data1,
+	          43,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	result = memory_copy(
+	          data,
+	          cdatetime_test_timezone_data1,
+	          44 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 0 ] = (uint8_t) 'X';
+
+	result = libcdatetime_timezone_file_header_read_data(
+	          &file_header,
+	          data,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported format version
+	 */
+	data[ 0 ] = (uint8_t) 'T';
+	data[ 4 ] = (uint8_t) '9';
+
+	result = libcdatetime_timezone_file_header_read_data(
+	          &file_header,
+	          data,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid number of local time types
+	 */
+	data[ 4 ]  = (uint8_t) '2';
+	data[ 39 ] = 0;
+
+	result = libcdatetime_timezone_file_header_read_data(
+	          &file_header,
+	          data,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_internal_timezone_find_local_time_type_index function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_internal_timezone_find_local_time_type_index(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	uint8_t local_time_type_index     = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "EST5EDT,M3.2.0,M11.1.0",
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_internal_timezone_find_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          -18000,
+	          0,
+	          "EST",
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "abbreviations_size",
+	 ( (libcdatetime_internal_timezone_t *) timezone )->abbreviations_size,
+	 (size_t) 8 );
+
+	result = libcdatetime_internal_timezone_find_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          -14400,
+	          1,
+	          "EDT",
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "abbreviations_size",
+	 ( (libcdatetime_internal_timezone_t *) timezone )->abbreviations_size,
+	 (size_t) 8 );
+
+	/* Test a local time type that is appended and that shares an abbreviation
+	 */
+	result = libcdatetime_internal_timezone_find_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          -14400,
+	          0,
+	          "EST",
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "abbreviations_size",
+	 ( (libcdatetime_internal_timezone_t *) timezone )->abbreviations_size,
+	 (size_t) 8 );
+
+	/* Test a local time type that is appended with its abbreviation
+	 */
+	result = libcdatetime_internal_timezone_find_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          0,
+	          0,
+	          "UTC",
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "abbreviations_size",
+	 ( (libcdatetime_internal_timezone_t *) timezone )->abbreviations_size,
+	 (size_t) 12 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_internal_timezone_find_local_time_type_index(
+	          NULL,
+	          0,
+	          0,
+	          "UTC",
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_find_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          0,
+	          0,
+	          NULL,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_find_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          0,
+	          0,
+	          "UTC",
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_internal_timezone_read_rule_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_internal_timezone_read_rule_string(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* The footer of the TZif data is read as rule string
+	 */
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "rule",
+	 ( (libcdatetime_internal_timezone_t *) timezone )->rule );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_local_time_types",
+	 ( (libcdatetime_internal_timezone_t *) timezone )->number_of_local_time_types,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "standard_local_time_type_index",
+	 ( (libcdatetime_internal_timezone_t *) timezone )->rule->standard_local_time_type_index,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "daylight_saving_time_local_time_type_index",
+	 ( (libcdatetime_internal_timezone_t *) timezone )->rule->daylight_saving_time_local_time_type_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_internal_timezone_read_rule_string(
+	          NULL,
+	          "EST5EDT,M3.2.0,M11.1.0",
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_read_rule_string(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          "EST5EDT,M3.2.0,M11.1.0",
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_timezone_read_rule_string(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          "EST",
+	          4,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* Tests the libcdatetime_timezone_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_read_data(
+     void )
+{
+	uint8_t data[ 186 ];
+
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_read_data(
+	          NULL,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a timezone that was already read
+	 */
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          NULL,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with truncated data
+	 */
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          100,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with transition times that are not in ascending order
+	 */
+	result = memory_copy(
+	          data,
+	          cdatetime_test_timezone_data1,
+	          186 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 131 ] = 0x5f;
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          data,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid local time type index
+	 */
+	data[ 131 ] = 0x61;
+	data[ 135 ] = 0x02;
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          data,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with abbreviations without end of string character
+	 */
+	data[ 135 ] = 0x01;
+	data[ 157 ] = (uint8_t) 'T';
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          data,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+
+/* Tests the libcdatetime_timezone_read_file function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_read_file(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_read_file(
+	          NULL,
+	          "UTC",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_file(
+	          timezone,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_file(
+	          timezone,
+	          "/nonexistent/timezone",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_read_zoneinfo function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_read_zoneinfo(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int32_t utc_offset                = 0;
+	uint8_t is_daylight_saving_time   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The zoneinfo directory is not available on every system
+	 */
+	result = libcdatetime_timezone_read_zoneinfo(
+	          timezone,
+	          "UTC",
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libcdatetime_timezone_get_utc_offset(
+		          timezone,
+		          0,
+		          &utc_offset,
+		          &is_daylight_saving_time,
+		          &error );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT32(
+		 "utc_offset",
+		 utc_offset,
+		 0 );
+
+		CDATETIME_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	else
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_read_zoneinfo(
+	          NULL,
+	          "UTC",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_zoneinfo(
+	          timezone,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_zoneinfo(
+	          timezone,
+	          "",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_zoneinfo(
+	          timezone,
+	          "/etc/localtime",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_zoneinfo(
+	          timezone,
+	          "../zoneinfo/UTC",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_zoneinfo(
+	          timezone,
+	          "Europe/../UTC",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_zoneinfo(
+	          timezone,
+	          "Europe\\Amsterdam",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+
+/* Tests the libcdatetime_timezone_read_time_zone_information function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_read_time_zone_information(
+     void )
+{
+	uint8_t time_zone_information_data[ 44 ];
+	char abbreviation[ 64 ];
+
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int32_t utc_offset                = 0;
+	uint8_t is_daylight_saving_time   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          cdatetime_test_timezone_time_zone_information_data1,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1610668800,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1616893200,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1635642000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_get_abbreviation(
+	          timezone,
+	          (int64_t) 1610668800,
+	          abbreviation,
+	          64,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          abbreviation,
+	          "",
+	          1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          cdatetime_test_timezone_time_zone_information_data2,
+	          172,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1616893199,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1616893200,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_timezone_get_abbreviation(
+	          timezone,
+	          (int64_t) 1610668800,
+	          abbreviation,
+	          64,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          abbreviation,
+	          "W. Europe Standard Time",
+	          24 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdatetime_timezone_get_abbreviation(
+	          timezone,
+	          (int64_t) 1623715200,
+	          abbreviation,
+	          64,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          abbreviation,
+	          "W. Europe Daylight Time",
+	          24 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_read_time_zone_information(
+	          NULL,
+	          cdatetime_test_timezone_time_zone_information_data1,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading the time zone information when it was already read
+	 */
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          cdatetime_test_timezone_time_zone_information_data1,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with dynamic daylight saving time disabled
+	 */
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          cdatetime_test_timezone_time_zone_information_data3,
+	          432,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1623715200,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          NULL,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          cdatetime_test_timezone_time_zone_information_data1,
+	          43,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test time zone information with a bias that is out of bounds
+	 */
+	result = memory_copy(
+	          time_zone_information_data,
+	          cdatetime_test_timezone_time_zone_information_data1,
+	          44 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	time_zone_information_data[ 3 ] = 0x7f;
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          time_zone_information_data,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test time zone information with a month that is out of bounds
+	 */
+	time_zone_information_data[ 3 ]  = 0xff;
+	time_zone_information_data[ 14 ] = 13;
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          time_zone_information_data,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_read_rule_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_read_rule_string(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int32_t utc_offset                = 0;
+	uint8_t is_daylight_saving_time   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "EST5EDT,M3.2.0,M11.1.0",
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1600000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 (int32_t) -14400 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1610668800,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 (int32_t) -18000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	/* Test a time in 2100 that is determined by the rule
+	 */
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 4118054400,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 (int32_t) -14400 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_read_rule_string(
+	          NULL,
+	          "EST5EDT,M3.2.0,M11.1.0",
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "EST5EDT,M3.2.0,M11.1.0",
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an unsupported rule string
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "EST5EDT,M3.2.0",
+	          15,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          NULL,
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* Tests the libcdatetime_timezone_search_transition_times function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_search_transition_times(
+     void )
+{
+	int64_t transition_times[ 5 ] = {
+		-100, 0, 100, 200, 300 };
+
+	uint32_t number_of_transitions = 0;
+
+	/* Test regular cases
+	 */
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         5,
+	                         (int64_t) -101 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 0 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         5,
+	                         (int64_t) -100 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 1 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         5,
+	                         (int64_t) -1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 1 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         5,
+	                         (int64_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 2 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         5,
+	                         (int64_t) 150 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 3 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         5,
+	                         (int64_t) 300 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 5 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         5,
+	                         (int64_t) 1000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 5 );
+
+	/* Test with a subset of the transitions
+	 */
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         1,
+	                         (int64_t) 250 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 1 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         1,
+	                         (int64_t) -250 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 0 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         2,
+	                         (int64_t) 250 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 2 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         4,
+	                         (int64_t) 250 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 4 );
+
+	/* Test error cases
+	 */
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         NULL,
+	                         5,
+	                         (int64_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 0 );
+
+	number_of_transitions = libcdatetime_timezone_search_transition_times(
+	                         transition_times,
+	                         0,
+	                         (int64_t) 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_transitions",
+	 number_of_transitions,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libcdatetime_internal_timezone_get_local_time_type_index function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_internal_timezone_get_local_time_type_index(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	uint8_t local_time_type_index     = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_internal_timezone_get_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1600000000,
+	          0,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	result = libcdatetime_internal_timezone_get_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1616893200,
+	          1,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	result = libcdatetime_internal_timezone_get_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1635642000,
+	          2,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_internal_timezone_get_local_time_type_index(
+	          NULL,
+	          (int64_t) 1600000000,
+	          0,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_get_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1600000000,
+	          3,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_get_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1600000000,
+	          0,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          cdatetime_test_timezone_time_zone_information_data1,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a timezone with a rule
+	 */
+	result = libcdatetime_internal_timezone_get_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1616893199,
+	          0,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	result = libcdatetime_internal_timezone_get_local_time_type_index(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1616893200,
+	          0,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_internal_timezone_get_local_time_type function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_internal_timezone_get_local_time_type(
+     void )
+{
+	const libcdatetime_timezone_local_time_type_t *local_time_type = NULL;
+	libcdatetime_timezone_t *timezone                              = NULL;
+	libcerror_error_t *error                                       = NULL;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases with a timezone that was not read
+	 */
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          0,
+	          &local_time_type,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1600000000,
+	          &local_time_type,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "local_time_type",
+	 local_time_type );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "local_time_type->utc_offset",
+	 local_time_type->utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type->is_daylight_saving_time",
+	 local_time_type->is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1616893199,
+	          &local_time_type,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "local_time_type",
+	 local_time_type );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "local_time_type->utc_offset",
+	 local_time_type->utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type->is_daylight_saving_time",
+	 local_time_type->is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1616893200,
+	          &local_time_type,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "local_time_type",
+	 local_time_type );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "local_time_type->utc_offset",
+	 local_time_type->utc_offset,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type->is_daylight_saving_time",
+	 local_time_type->is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1620000000,
+	          &local_time_type,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "local_time_type",
+	 local_time_type );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "local_time_type->utc_offset",
+	 local_time_type->utc_offset,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type->is_daylight_saving_time",
+	 local_time_type->is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1635642000,
+	          &local_time_type,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "local_time_type",
+	 local_time_type );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "local_time_type->utc_offset",
+	 local_time_type->utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type->is_daylight_saving_time",
+	 local_time_type->is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1640000000,
+	          &local_time_type,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "local_time_type",
+	 local_time_type );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "local_time_type->utc_offset",
+	 local_time_type->utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type->is_daylight_saving_time",
+	 local_time_type->is_daylight_saving_time,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          NULL,
+	          0,
+	          &local_time_type,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_get_local_time_type(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          0,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* Tests the libcdatetime_timezone_get_utc_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_get_utc_offset(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int32_t utc_offset                = 0;
+	uint8_t is_daylight_saving_time   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1600000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1620000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1640000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_get_utc_offset(
+	          NULL,
+	          0,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          0,
+	          NULL,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          0,
+	          &utc_offset,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_get_local_times function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_get_local_times(
+     void )
+{
+	int64_t ascending_posix_times[ 6 ] = {
+		1600000000, 1616893199, 1616893200, 1635641999, 1635642000, 1700000000 };
+
+	int64_t unordered_posix_times[ 6 ] = {
+		1700000000, 1616893200, 1600000000, 1635641999, 1616893199, 1635642000 };
+
+	int64_t ascending_local_times[ 6 ] = {
+		1600003600, 1616896799, 1616900400, 1635649199, 1635645600, 1700003600 };
+
+	int64_t unordered_local_times[ 6 ] = {
+		1700003600, 1616900400, 1600003600, 1635649199, 1616896799, 1635645600 };
+
+	int64_t local_times[ 6 ];
+
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_get_local_times(
+	          timezone,
+	          ascending_posix_times,
+	          6,
+	          local_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "local_times[ value_index ]",
+		 local_times[ value_index ],
+		 ascending_local_times[ value_index ] );
+	}
+	result = libcdatetime_timezone_get_local_times(
+	          timezone,
+	          unordered_posix_times,
+	          6,
+	          local_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "local_times[ value_index ]",
+		 local_times[ value_index ],
+		 unordered_local_times[ value_index ] );
+	}
+	/* Test with the local times stored in the same array as the times
+	 */
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		local_times[ value_index ] = unordered_posix_times[ value_index ];
+	}
+	result = libcdatetime_timezone_get_local_times(
+	          timezone,
+	          local_times,
+	          6,
+	          local_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "local_times[ value_index ]",
+		 local_times[ value_index ],
+		 unordered_local_times[ value_index ] );
+	}
+	result = libcdatetime_timezone_get_local_times(
+	          timezone,
+	          ascending_posix_times,
+	          0,
+	          local_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_get_local_times(
+	          NULL,
+	          ascending_posix_times,
+	          6,
+	          local_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_local_times(
+	          timezone,
+	          NULL,
+	          6,
+	          local_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_local_times(
+	          timezone,
+	          ascending_posix_times,
+	          (size_t) SSIZE_MAX,
+	          local_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_local_times(
+	          timezone,
+	          ascending_posix_times,
+	          6,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	local_times[ 0 ] = (int64_t) INT64_MAX;
+
+	result = libcdatetime_timezone_get_local_times(
+	          timezone,
+	          local_times,
+	          1,
+	          local_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_get_local_filetimes function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_get_local_filetimes(
+     void )
+{
+	uint64_t ascending_filetimes[ 6 ] = {
+		132551424000000000ULL, 132613667990000000ULL, 132613668000000000ULL,
+		132801155990000000ULL, 132801156000000000ULL, 132840000000000000ULL };
+
+	uint64_t unordered_filetimes[ 6 ] = {
+		132840000000000000ULL, 132613668000000000ULL, 132551424000000000ULL,
+		132801155990000000ULL, 132613667990000000ULL, 132801156000000000ULL };
+
+	uint64_t ascending_local_filetimes[ 6 ] = {
+		132551460000000000ULL, 132613703990000000ULL, 132613740000000000ULL,
+		132801227990000000ULL, 132801192000000000ULL, 132840036000000000ULL };
+
+	uint64_t unordered_local_filetimes[ 6 ] = {
+		132840036000000000ULL, 132613740000000000ULL, 132551460000000000ULL,
+		132801227990000000ULL, 132613703990000000ULL, 132801192000000000ULL };
+
+	uint64_t local_filetimes[ 6 ];
+
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	/* Test a timezone without local time types
+	 */
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          ascending_filetimes,
+	          6,
+	          local_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          cdatetime_test_timezone_time_zone_information_data1,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          ascending_filetimes,
+	          6,
+	          local_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "local_filetimes[ value_index ]",
+		 local_filetimes[ value_index ],
+		 ascending_local_filetimes[ value_index ] );
+	}
+	/* Test FILETIMEs that are not in ascending order
+	 */
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          unordered_filetimes,
+	          6,
+	          local_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "local_filetimes[ value_index ]",
+		 local_filetimes[ value_index ],
+		 unordered_local_filetimes[ value_index ] );
+	}
+	/* Test storing the local FILETIMEs in the same array as the FILETIMEs
+	 */
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          ascending_filetimes,
+	          6,
+	          ascending_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+		 "ascending_filetimes[ value_index ]",
+		 ascending_filetimes[ value_index ],
+		 ascending_local_filetimes[ value_index ] );
+	}
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          ascending_filetimes,
+	          0,
+	          local_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_get_local_filetimes(
+	          NULL,
+	          ascending_filetimes,
+	          6,
+	          local_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          NULL,
+	          6,
+	          local_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          ascending_filetimes,
+	          (size_t) SSIZE_MAX,
+	          local_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          ascending_filetimes,
+	          6,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a FILETIME of which the local FILETIME is out of bounds
+	 */
+	ascending_filetimes[ 0 ] = 0xffffffffffffffffULL;
+
+	result = libcdatetime_timezone_get_local_filetimes(
+	          timezone,
+	          ascending_filetimes,
+	          1,
+	          local_filetimes,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* Tests the libcdatetime_internal_timezone_get_posix_time_from_local_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_internal_timezone_get_posix_time_from_local_time(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t posix_time                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a timezone that was not read
+	 */
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1600003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone,
+	          cdatetime_test_timezone_time_zone_information_data1,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1610672400,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1610668800 );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1610672400,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_REJECT,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1610668800 );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1616898600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1616891400 );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1616898600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_LATEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1616895000 );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1616898600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_REJECT,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1635647400,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1635640200 );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1635647400,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_LATEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1635643800 );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1635647400,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_REJECT,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1700003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_LATEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1700000000 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          NULL,
+	          (int64_t) 1600003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) INT64_MAX,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) INT64_MIN,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1600003600,
+	          0,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_internal_timezone_get_posix_time_from_local_time(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          (int64_t) 1600003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* Tests the libcdatetime_timezone_get_posix_time_from_local_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_get_posix_time_from_local_time(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int64_t posix_time                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1600003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1600000000 );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1600003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_REJECT,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1600000000 );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1616898600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1616891400 );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1616898600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_LATEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1616895000 );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1616898600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_REJECT,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1635647400,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1635640200 );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1635647400,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_LATEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1635643800 );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1635647400,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_REJECT,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1700003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_LATEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1700000000 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          NULL,
+	          (int64_t) 1600003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1600003600,
+	          0,
+	          &posix_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_posix_time_from_local_time(
+	          timezone,
+	          (int64_t) 1600003600,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_get_posix_times_from_local_times function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_get_posix_times_from_local_times(
+     void )
+{
+	int64_t local_times[ 4 ] = {
+		1600003600, 1616898600, 1635647400, 1700003600 };
+
+	int64_t earliest_posix_times[ 4 ] = {
+		1600000000, 1616891400, 1635640200, 1700000000 };
+
+	int64_t latest_posix_times[ 4 ] = {
+		1600000000, 1616895000, 1635643800, 1700000000 };
+
+	int64_t posix_times[ 4 ];
+
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          local_times,
+	          4,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "posix_times[ value_index ]",
+		 posix_times[ value_index ],
+		 earliest_posix_times[ value_index ] );
+	}
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          local_times,
+	          4,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_LATEST,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "posix_times[ value_index ]",
+		 posix_times[ value_index ],
+		 latest_posix_times[ value_index ] );
+	}
+	/* Test with the times stored in the same array as the local times
+	 */
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		posix_times[ value_index ] = local_times[ value_index ];
+	}
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          posix_times,
+	          4,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_LATEST,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		CDATETIME_TEST_ASSERT_EQUAL_INT64(
+		 "posix_times[ value_index ]",
+		 posix_times[ value_index ],
+		 latest_posix_times[ value_index ] );
+	}
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          local_times,
+	          0,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_REJECT,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          NULL,
+	          local_times,
+	          4,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          NULL,
+	          4,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          local_times,
+	          (size_t) SSIZE_MAX,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          local_times,
+	          4,
+	          0,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          local_times,
+	          4,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_EARLIEST,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a local time that is rejected
+	 */
+	result = libcdatetime_timezone_get_posix_times_from_local_times(
+	          timezone,
+	          local_times,
+	          4,
+	          LIBCDATETIME_LOCAL_TIME_POLICY_REJECT,
+	          posix_times,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_get_abbreviation function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_get_abbreviation(
+     void )
+{
+	char abbreviation[ 8 ];
+
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_get_abbreviation(
+	          timezone,
+	          (int64_t) 1620000000,
+	          abbreviation,
+	          8,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          abbreviation,
+	          "CEST",
+	          5 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdatetime_timezone_get_abbreviation(
+	          timezone,
+	          (int64_t) 1640000000,
+	          abbreviation,
+	          8,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          abbreviation,
+	          "CET",
+	          4 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_get_abbreviation(
+	          NULL,
+	          (int64_t) 1620000000,
+	          abbreviation,
+	          8,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_abbreviation(
+	          timezone,
+	          (int64_t) 1620000000,
+	          NULL,
+	          8,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_abbreviation(
+	          timezone,
+	          (int64_t) 1620000000,
+	          abbreviation,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_get_abbreviation(
+	          timezone,
+	          (int64_t) 1620000000,
+	          abbreviation,
+	          4,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_initialize",
+	 cdatetime_test_timezone_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_free",
+	 cdatetime_test_timezone_free );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_file_header_read_data",
+	 cdatetime_test_timezone_file_header_read_data );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_internal_timezone_find_local_time_type_index",
+	 cdatetime_test_internal_timezone_find_local_time_type_index );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_internal_timezone_read_rule_string",
+	 cdatetime_test_internal_timezone_read_rule_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_read_data",
+	 cdatetime_test_timezone_read_data );
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_read_file",
+	 cdatetime_test_timezone_read_file );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_read_zoneinfo",
+	 cdatetime_test_timezone_read_zoneinfo );
+
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_read_time_zone_information",
+	 cdatetime_test_timezone_read_time_zone_information );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_read_rule_string",
+	 cdatetime_test_timezone_read_rule_string );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_search_transition_times",
+	 cdatetime_test_timezone_search_transition_times );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_internal_timezone_get_local_time_type_index",
+	 cdatetime_test_internal_timezone_get_local_time_type_index );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_internal_timezone_get_local_time_type",
+	 cdatetime_test_internal_timezone_get_local_time_type );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_get_utc_offset",
+	 cdatetime_test_timezone_get_utc_offset );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_get_local_times",
+	 cdatetime_test_timezone_get_local_times );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_get_local_filetimes",
+	 cdatetime_test_timezone_get_local_filetimes );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_internal_timezone_get_posix_time_from_local_time",
+	 cdatetime_test_internal_timezone_get_posix_time_from_local_time );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_get_posix_time_from_local_time",
+	 cdatetime_test_timezone_get_posix_time_from_local_time );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_get_posix_times_from_local_times",
+	 cdatetime_test_timezone_get_posix_times_from_local_times );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_get_abbreviation",
+	 cdatetime_test_timezone_get_abbreviation );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
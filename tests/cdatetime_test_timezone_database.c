@@ -0,0 +1,4374 @@
+/*
+ * Library timezone database type test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_timezone.h"
+#include "../libcdatetime/libcdatetime_timezone_database.h"
+
+/* TZif version 2 data with the 2021 daylight saving time transitions of CET
+ * and the footer: CET-1CEST,M3.5.0,M10.5.0/3
+ */
+uint8_t cdatetime_test_timezone_database_timezone_data1[ 186 ] = {
+	0x54, 0x5a, 0x69, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x60, 0x5f, 0xd5, 0x10,
+	0x61, 0x7d, 0xea, 0x90, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20,
+	0x01, 0x04, 0x43, 0x45, 0x54, 0x00, 0x43, 0x45, 0x53, 0x54, 0x00, 0x54, 0x5a, 0x69, 0x66, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x60, 0x5f, 0xd5, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x61, 0x7d, 0xea, 0x90, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x1c, 0x20, 0x01, 0x04, 0x43, 0x45, 0x54, 0x00, 0x43, 0x45, 0x53, 0x54, 0x00, 0x0a, 0x43,
+	0x45, 0x54, 0x2d, 0x31, 0x43, 0x45, 0x53, 0x54, 0x2c, 0x4d, 0x33, 0x2e, 0x35, 0x2e, 0x30, 0x2c,
+	0x4d, 0x31, 0x30, 0x2e, 0x35, 0x2e, 0x30, 0x2f, 0x33, 0x0a };
+
+/* Windows REG_TZI_FORMAT data of W. Europe Standard Time
+ */
+uint8_t cdatetime_test_timezone_database_time_zone_information_data1[ 44 ] = {
+	0xc4, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0a, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Timezone database record with the EST and EDT local time types and
+ * a transition to EDT on March 8, 2020
+ */
+uint8_t cdatetime_test_timezone_database_record_data1[ 28 ] = {
+	0x01, 0x02, 0x08, 0x00, 0x9f, 0x99, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x01, 0x04, 0xe0, 0xdf,
+	0xa4, 0xe6, 0x0b, 0x01, 0x45, 0x53, 0x54, 0x00, 0x45, 0x44, 0x54, 0x00 };
+
+/* Timezone database record with trailing data
+ */
+uint8_t cdatetime_test_timezone_database_record_data2[ 29 ] = {
+	0x01, 0x02, 0x08, 0x00, 0x9f, 0x99, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x01, 0x04, 0xe0, 0xdf,
+	0xa4, 0xe6, 0x0b, 0x01, 0x45, 0x53, 0x54, 0x00, 0x45, 0x44, 0x54, 0x00, 0x00 };
+
+/* Timezone database record with an out of bounds local time type index
+ */
+uint8_t cdatetime_test_timezone_database_record_data3[ 28 ] = {
+	0x01, 0x02, 0x08, 0x00, 0x9f, 0x99, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x01, 0x04, 0xe0, 0xdf,
+	0xa4, 0xe6, 0x0b, 0x02, 0x45, 0x53, 0x54, 0x00, 0x45, 0x44, 0x54, 0x00 };
+
+/* Tests the libcdatetime_timezone_database_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_initialize(
+     void )
+{
+	libcdatetime_timezone_database_t *database = NULL;
+	libcerror_error_t *error                   = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	database = (libcdatetime_timezone_database_t *) 0x12345678UL;
+
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	database = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_timezone_database_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_timezone_database_initialize(
+		          &database,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( database != NULL )
+			{
+				libcdatetime_timezone_database_free(
+				 &database,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "database",
+			 database );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_timezone_database_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_timezone_database_initialize(
+		          &database,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( database != NULL )
+			{
+				libcdatetime_timezone_database_free(
+				 &database,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "database",
+			 database );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_database_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* Tests the libcdatetime_timezone_database_write_record function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_write_record(
+     void )
+{
+	libcdatetime_timezone_t *timezone      = NULL;
+	libcdatetime_timezone_t *timezone_copy = NULL;
+	libcerror_error_t *error               = NULL;
+	uint8_t *data                          = NULL;
+	size_t data_size                       = 0;
+	int32_t utc_offset                     = 0;
+	uint8_t is_daylight_saving_time        = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_database_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone_copy,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone_copy",
+	 timezone_copy );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_database_write_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 59 );
+
+	result = libcdatetime_timezone_database_read_record(
+	          (libcdatetime_internal_timezone_t *) timezone_copy,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone_copy,
+	          (int64_t) 1625000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone_copy,
+	          (int64_t) 1640000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone_copy,
+	          (int64_t) 1690000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone_copy,
+	          (int64_t) 1700000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_read_record(
+	          (libcdatetime_internal_timezone_t *) timezone_copy,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_write_record(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_write_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_write_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_write_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          &data,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libcdatetime_timezone_free(
+	          &timezone_copy,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone_copy",
+	 timezone_copy );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone_copy,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone_copy",
+	 timezone_copy );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_time_zone_information(
+	          timezone_copy,
+	          cdatetime_test_timezone_database_time_zone_information_data1,
+	          44,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_write_record(
+	          (libcdatetime_internal_timezone_t *) timezone_copy,
+	          &data,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone_copy,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone_copy",
+	 timezone_copy );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( timezone_copy != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone_copy,
+		 NULL );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_database_read_record function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_read_record(
+     void )
+{
+	libcdatetime_timezone_t *timezone = NULL;
+	libcerror_error_t *error          = NULL;
+	int32_t utc_offset                = 0;
+	uint8_t is_daylight_saving_time   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_database_read_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          cdatetime_test_timezone_database_record_data1,
+	          28,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 0,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 -18000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1600000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 -14400 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_read_record(
+	          NULL,
+	          cdatetime_test_timezone_database_record_data1,
+	          28,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          NULL,
+	          20,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          cdatetime_test_timezone_database_record_data1,
+	          27,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          cdatetime_test_timezone_database_record_data2,
+	          29,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_record(
+	          (libcdatetime_internal_timezone_t *) timezone,
+	          cdatetime_test_timezone_database_record_data3,
+	          28,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* Tests the libcdatetime_timezone_database_append_timezone function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_append_timezone(
+     void )
+{
+	libcdatetime_timezone_database_t *database = NULL;
+	libcdatetime_timezone_t *timezone          = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint8_t *data                              = NULL;
+	size_t data_size                           = 0;
+	int number_of_timezones                    = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_database_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Brussels",
+	          15,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Amsterdam",
+	          16,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_number_of_timezones(
+	          database,
+	          &number_of_timezones,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "number_of_timezones",
+	 number_of_timezones,
+	 2 );
+
+	/* Timezones with the same data share a record
+	 */
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_appended_records",
+	 ( (libcdatetime_internal_timezone_database_t *) database )->number_of_appended_records,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_append_timezone(
+	          NULL,
+	          "Europe/Paris",
+	          12,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          NULL,
+	          12,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Paris",
+	          0,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Paris",
+	          256,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Paris",
+	          12,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Amsterdam",
+	          16,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_number_of_timezones(
+	          database,
+	          &number_of_timezones,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "number_of_timezones",
+	 number_of_timezones,
+	 2 );
+
+	result = libcdatetime_timezone_database_get_data_size(
+	          database,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Paris",
+	          12,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_database_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_read_data(
+     void )
+{
+	libcdatetime_timezone_database_t *database = NULL;
+	libcdatetime_timezone_t *timezone          = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint8_t *data                              = NULL;
+	size_t data_size                           = 0;
+	int number_of_timezones                    = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_database_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Brussels",
+	          15,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Amsterdam",
+	          16,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "JST-9",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Asia/Tokyo",
+	          10,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_data_size(
+	          database,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_number_of_timezones(
+	          database,
+	          &number_of_timezones,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "number_of_timezones",
+	 number_of_timezones,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          NULL,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          31,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data[ 0 ] = 0xff;
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data[ 0 ] = (uint8_t) 'c';
+
+	/* Test with an out of bounds record index
+	 */
+	data[ 36 ] = 0x03;
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data[ 36 ] = 0x00;
+
+	/* Test with names that are not in ascending order
+	 */
+	data[ 40 ] = data[ 32 ];
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_database_get_timezone_name function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_get_timezone_name(
+     void )
+{
+	char name[ 32 ];
+
+	libcdatetime_timezone_database_t *database = NULL;
+	libcdatetime_timezone_t *timezone          = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint8_t *data                              = NULL;
+	size_t data_size                           = 0;
+	size_t name_size                           = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_database_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Brussels",
+	          15,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Amsterdam",
+	          16,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "JST-9",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Asia/Tokyo",
+	          10,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_data_size(
+	          database,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_database_get_timezone_name_size(
+	          database,
+	          0,
+	          &name_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 11 );
+
+	result = libcdatetime_timezone_database_get_timezone_name(
+	          database,
+	          0,
+	          name,
+	          32,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          name,
+	          "Asia/Tokyo",
+	          11 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdatetime_timezone_database_get_timezone_name_size(
+	          database,
+	          2,
+	          &name_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 16 );
+
+	result = libcdatetime_timezone_database_get_timezone_name(
+	          database,
+	          2,
+	          name,
+	          32,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          name,
+	          "Europe/Brussels",
+	          16 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_get_timezone_name_size(
+	          NULL,
+	          0,
+	          &name_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_name_size(
+	          database,
+	          -1,
+	          &name_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_name_size(
+	          database,
+	          3,
+	          &name_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_name_size(
+	          database,
+	          0,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_name(
+	          NULL,
+	          0,
+	          name,
+	          32,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_name(
+	          database,
+	          3,
+	          name,
+	          32,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_name(
+	          database,
+	          0,
+	          NULL,
+	          32,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_name(
+	          database,
+	          0,
+	          name,
+	          10,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_name(
+	          database,
+	          0,
+	          name,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_database_get_timezone_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_get_timezone_by_name(
+     void )
+{
+	libcdatetime_timezone_database_t *database = NULL;
+	libcdatetime_timezone_t *timezone          = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint8_t *data                              = NULL;
+	size_t data_size                           = 0;
+	int32_t utc_offset                         = 0;
+	uint8_t is_daylight_saving_time            = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_database_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Brussels",
+	          15,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Amsterdam",
+	          16,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "JST-9",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Asia/Tokyo",
+	          10,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_data_size(
+	          database,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Europe/Amsterdam",
+	          16,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1625000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 1 );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1700000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 3600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Asia/Tokyo",
+	          10,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1625000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 32400 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Europe/Paris",
+	          12,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Asia",
+	          4,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Asia/Tokyo/",
+	          11,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "A",
+	          1,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Zulu",
+	          4,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Europe/Brussels",
+	          6,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          NULL,
+	          "Asia/Tokyo",
+	          10,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          NULL,
+	          10,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Asia/Tokyo",
+	          (size_t) SSIZE_MAX + 1,
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_timezone_by_name(
+	          database,
+	          "Asia/Tokyo",
+	          10,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_database_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_write_data(
+     void )
+{
+	libcdatetime_timezone_database_t *database = NULL;
+	libcdatetime_timezone_t *timezone          = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint8_t *data                              = NULL;
+	size_t data_size                           = 0;
+	uint8_t *data_copy                         = NULL;
+	size_t data_copy_size                      = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_database_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Brussels",
+	          15,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Amsterdam",
+	          16,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "JST-9",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Asia/Tokyo",
+	          10,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_data_size(
+	          database,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_database_get_data_size(
+	          database,
+	          &data_copy_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_SIZE(
+	 "data_copy_size",
+	 data_copy_size,
+	 data_size );
+
+	data_copy = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * data_copy_size );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "data_copy",
+	 data_copy );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          data_copy,
+	          data_copy_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data_copy,
+	          data,
+	          data_size );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_get_data_size(
+	          NULL,
+	          &data_copy_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_get_data_size(
+	          database,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_write_data(
+	          NULL,
+	          data_copy,
+	          data_copy_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          NULL,
+	          data_copy_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          data_copy,
+	          data_copy_size - 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data_copy );
+
+	data_copy = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_copy != NULL )
+	{
+		memory_free(
+		 data_copy );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+
+/* Tests the libcdatetime_timezone_database_read_file function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_database_read_file(
+     void )
+{
+	libcdatetime_timezone_database_t *database = NULL;
+	libcerror_error_t *error                   = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_read_file(
+	          NULL,
+	          "libcdatetime.tzdb",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_file(
+	          database,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_database_read_file(
+	          database,
+	          "/nonexistent/libcdatetime.tzdb",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_set_timezone_database function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_set_timezone_database(
+     void )
+{
+	libcdatetime_timezone_database_t *database = NULL;
+	libcdatetime_timezone_t *timezone          = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint8_t *data                              = NULL;
+	size_t data_size                           = 0;
+	int32_t utc_offset                         = 0;
+	uint8_t is_daylight_saving_time            = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_data(
+	          timezone,
+	          cdatetime_test_timezone_database_timezone_data1,
+	          186,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Brussels",
+	          15,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Europe/Amsterdam",
+	          16,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_rule_string(
+	          timezone,
+	          "JST-9",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_append_timezone(
+	          database,
+	          "Asia/Tokyo",
+	          10,
+	          timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_get_data_size(
+	          database,
+	          &data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libcdatetime_timezone_database_write_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_read_data(
+	          database,
+	          data,
+	          data_size,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_set_timezone_database(
+	          database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_initialize(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_read_zoneinfo(
+	          timezone,
+	          "Asia/Tokyo",
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_get_utc_offset(
+	          timezone,
+	          (int64_t) 1625000000,
+	          &utc_offset,
+	          &is_daylight_saving_time,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "utc_offset",
+	 utc_offset,
+	 32400 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "is_daylight_saving_time",
+	 is_daylight_saving_time,
+	 0 );
+
+	result = libcdatetime_timezone_free(
+	          &timezone,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "timezone",
+	 timezone );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_set_timezone_database(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_database_initialize(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_set_timezone_database(
+	          database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_database_free(
+	          &database,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "database",
+	 database );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libcdatetime_set_timezone_database(
+	 NULL,
+	 NULL );
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( timezone != NULL )
+	{
+		libcdatetime_timezone_free(
+		 &timezone,
+		 NULL );
+	}
+	if( database != NULL )
+	{
+		libcdatetime_timezone_database_free(
+		 &database,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_initialize",
+	 cdatetime_test_timezone_database_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_free",
+	 cdatetime_test_timezone_database_free );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_write_record",
+	 cdatetime_test_timezone_database_write_record );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_read_record",
+	 cdatetime_test_timezone_database_read_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_append_timezone",
+	 cdatetime_test_timezone_database_append_timezone );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_read_data",
+	 cdatetime_test_timezone_database_read_data );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_get_timezone_name",
+	 cdatetime_test_timezone_database_get_timezone_name );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_get_timezone_by_name",
+	 cdatetime_test_timezone_database_get_timezone_by_name );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_write_data",
+	 cdatetime_test_timezone_database_write_data );
+
+#if defined( HAVE_FOPEN ) || defined( WINAPI )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_database_read_file",
+	 cdatetime_test_timezone_database_read_file );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_set_timezone_database",
+	 cdatetime_test_set_timezone_database );
+
+#endif /* defined( HAVE_FOPEN ) || defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
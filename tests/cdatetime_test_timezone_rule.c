@@ -0,0 +1,2751 @@
+/*
+ * Library timezone rule functions test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_memory.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_definitions.h"
+#include "../libcdatetime/libcdatetime_timezone_rule.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* SYSTEMTIME of the last Sunday of March at 02:00:00
+ */
+uint8_t cdatetime_test_timezone_rule_systemtime_data1[ 16 ] = {
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libcdatetime_timezone_rule_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_rule_initialize(
+     void )
+{
+	libcdatetime_timezone_rule_t *rule = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_rule_initialize(
+	          &rule,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "rule",
+	 rule );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdatetime_timezone_rule_free(
+	          &rule,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "rule",
+	 rule );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_rule_initialize(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	rule = (libcdatetime_timezone_rule_t *) 0x12345678UL;
+
+	result = libcdatetime_timezone_rule_initialize(
+	          &rule,
+	          &error );
+
+	rule = NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CDATETIME_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_timezone_rule_initialize with malloc failing
+		 */
+		cdatetime_test_malloc_attempts_before_fail = test_number;
+
+		result = libcdatetime_timezone_rule_initialize(
+		          &rule,
+		          &error );
+
+		if( cdatetime_test_malloc_attempts_before_fail != -1 )
+		{
+			cdatetime_test_malloc_attempts_before_fail = -1;
+
+			if( rule != NULL )
+			{
+				libcdatetime_timezone_rule_free(
+				 &rule,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "rule",
+			 rule );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcdatetime_timezone_rule_initialize with memset failing
+		 */
+		cdatetime_test_memset_attempts_before_fail = test_number;
+
+		result = libcdatetime_timezone_rule_initialize(
+		          &rule,
+		          &error );
+
+		if( cdatetime_test_memset_attempts_before_fail != -1 )
+		{
+			cdatetime_test_memset_attempts_before_fail = -1;
+
+			if( rule != NULL )
+			{
+				libcdatetime_timezone_rule_free(
+				 &rule,
+				 NULL );
+			}
+		}
+		else
+		{
+			CDATETIME_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CDATETIME_TEST_ASSERT_IS_NULL(
+			 "rule",
+			 rule );
+
+			CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CDATETIME_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rule != NULL )
+	{
+		libcdatetime_timezone_rule_free(
+		 &rule,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_rule_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_rule_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_rule_free(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_rule_date_read_systemtime function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_rule_date_read_systemtime(
+     void )
+{
+	uint8_t systemtime_data[ 16 ];
+
+	libcdatetime_timezone_rule_date_t date;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date.type",
+	 date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date.month",
+	 date.month,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date.week_of_month",
+	 date.week_of_month,
+	 5 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date.day_of_week",
+	 date.day_of_week,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "date.time_of_day",
+	 date.time_of_day,
+	 7200 );
+
+	/* Test a SYSTEMTIME of March 28, 2021 at 02:00:00.500
+	 */
+	result = memory_copy(
+	          systemtime_data,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          16 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	systemtime_data[ 0 ]  = 0xe5;
+	systemtime_data[ 1 ]  = 0x07;
+	systemtime_data[ 6 ]  = 28;
+	systemtime_data[ 14 ] = 0xf4;
+	systemtime_data[ 15 ] = 0x01;
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          systemtime_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date.type",
+	 date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date.year",
+	 date.year,
+	 2021 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "date.month",
+	 date.month,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "date.day",
+	 date.day,
+	 28 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "date.time_of_day",
+	 date.time_of_day,
+	 7201 );
+
+	/* Test a SYSTEMTIME without a date
+	 */
+	systemtime_data[ 2 ] = 0;
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          systemtime_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          NULL,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          NULL,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          8,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a SYSTEMTIME with an invalid month
+	 */
+	result = memory_copy(
+	          systemtime_data,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          16 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	systemtime_data[ 2 ] = 13;
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          systemtime_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a SYSTEMTIME with an invalid hour
+	 */
+	result = memory_copy(
+	          systemtime_data,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          16 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	systemtime_data[ 8 ] = 24;
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          systemtime_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a SYSTEMTIME with an invalid day of week
+	 */
+	result = memory_copy(
+	          systemtime_data,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          16 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	systemtime_data[ 4 ] = 7;
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          systemtime_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a SYSTEMTIME with an invalid week of month
+	 */
+	result = memory_copy(
+	          systemtime_data,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          16 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	systemtime_data[ 6 ] = 6;
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          systemtime_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a SYSTEMTIME with an invalid day of month
+	 */
+	result = memory_copy(
+	          systemtime_data,
+	          cdatetime_test_timezone_rule_systemtime_data1,
+	          16 ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	systemtime_data[ 0 ] = 0xe5;
+	systemtime_data[ 1 ] = 0x07;
+	systemtime_data[ 2 ] = 2;
+	systemtime_data[ 6 ] = 29;
+
+	result = libcdatetime_timezone_rule_date_read_systemtime(
+	          &date,
+	          systemtime_data,
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_rule_read_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_rule_read_string(
+     void )
+{
+	libcdatetime_timezone_rule_t rule;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT,M3.2.0,M11.1.0",
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "standard_utc_offset",
+	 rule.standard_utc_offset,
+	 -18000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "daylight_saving_time_utc_offset",
+	 rule.daylight_saving_time_utc_offset,
+	 -14400 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "has_daylight_saving_time",
+	 rule.has_daylight_saving_time,
+	 1 );
+
+	result = memory_compare(
+	          rule.standard_abbreviation,
+	          "EST",
+	          4 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          rule.daylight_saving_time_abbreviation,
+	          "EDT",
+	          4 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.type",
+	 rule.start_date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.month",
+	 rule.start_date.month,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.week_of_month",
+	 rule.start_date.week_of_month,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.day_of_week",
+	 rule.start_date.day_of_week,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "start_date.time_of_day",
+	 rule.start_date.time_of_day,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.type",
+	 rule.end_date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.month",
+	 rule.end_date.month,
+	 11 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.week_of_month",
+	 rule.end_date.week_of_month,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.day_of_week",
+	 rule.end_date.day_of_week,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "end_date.time_of_day",
+	 rule.end_date.time_of_day,
+	 7200 );
+
+	/* Test a rule with a quoted abbreviation and without daylight saving time
+	 */
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "<+0530>-5:30",
+	          13,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "standard_utc_offset",
+	 rule.standard_utc_offset,
+	 19800 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "daylight_saving_time_utc_offset",
+	 rule.daylight_saving_time_utc_offset,
+	 19800 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "has_daylight_saving_time",
+	 rule.has_daylight_saving_time,
+	 0 );
+
+	result = memory_compare(
+	          rule.standard_abbreviation,
+	          "+0530",
+	          6 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a rule with the default dates
+	 */
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "AEST-10AEDT",
+	          12,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "standard_utc_offset",
+	 rule.standard_utc_offset,
+	 36000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "daylight_saving_time_utc_offset",
+	 rule.daylight_saving_time_utc_offset,
+	 39600 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "has_daylight_saving_time",
+	 rule.has_daylight_saving_time,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.type",
+	 rule.start_date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.month",
+	 rule.start_date.month,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.week_of_month",
+	 rule.start_date.week_of_month,
+	 2 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.day_of_week",
+	 rule.start_date.day_of_week,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "start_date.time_of_day",
+	 rule.start_date.time_of_day,
+	 7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.type",
+	 rule.end_date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.month",
+	 rule.end_date.month,
+	 11 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.week_of_month",
+	 rule.end_date.week_of_month,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.day_of_week",
+	 rule.end_date.day_of_week,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "end_date.time_of_day",
+	 rule.end_date.time_of_day,
+	 7200 );
+
+	/* Test a rule with times outside the day as allowed by RFC 8536
+	 */
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "<-03>3<-02>,M3.5.0/-2,M10.5.0/-1",
+	          33,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "standard_utc_offset",
+	 rule.standard_utc_offset,
+	 -10800 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "daylight_saving_time_utc_offset",
+	 rule.daylight_saving_time_utc_offset,
+	 -7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "has_daylight_saving_time",
+	 rule.has_daylight_saving_time,
+	 1 );
+
+	result = memory_compare(
+	          rule.daylight_saving_time_abbreviation,
+	          "-02",
+	          4 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.type",
+	 rule.start_date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.month",
+	 rule.start_date.month,
+	 3 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.week_of_month",
+	 rule.start_date.week_of_month,
+	 5 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.day_of_week",
+	 rule.start_date.day_of_week,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "start_date.time_of_day",
+	 rule.start_date.time_of_day,
+	 -7200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.type",
+	 rule.end_date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.month",
+	 rule.end_date.month,
+	 10 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.week_of_month",
+	 rule.end_date.week_of_month,
+	 5 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.day_of_week",
+	 rule.end_date.day_of_week,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "end_date.time_of_day",
+	 rule.end_date.time_of_day,
+	 -3600 );
+
+	/* Test a rule with daylight saving time during the entire year
+	 */
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT4,0/0,J365/25",
+	          21,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "standard_utc_offset",
+	 rule.standard_utc_offset,
+	 -18000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "daylight_saving_time_utc_offset",
+	 rule.daylight_saving_time_utc_offset,
+	 -14400 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "has_daylight_saving_time",
+	 rule.has_daylight_saving_time,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "start_date.type",
+	 rule.start_date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_DAY_OF_YEAR );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "start_date.day",
+	 rule.start_date.day,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "start_date.time_of_day",
+	 rule.start_date.time_of_day,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "end_date.type",
+	 rule.end_date.type,
+	 LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_JULIAN_DAY );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "end_date.day",
+	 rule.end_date.day,
+	 365 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "end_date.time_of_day",
+	 rule.end_date.time_of_day,
+	 90000 );
+
+	/* Test a rule string that ends at the string size
+	 */
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT,M3.2.0,M11.1.0",
+	          4,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "standard_utc_offset",
+	 rule.standard_utc_offset,
+	 -18000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT32(
+	 "daylight_saving_time_utc_offset",
+	 rule.daylight_saving_time_utc_offset,
+	 -18000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "has_daylight_saving_time",
+	 rule.has_daylight_saving_time,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_rule_read_string(
+	          NULL,
+	          "EST5",
+	          5,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          NULL,
+	          5,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "ES5",
+	          4,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST",
+	          4,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST25",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "<EST5",
+	          6,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "ABCDEFGHIJKLMNOPQ5",
+	          19,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT,M13.1.0,M11.1.0",
+	          24,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT,M3.2.7,M11.1.0",
+	          23,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT,M3.2.0",
+	          15,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT,J0,J365",
+	          16,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT,M3.2.0/168,M11.1.0",
+	          27,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_read_string(
+	          &rule,
+	          "EST5EDT,M3.2.0,M11.1.0x",
+	          24,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_rule_date_get_days_since_epoch function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_rule_date_get_days_since_epoch(
+     void )
+{
+	libcdatetime_timezone_rule_date_t date;
+
+	libcerror_error_t *error = NULL;
+	int64_t number_of_days   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	date.type          = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	date.year          = 0;
+	date.month         = 3;
+	date.week_of_month = 5;
+	date.day_of_week   = 0;
+	date.day           = 0;
+	date.time_of_day   = 7200;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 18714 );
+
+	date.week_of_month = 1;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 18693 );
+
+	/* Test the last Monday of February
+	 */
+	date.month         = 2;
+	date.week_of_month = 5;
+	date.day_of_week   = 1;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 18680 );
+
+	date.type  = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_DAY;
+	date.year  = 2021;
+	date.month = 3;
+	date.day   = 28;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 18714 );
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2022,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The Julian day does not count February 29
+	 */
+	date.type = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_JULIAN_DAY;
+	date.day  = 60;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2020,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 18322 );
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 18687 );
+
+	date.type = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_DAY_OF_YEAR;
+	date.day  = 59;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2020,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 18321 );
+
+	date.day = 365;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2020,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "number_of_days",
+	 number_of_days,
+	 (int64_t) 18627 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          NULL,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date.day = 366;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date.type = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_JULIAN_DAY;
+	date.day  = 0;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date.type          = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	date.week_of_month = 6;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	date.type = 0;
+
+	result = libcdatetime_timezone_rule_date_get_days_since_epoch(
+	          &date,
+	          2021,
+	          &number_of_days,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_rule_calculate_year function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_rule_calculate_year(
+     void )
+{
+	libcdatetime_timezone_rule_year_t rule_year;
+
+	libcdatetime_timezone_rule_t *rule = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_rule_initialize(
+	          &rule,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "rule",
+	 rule );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rule->standard_utc_offset                        = 3600;
+	rule->daylight_saving_time_utc_offset            = 7200;
+	rule->standard_local_time_type_index             = 0;
+	rule->daylight_saving_time_local_time_type_index = 1;
+	rule->has_daylight_saving_time                   = 1;
+	rule->start_date.type                            = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	rule->start_date.month                           = 3;
+	rule->start_date.week_of_month                   = 5;
+	rule->start_date.day_of_week                     = 0;
+	rule->start_date.time_of_day                     = 7200;
+	rule->end_date.type                              = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	rule->end_date.month                             = 10;
+	rule->end_date.week_of_month                     = 5;
+	rule->end_date.day_of_week                       = 0;
+	rule->end_date.time_of_day                       = 10800;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_rule_calculate_year(
+	          rule,
+	          2021,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "rule_year.year",
+	 rule_year.year,
+	 2021 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "rule_year.has_daylight_saving_time",
+	 rule_year.has_daylight_saving_time,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.start_time",
+	 rule_year.start_time,
+	 (int64_t) 1609459200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.end_time",
+	 rule_year.end_time,
+	 (int64_t) 1640995200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.daylight_saving_time_start_time",
+	 rule_year.daylight_saving_time_start_time,
+	 (int64_t) 1616893200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.daylight_saving_time_end_time",
+	 rule_year.daylight_saving_time_end_time,
+	 (int64_t) 1635642000 );
+
+	/* Test daylight saving time that only applies to another year
+	 */
+	rule->start_date.type = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_DAY;
+	rule->start_date.year = 2022;
+	rule->start_date.day  = 27;
+
+	result = libcdatetime_timezone_rule_calculate_year(
+	          rule,
+	          2021,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "rule_year.year",
+	 rule_year.year,
+	 2021 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "rule_year.has_daylight_saving_time",
+	 rule_year.has_daylight_saving_time,
+	 0 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.start_time",
+	 rule_year.start_time,
+	 (int64_t) 1609459200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.end_time",
+	 rule_year.end_time,
+	 (int64_t) 1640995200 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_rule_calculate_year(
+	          NULL,
+	          2021,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_calculate_year(
+	          rule,
+	          65535,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_calculate_year(
+	          rule,
+	          2021,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	rule->start_date.type = 0;
+
+	result = libcdatetime_timezone_rule_calculate_year(
+	          rule,
+	          2021,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_rule_free(
+	          &rule,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "rule",
+	 rule );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rule != NULL )
+	{
+		libcdatetime_timezone_rule_free(
+		 &rule,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_rule_get_year function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_rule_get_year(
+     void )
+{
+	libcdatetime_timezone_rule_year_t rule_year;
+
+	libcdatetime_timezone_rule_t *rule = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_rule_initialize(
+	          &rule,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "rule",
+	 rule );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rule->standard_utc_offset                        = 3600;
+	rule->daylight_saving_time_utc_offset            = 7200;
+	rule->standard_local_time_type_index             = 0;
+	rule->daylight_saving_time_local_time_type_index = 1;
+	rule->has_daylight_saving_time                   = 1;
+	rule->start_date.type                            = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	rule->start_date.month                           = 3;
+	rule->start_date.week_of_month                   = 5;
+	rule->start_date.day_of_week                     = 0;
+	rule->start_date.time_of_day                     = 7200;
+	rule->end_date.type                              = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	rule->end_date.month                             = 10;
+	rule->end_date.week_of_month                     = 5;
+	rule->end_date.day_of_week                       = 0;
+	rule->end_date.time_of_day                       = 10800;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_rule_get_year(
+	          rule,
+	          2021,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "rule_year.year",
+	 rule_year.year,
+	 2021 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "rule_year.has_daylight_saving_time",
+	 rule_year.has_daylight_saving_time,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.start_time",
+	 rule_year.start_time,
+	 (int64_t) 1609459200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.end_time",
+	 rule_year.end_time,
+	 (int64_t) 1640995200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.daylight_saving_time_start_time",
+	 rule_year.daylight_saving_time_start_time,
+	 (int64_t) 1616893200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.daylight_saving_time_end_time",
+	 rule_year.daylight_saving_time_end_time,
+	 (int64_t) 1635642000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "rule->cached_years[ 5 ].sequence_number",
+	 rule->cached_years[ 5 ].sequence_number,
+	 2 );
+
+	/* Test retrieving the cached year
+	 */
+	result = libcdatetime_timezone_rule_get_year(
+	          rule,
+	          2021,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "rule_year.year",
+	 rule_year.year,
+	 2021 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "rule_year.has_daylight_saving_time",
+	 rule_year.has_daylight_saving_time,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.start_time",
+	 rule_year.start_time,
+	 (int64_t) 1609459200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.end_time",
+	 rule_year.end_time,
+	 (int64_t) 1640995200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.daylight_saving_time_start_time",
+	 rule_year.daylight_saving_time_start_time,
+	 (int64_t) 1616893200 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT64(
+	 "rule_year.daylight_saving_time_end_time",
+	 rule_year.daylight_saving_time_end_time,
+	 (int64_t) 1635642000 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "rule->cached_years[ 5 ].sequence_number",
+	 rule->cached_years[ 5 ].sequence_number,
+	 2 );
+
+	/* Test replacing the cached year
+	 */
+	result = libcdatetime_timezone_rule_get_year(
+	          rule,
+	          2029,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "rule_year.year",
+	 rule_year.year,
+	 2029 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT32(
+	 "rule->cached_years[ 5 ].sequence_number",
+	 rule->cached_years[ 5 ].sequence_number,
+	 4 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT16(
+	 "rule->cached_years[ 5 ].year",
+	 rule->cached_years[ 5 ].year,
+	 2029 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_rule_get_year(
+	          NULL,
+	          2021,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_get_year(
+	          rule,
+	          2021,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_get_year(
+	          rule,
+	          65535,
+	          &rule_year,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_rule_free(
+	          &rule,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "rule",
+	 rule );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rule != NULL )
+	{
+		libcdatetime_timezone_rule_free(
+		 &rule,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_timezone_rule_get_local_time_type_index function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_timezone_rule_get_local_time_type_index(
+     void )
+{
+	libcdatetime_timezone_rule_t *rule = NULL;
+	libcerror_error_t *error           = NULL;
+	uint8_t local_time_type_index      = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libcdatetime_timezone_rule_initialize(
+	          &rule,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "rule",
+	 rule );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rule->standard_utc_offset                        = 3600;
+	rule->daylight_saving_time_utc_offset            = 7200;
+	rule->standard_local_time_type_index             = 0;
+	rule->daylight_saving_time_local_time_type_index = 1;
+	rule->has_daylight_saving_time                   = 1;
+	rule->start_date.type                            = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	rule->start_date.month                           = 3;
+	rule->start_date.week_of_month                   = 5;
+	rule->start_date.day_of_week                     = 0;
+	rule->start_date.time_of_day                     = 7200;
+	rule->end_date.type                              = LIBCDATETIME_TIMEZONE_RULE_DATE_TYPE_MONTH_WEEK_DAY;
+	rule->end_date.month                             = 10;
+	rule->end_date.week_of_month                     = 5;
+	rule->end_date.day_of_week                       = 0;
+	rule->end_date.time_of_day                       = 10800;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1610668800,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1616893199,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1616893200,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1623715200,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1635641999,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1635642000,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	/* Test times of which the year cannot be represented
+	 */
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) INT64_MIN,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) INT64_MAX,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	/* Test daylight saving time that ends before it starts
+	 */
+	rule->standard_utc_offset             = 36000;
+	rule->daylight_saving_time_utc_offset = 39600;
+	rule->start_date.month                = 10;
+	rule->start_date.week_of_month        = 1;
+	rule->end_date.month                  = 4;
+	rule->end_date.week_of_month          = 1;
+
+	/* The cached years no longer apply to the changed rule
+	 */
+	result = memory_set(
+	          rule->cached_years,
+	          0,
+	          sizeof( libcdatetime_timezone_rule_year_t ) * LIBCDATETIME_TIMEZONE_RULE_NUMBER_OF_CACHED_YEARS ) != NULL;
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1610668800,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1617465599,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1617465600,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1623715200,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1633190399,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1633190400,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1639526400,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 1 );
+
+	/* Test without daylight saving time
+	 */
+	rule->has_daylight_saving_time = 0;
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1610668800,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "local_time_type_index",
+	 local_time_type_index,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          NULL,
+	          (int64_t) 1610668800,
+	          &local_time_type_index,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_timezone_rule_get_local_time_type_index(
+	          rule,
+	          (int64_t) 1610668800,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdatetime_timezone_rule_free(
+	          &rule,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "rule",
+	 rule );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rule != NULL )
+	{
+		libcdatetime_timezone_rule_free(
+		 &rule,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_rule_initialize",
+	 cdatetime_test_timezone_rule_initialize );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_rule_free",
+	 cdatetime_test_timezone_rule_free );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_rule_date_read_systemtime",
+	 cdatetime_test_timezone_rule_date_read_systemtime );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_rule_read_string",
+	 cdatetime_test_timezone_rule_read_string );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_rule_date_get_days_since_epoch",
+	 cdatetime_test_timezone_rule_date_get_days_since_epoch );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_rule_calculate_year",
+	 cdatetime_test_timezone_rule_calculate_year );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_rule_get_year",
+	 cdatetime_test_timezone_rule_get_year );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_timezone_rule_get_local_time_type_index",
+	 cdatetime_test_timezone_rule_get_local_time_type_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+}
+
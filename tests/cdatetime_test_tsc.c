@@ -0,0 +1,595 @@
+/*
+ * Library time stamp counter (TSC) functions test program
+ *
+ * Copyright (C) 2013-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cdatetime_test_libcdatetime.h"
+#include "cdatetime_test_libcerror.h"
+#include "cdatetime_test_macros.h"
+#include "cdatetime_test_unused.h"
+
+#include "../libcdatetime/libcdatetime_clock.h"
+#include "../libcdatetime/libcdatetime_definitions.h"
+#include "../libcdatetime/libcdatetime_tsc.h"
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+/* Determines if a POSIX time in nano seconds is within a second of the real-time clock
+ * Returns 1 if within a second, 0 if not or -1 on error
+ */
+int cdatetime_test_tsc_is_near_current_time(
+     int64_t posix_time_in_nano_seconds )
+{
+	libcdatetime_clock_settings_t clock_settings = {
+		LIBCDATETIME_CLOCK_SOURCE_REALTIME,
+		NULL,
+		NULL };
+
+	int64_t current_posix_time_in_nano_seconds   = 0;
+	int64_t delta_in_nano_seconds                = 0;
+
+	if( libcdatetime_clock_settings_get_current_time(
+	     &clock_settings,
+	     &current_posix_time_in_nano_seconds,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	delta_in_nano_seconds = current_posix_time_in_nano_seconds - posix_time_in_nano_seconds;
+
+	if( ( delta_in_nano_seconds < -1000000000LL )
+	 || ( delta_in_nano_seconds > 1000000000LL ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libcdatetime_tsc_calculate_multiplier function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_tsc_calculate_multiplier(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t multiplier      = 0;
+	uint8_t shift            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_tsc_calculate_multiplier(
+	          30000000,
+	          10000000,
+	          &multiplier,
+	          &shift,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "multiplier",
+	 multiplier,
+	 (uint64_t) 1431655765UL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "shift",
+	 shift,
+	 (uint8_t) 32 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the shift is reduced for a counter that is slower than 1 GHz
+	 */
+	result = libcdatetime_tsc_calculate_multiplier(
+	          1000000,
+	          10000000,
+	          &multiplier,
+	          &shift,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "multiplier",
+	 multiplier,
+	 (uint64_t) 2684354560UL );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT8(
+	 "shift",
+	 shift,
+	 (uint8_t) 28 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_tsc_calculate_multiplier(
+	          0,
+	          10000000,
+	          &multiplier,
+	          &shift,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_tsc_calculate_multiplier(
+	          30000000,
+	          0,
+	          &multiplier,
+	          &shift,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_tsc_calculate_multiplier(
+	          30000000,
+	          (uint64_t) UINT32_MAX + 1,
+	          &multiplier,
+	          &shift,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_tsc_calculate_multiplier(
+	          30000000,
+	          10000000,
+	          NULL,
+	          &shift,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_tsc_calculate_multiplier(
+	          30000000,
+	          10000000,
+	          &multiplier,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the counter is too fast to be represented
+	 */
+	result = libcdatetime_tsc_calculate_multiplier(
+	          (uint64_t) UINT64_MAX,
+	          1,
+	          &multiplier,
+	          &shift,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcdatetime_tsc_cycles_to_nano_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_tsc_cycles_to_nano_seconds(
+     void )
+{
+	uint64_t nano_seconds = 0;
+
+	/* Test regular cases
+	 */
+	nano_seconds = libcdatetime_tsc_cycles_to_nano_seconds(
+	                0,
+	                1431655765UL,
+	                32 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "nano_seconds",
+	 nano_seconds,
+	 (uint64_t) 0 );
+
+	nano_seconds = libcdatetime_tsc_cycles_to_nano_seconds(
+	                3000000000ULL,
+	                1431655765UL,
+	                32 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "nano_seconds",
+	 nano_seconds,
+	 (uint64_t) 999999999ULL );
+
+	/* Test that a number of cycles that exceeds 32-bit does not overflow
+	 */
+	nano_seconds = libcdatetime_tsc_cycles_to_nano_seconds(
+	                30000000000ULL,
+	                1431655765UL,
+	                32 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "nano_seconds",
+	 nano_seconds,
+	 (uint64_t) 9999999997ULL );
+
+	nano_seconds = libcdatetime_tsc_cycles_to_nano_seconds(
+	                100000000ULL,
+	                2684354560UL,
+	                28 );
+
+	CDATETIME_TEST_ASSERT_EQUAL_UINT64(
+	 "nano_seconds",
+	 nano_seconds,
+	 (uint64_t) 1000000000ULL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( LIBCDATETIME_HAVE_TSC )
+
+/* Tests the libcdatetime_tsc_calibration_get_current_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_tsc_calibration_get_current_time(
+     void )
+{
+	libcdatetime_tsc_calibration_t calibration;
+
+	libcerror_error_t *error           = NULL;
+	int64_t posix_time_in_nano_seconds = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &calibration,
+	 0,
+	 sizeof( libcdatetime_tsc_calibration_t ) );
+
+	/* Test error case where the calibration has not been calibrated
+	 */
+	result = libcdatetime_tsc_calibration_get_current_time(
+	          &calibration,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_tsc_calibration_calibrate(
+	          &calibration,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The processor does not provide an invariant TSC
+	 */
+	if( result == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libcdatetime_tsc_calibration_get_current_time(
+	          &calibration,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cdatetime_test_tsc_is_near_current_time(
+	          posix_time_in_nano_seconds );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that an expired anchor is renewed
+	 */
+	calibration.anchor_cycles                     = 0;
+	calibration.anchor_posix_time_in_nano_seconds = 0;
+
+	result = libcdatetime_tsc_calibration_get_current_time(
+	          &calibration,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cdatetime_test_tsc_is_near_current_time(
+	          posix_time_in_nano_seconds );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcdatetime_tsc_calibration_get_current_time(
+	          NULL,
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdatetime_tsc_calibration_get_current_time(
+	          &calibration,
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBCDATETIME_HAVE_TSC ) */
+
+/* Tests the libcdatetime_tsc_get_current_time function
+ * Returns 1 if successful or 0 if not
+ */
+int cdatetime_test_tsc_get_current_time(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	int64_t posix_time_in_nano_seconds = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdatetime_tsc_get_current_time(
+	          &posix_time_in_nano_seconds,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 1 )
+	{
+		result = cdatetime_test_tsc_is_near_current_time(
+		          posix_time_in_nano_seconds );
+
+		CDATETIME_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libcdatetime_tsc_get_current_time(
+	          NULL,
+	          &error );
+
+	CDATETIME_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CDATETIME_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CDATETIME_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CDATETIME_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argc )
+	CDATETIME_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_tsc_calculate_multiplier",
+	 cdatetime_test_tsc_calculate_multiplier );
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_tsc_cycles_to_nano_seconds",
+	 cdatetime_test_tsc_cycles_to_nano_seconds );
+
+#if defined( LIBCDATETIME_HAVE_TSC )
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_tsc_calibration_get_current_time",
+	 cdatetime_test_tsc_calibration_get_current_time );
+
+#endif /* defined( LIBCDATETIME_HAVE_TSC ) */
+
+	CDATETIME_TEST_RUN(
+	 "libcdatetime_tsc_get_current_time",
+	 cdatetime_test_tsc_get_current_time );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCDATETIME_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
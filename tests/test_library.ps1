@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "elements error support timestamp"
+$LibraryTests = "clock elements error format_detector identifier identifier_generator monotonic_timestamp stream_parser support system_timezone ticker timestamp timestamp_generator timezone timezone_database timezone_rule tsc"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 